@@ -7,8 +7,15 @@
 /** \addtogroup BUZZER Buzzer
  ** @{ */
 
-/** @brief 
+/** @brief Buzzer driver
  *
+ * Melodies can be played blocking (BuzzerPlayRtttl()) or in background
+ * (BuzzerPlayMelody(), BuzzerPlayRtttlAsync()). In background mode a timer
+ * callback changes the PWM frequency at the end of every note, so the calling
+ * task is not blocked.
+ *
+ * RTTTL melodies can be compiled once (BuzzerCompileRtttl()) into an array
+ * of notes, so they are not parsed again on every play.
  *
  * @author Albano Peñalva
  * 
@@ -17,10 +24,12 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 08/04/2024 | Document creation		                         |
+ * | 18/10/2026 | Compiled melodies and background sequencer     |
  *
  */
 
 /*==================[inclusions]=============================================*/
+#include <stdbool.h>
 #include <stdint.h>
 #include <gpio_mcu.h>
 /*==================[macros]=================================================*/
@@ -114,7 +123,16 @@
 #define NOTE_CS8 4435
 #define NOTE_D8  4699
 #define NOTE_DS8 4978
+
+#define BUZZER_MAX_NOTES 128    /*!< Max notes of a melody played with BuzzerPlayRtttlAsync() */
 /*==================[typedef]================================================*/
+/**
+ * @brief Note of a compiled melody
+ */
+typedef struct {
+    uint16_t freq;      /*!< Note frequency in Hz (0: rest) */
+    uint16_t duration;  /*!< Note duration (in ms) */
+} buzzer_note_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -157,10 +175,58 @@ void BuzzerPlayTone(uint16_t freq, uint16_t duration);
 /**
  * @brief Plays a melody stored in format RTTTL (Ring Tone Text Transfer Language).
  * 
+ * @note Notes are played while they are parsed, so the melody length is not 
+ * limited (unlike BuzzerPlayRtttlAsync()).
+ * 
  * @param rtttl_melody String containing text with a RTTTL melody.
  */
 void BuzzerPlayRtttl(const char * rtttl_melody);
 
+/**
+ * @brief Converts a RTTTL melody into an array of notes.
+ * 
+ * @param rtttl_melody String containing text with a RTTTL melody.
+ * @param melody Array where the notes are stored.
+ * @param max_notes Size of the array.
+ * @return uint16_t Number of notes stored.
+ */
+uint16_t BuzzerCompileRtttl(const char * rtttl_melody, buzzer_note_t *melody, uint16_t max_notes);
+
+/**
+ * @brief Plays a compiled melody in background (returns immediately).
+ * 
+ * @note The array must remain valid while the melody is playing.
+ * 
+ * @param melody Array of notes.
+ * @param length Number of notes.
+ * @param loop true: repeat the melody until BuzzerStop() is called.
+ * @return true if the melody started.
+ */
+bool BuzzerPlayMelody(const buzzer_note_t *melody, uint16_t length, bool loop);
+
+/**
+ * @brief Compiles and plays a RTTTL melody in background (returns immediately).
+ * 
+ * @note Up to BUZZER_MAX_NOTES notes are played.
+ * 
+ * @param rtttl_melody String containing text with a RTTTL melody.
+ * @param loop true: repeat the melody until BuzzerStop() is called.
+ * @return true if the melody started.
+ */
+bool BuzzerPlayRtttlAsync(const char * rtttl_melody, bool loop);
+
+/**
+ * @brief Stops the melody being played in background.
+ */
+void BuzzerStop(void);
+
+/**
+ * @brief Checks if a melody is being played in background.
+ * 
+ * @return true if playing.
+ */
+bool BuzzerIsPlaying(void);
+
 /**
  * @brief Buzzer de-initialization.
  */
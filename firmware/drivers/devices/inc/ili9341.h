@@ -33,6 +33,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 18/01/2024 | Document creation		                         |
+ * | 18/10/2026 | Drawing time measured with trace_mcu           |
  *
  */
 
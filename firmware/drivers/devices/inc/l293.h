@@ -31,6 +31,8 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 17/05/2024 | Document creation		                         |
+ * | 18/10/2026 | Fix backward direction (1A/2A and 3A/4A swapped)|
+ * | 18/10/2026 | L293SetSpeedFine() with 0.1% resolution        |
  *
  */
 
@@ -70,6 +72,17 @@ uint8_t L293Init(void);
  */
 uint8_t L293SetSpeed(l293_motor_t motor, int8_t speed);
 
+/**
+ * @brief  		Sets motor speed with 0.1% resolution
+ * @param[in]  	motor: 	motor to be configured
+ * @param[in]  	speed: 	from -1000 to 1000
+ * 						0: 			stop
+ * 						1 to 1000: 	foward
+ * 						-1 to -1000: backward
+ * @retval 		0 when success, 1 when fails
+ */
+uint8_t L293SetSpeedFine(l293_motor_t motor, int16_t speed);
+
 /**
  * @brief  	De-initializes L293 Driver
  * @param	None
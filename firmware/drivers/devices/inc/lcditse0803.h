@@ -30,6 +30,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 18/10/2026 | BCD and SEL lines written as one GPIO bus									|
  * 
  **/
 
@@ -18,6 +18,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 18/10/2026 | LEDs written as one GPIO bus (LedsMask() updates all of them at once)	|
  * 
  **/
 
@@ -0,0 +1,142 @@
+#ifndef MOTOR_CONTROL_H
+#define MOTOR_CONTROL_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Motor_Control Motor control
+ ** @{ */
+
+/** \brief Closed-loop DC motor speed controller.
+ *
+ * PID + feed-forward speed controller on top of the L293 driver. The control
+ * loop is triggered by a hardware timer (1 kHz by default) and runs in a high
+ * priority task, so the motor responds in a few milliseconds.
+ *
+ * - Gains are fixed point Q16 (65536 = 1.0) and are applied per iteration.
+ * - The integral term uses conditional integration (anti-windup): it is frozen
+ * while the output is saturated in the direction of the error.
+ * - The output is slew-rate limited, so setting speed 0 brakes smoothly.
+ * - Execution time and period of every iteration are recorded.
+ *
+ * Output is expressed in ‰ of duty cycle (-1000 to 1000).
+ *
+ * @note The speed feedback is provided by the user (e.g. from TachometerRead()),
+ * setpoint and feedback must use the same units. The loop rate should match
+ * the rate at which the feedback is updated (for the tachometer, one iteration
+ * per window): iterations with a stale measurement integrate the same error
+ * again and see no change in the derivative term.
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "l293.h"
+#include "timer_mcu.h"
+/*==================[macros]=================================================*/
+#define MOTOR_CONTROL_Q16_ONE		65536	/*!< 1.0 in Q16 gains */
+#define MOTOR_CONTROL_OUT_MAX		1000	/*!< Max output (‰ of duty cycle) */
+#define MOTOR_CONTROL_DEFAULT_HZ	1000	/*!< Default control loop rate */
+/*==================[typedef]================================================*/
+/**
+ * @brief Prototype of the speed feedback function
+ *
+ * @return measured speed (same units as the setpoint)
+ */
+typedef int32_t (*motor_feedback_func)(void);
+
+/**
+ * @brief Motor controller configuration struct
+ */
+typedef struct {
+	l293_motor_t motor;					/*!< Controlled motor */
+	timer_mcu_t timer;					/*!< Timer used to trigger the control loop */
+	uint16_t rate_hz;					/*!< Control loop rate, same as the feedback update rate (0: MOTOR_CONTROL_DEFAULT_HZ) */
+	int32_t kp;							/*!< Proportional gain (Q16) */
+	int32_t ki;							/*!< Integral gain (Q16, per iteration) */
+	int32_t kd;							/*!< Derivative gain (Q16, per iteration) */
+	int32_t kff;						/*!< Feed-forward gain (Q16, output per setpoint unit) */
+	uint32_t slew_permille_s;			/*!< Max output change in ‰/s (0: no limit) */
+	motor_feedback_func feedback_func;	/*!< Pointer to speed feedback function */
+} motor_control_config_t;
+
+/**
+ * @brief Control loop timing statistics (in us)
+ */
+typedef struct {
+	uint32_t iterations;	/*!< Control loop iterations */
+	uint32_t overruns;		/*!< Timer ticks missed because an iteration was late */
+	uint32_t exec_min;		/*!< Min execution time of one iteration */
+	uint32_t exec_max;		/*!< Max execution time of one iteration */
+	uint32_t exec_avg;		/*!< Mean execution time of one iteration */
+	uint32_t period_min;	/*!< Min time between iterations */
+	uint32_t period_max;	/*!< Max time between iterations */
+} motor_control_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Motor controller initialization
+ *
+ * @note L293Init() must be called before. The loop starts with setpoint 0.
+ *
+ * @param config Pointer to controller configuration
+ * @return true on success, false if the control task could not be created
+ */
+bool MotorControlInit(motor_control_config_t *config);
+
+/**
+ * @brief Set the speed setpoint
+ *
+ * @param setpoint Desired speed (same units as the feedback function)
+ */
+void MotorControlSetSpeed(int32_t setpoint);
+
+/**
+ * @brief Smoothly stop the motor (setpoint 0 and integral term cleared).
+ *
+ * @note Deceleration is given by the configured slew rate.
+ */
+void MotorControlBrake(void);
+
+/**
+ * @brief Read the current controller output
+ *
+ * @return int16_t output in ‰ of duty cycle (-1000 to 1000)
+ */
+int16_t MotorControlGetOutput(void);
+
+/**
+ * @brief Read the control loop timing statistics
+ *
+ * @param stats Pointer to where the statistics will be copied
+ */
+void MotorControlGetStats(motor_control_stats_t *stats);
+
+/**
+ * @brief Clear the control loop timing statistics
+ */
+void MotorControlResetStats(void);
+
+/**
+ * @brief Motor controller de-initialization (motor is stopped)
+ *
+ * @return true
+ */
+bool MotorControlDeinit(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MOTOR_CONTROL_H */
+
+/*==================[end of file]============================================*/
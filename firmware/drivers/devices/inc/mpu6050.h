@@ -17,11 +17,14 @@
  * |   Date	| Description                                    			|
  * |:----------:|:----------------------------------------------------------------------|
  * | 30/01/2024 | Document creation		                         		|
+ * | 18/10/2026 | FIFO block reading of accelerometer and gyroscope samples	|
+ * | 18/10/2026 | Timestamps of the FIFO samples (timestamp_mcu.h)			|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "i2c_mcu.h"
+#include "timestamp_mcu.h"
 /*==================[macros]=================================================*/
 #undef pgm_read_byte
 #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
@@ -34,6 +37,8 @@
 #define MPU6050_ADDRESS_AD0_LOW     0x68 // address pin low (GND), default for InvenSense evaluation board
 #define MPU6050_ADDRESS_AD0_HIGH    0x69 // address pin high (VCC)
 #define MPU6050_DEFAULT_ADDRESS     MPU6050_ADDRESS_AD0_LOW
+#define MPU6050_FIFO_SIZE           1024    // FIFO buffer size (bytes)
+#define MPU6050_MOTION6_BYTES       12      // Accelerometer and gyroscope sample in the FIFO
 
 #define MPU6050_RA_XG_OFFS_TC       0x00 //[7] PWR_MODE, [6:1] XG_OFFS_TC, [0] OTP_BNK_VLD
 #define MPU6050_RA_YG_OFFS_TC       0x01 //[7] PWR_MODE, [6:1] YG_OFFS_TC, [0] OTP_BNK_VLD
@@ -2648,6 +2653,31 @@ void MPU6050_setFIFOByte(uint8_t data);
  */
 void MPU6050_getFIFOBytes(uint8_t *data, uint8_t length);
 
+/** Configure the FIFO buffer for accelerometer and gyroscope samples.
+ * Sets the sample rate (1 kHz / (1 + divider)) and a digital low pass filter
+ * below half of it, enables the accelerometer and gyroscope XYZ samples in the
+ * FIFO (12 bytes per sample, temperature disabled), and restarts it. At 500 Hz
+ * the FIFO holds 85 samples (170 ms): read it at least every 100 ms.
+ * @param rate_hz Sample rate (4 to 1000 Hz)
+ * @return Actual sample rate (Hz)
+ * @see getFIFOMotion6()
+ */
+uint16_t MPU6050_setupFIFOMotion6(uint16_t rate_hz);
+
+/** Read the accelerometer and gyroscope samples stored in the FIFO buffer.
+ * Samples are stored as ax, ay, az, gx, gy, gz, in the order they were taken
+ * (same values as getMotion6()), ready for ImuFilterUpdate(). If the FIFO has
+ * overflowed the samples are lost (the FIFO is restarted).
+ * The newest sample is assumed taken when the FIFO count is read (it can be
+ * up to one sample period older).
+ * @param samples Array for 6 values per sample
+ * @param max Max number of samples to read
+ * @param stamp Time of the samples read, see TimestampSample() (NULL if not needed)
+ * @return Number of samples read
+ * @see setupFIFOMotion6()
+ */
+uint16_t MPU6050_getFIFOMotion6(int16_t *samples, uint16_t max, timestamp_block_t *stamp);
+
 // WHO_AM_I register
 /** Get Device ID.
  * This register is used to verify the identity of the device (0b110100, 0x34).
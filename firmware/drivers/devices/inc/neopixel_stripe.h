@@ -14,6 +14,15 @@
  * 
  * @note ESP-EDU have one individual NeoPixel connected to GPIO_8, that can be used with this driver.
  * 
+ * @note By default every change is sent to the stripe immediately. After 
+ * NeoPixelFrameStart() changes are only written to the color array (back 
+ * buffer) and a background task sends it at a fixed frame rate, once per 
+ * frame and only if something changed.
+ * 
+ * @note NeoPixelShift() rotates an offset instead of moving the colors, so the 
+ * color array passed to NeoPixelInit() is not in stripe order after a shift.
+ * Use NeoPixelGetPixel() to read a pixel color.
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -21,10 +30,12 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 18/10/2026 | Frame mode, brightness/gamma LUT and O(1) shift						|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
+#include <stdbool.h>
 #include <stdint.h>
 #include "sdkconfig.h"
 #include "esp_err.h"
@@ -103,9 +114,22 @@ void NeoPixelAllColor(neopixel_color_t color);
  */
 void NeoPixelSetPixel(uint16_t pixel, neopixel_color_t color);
 
+/**
+ * @brief Get the color of an individual pixel.
+ * 
+ * @param pixel     NeoPixel number on the stripe
+ * @return neopixel_color_t 24 bits color
+ */
+neopixel_color_t NeoPixelGetPixel(uint16_t pixel);
+
 /**
  * @brief Set all NeoPixels in the array with the color stored in an array.
  * 
+ * @note The array is shown as is, without modifying the one given to
+ * NeoPixelInit(). It is not copied: in frame mode it is read on every frame,
+ * so it must remain valid until the next change. The other setters show the
+ * NeoPixelInit() array again.
+ * 
  * @param color_array Array of 24 bits color
  */
 void NeoPixelSetArray(neopixel_color_t *color_array);
@@ -157,6 +181,19 @@ neopixel_color_t NeoPixelHSV2Color(uint16_t hue, uint8_t sat, uint8_t val);
  */
 void NeoPixelRainbow(uint16_t first_hue, uint8_t sat, uint8_t val, uint8_t reps);
 
+/**
+ * @brief Start frame mode: changes are sent to the stripe at a fixed frame rate.
+ * 
+ * @param fps Frames per second (e.g. 60)
+ * @return true if frame mode was started
+ */
+bool NeoPixelFrameStart(uint8_t fps);
+
+/**
+ * @brief Stop frame mode: changes are sent to the stripe immediately.
+ */
+void NeoPixelFrameStop(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
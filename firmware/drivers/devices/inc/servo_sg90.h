@@ -18,6 +18,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/01/2024 | Document creation		                         						|
+ * | 18/10/2026 | Full PWM resolution and synchronized moves (ServoMoveMulti)			|
  * 
  **/
 
@@ -55,6 +56,17 @@ uint8_t ServoInit(servo_out_t servo, gpio_t gpio);
  */
 void ServoMove(servo_out_t servo, int8_t ang);
 
+/**
+ * @brief Change the angle of several servos at once.
+ * 
+ * All servos start moving in the same PWM period.
+ * 
+ * @param servos Array of servo numbers
+ * @param angs Array of servo angles (from -90 to 90 degrees)
+ * @param qty Number of servos
+ */
+void ServoMoveMulti(const servo_out_t *servos, const int8_t *angs, uint8_t qty);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
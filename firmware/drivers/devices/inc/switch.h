@@ -12,6 +12,12 @@
  * @note ESP-EDU have 2 switches connected to GPIO_4 and GPIO_15. 
  * The latter is also routed to J2 connector.
  *
+ * @note Besides SwitchesRead(), the driver has an event service (SwitchesEventsInit()): 
+ * a falling edge interrupt wakes a 5 ms timer that debounces the keys and queues
+ * press, release, long press and double click events. The timer stops when all
+ * keys are released, so there is no polling while idle. Other keys (active low)
+ * can be added with SwitchAddKey().
+ *
  * @author Albano Peñalva
  *
  * @section changelog
@@ -19,19 +25,52 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 18/10/2026 | Debounced key events (press, release, long press, double click)	|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
+#include "gpio_mcu.h"
 /*==================[macros]=================================================*/
+#define SWITCH_KEYS_MAX		8		/*!< Max number of keys handled by the event service (board switches included) */
+#define SWITCH_TICK_MS		5		/*!< Debounce sampling period */
 
 /*==================[typedef]================================================*/
 typedef enum switches {
     SWITCH_1 = (1 << 0),  /**< Routed to GPIO_4 */
     SWITCH_2 = (1 << 1),  /**< Routed to GPIO_15 */
 } switch_t;
+
+/**
+ * @brief Key events
+ */
+typedef enum {
+	SWITCH_PRESS,			/**< Key pressed (debounced) */
+	SWITCH_RELEASE,			/**< Key released */
+	SWITCH_LONG_PRESS,		/**< Key held down for long_ms (sent once per press) */
+	SWITCH_DOUBLE_CLICK,	/**< Key pressed again within double_ms of a short click (sent after its SWITCH_PRESS) */
+} switch_event_type_t;
+
+/**
+ * @brief Key event
+ */
+typedef struct {
+	uint8_t key;				/**< SWITCH_1, SWITCH_2 or the value returned by SwitchAddKey() */
+	switch_event_type_t type;	/**< Event */
+	uint32_t time_ms;			/**< Time since the press (release and long press events) */
+} switch_event_t;
+
+/**
+ * @brief Event service configuration
+ */
+typedef struct {
+	uint8_t switches;		/**< Board switches handled: SWITCH_1, SWITCH_2, both or 0 (only keys added later) */
+	uint16_t long_ms;		/**< Hold time of a long press (0: no long press events) */
+	uint16_t double_ms;		/**< Max time between a release and the next press of a double click (0: no double click events) */
+	uint8_t queue_len;		/**< Number of events queued */
+} switch_events_config_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -58,6 +97,35 @@ int8_t SwitchesRead(void);
  */
 void SwitchActivInt(switch_t tec, void *ptrIntFunc, void *args);
 
+/**
+ * @brief Start the key event service.
+ * 
+ * @note Do not use SwitchActivInt() on the keys handled by the service.
+ * 
+ * @param config Service configuration
+ * @return true Service started
+ * @return false Already started or not enough memory
+ */
+bool SwitchesEventsInit(const switch_events_config_t *config);
+
+/**
+ * @brief Add a key (active low, with pull-up) to the event service.
+ * 
+ * @param pin GPIO of the key
+ * @return uint8_t Key identifier for the events (a single bit, after SWITCH_2), 0 if no more keys can be added
+ */
+uint8_t SwitchAddKey(gpio_t pin);
+
+/**
+ * @brief Get the next key event.
+ * 
+ * @param event Event read
+ * @param timeout_ms Max waiting time (0: no wait, UINT32_MAX: forever)
+ * @return true Event read
+ * @return false No event in time
+ */
+bool SwitchGetEvent(switch_event_t *event, uint32_t timeout_ms);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -0,0 +1,115 @@
+#ifndef TACHOMETER_H
+#define TACHOMETER_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Tachometer Tachometer
+ ** @{ */
+
+/** \brief Tachometer driver for slotted encoder discs (TCRT5000 and similar).
+ *
+ * Edges are counted in hardware by the ESP32-C6 pulse counter (PCNT), with
+ * its glitch filter enabled, so the CPU is not interrupted on every slot.
+ * The PCNT only raises an interrupt once per revolution (used to measure the
+ * revolution period) and a periodic window timer reads the count.
+ *
+ * Each window the speed is estimated with:
+ * - count method: edges in the window / elapsed time (high speeds).
+ * - period method: time of the last full revolution (low speeds, when only
+ * a few edges fall inside the window).
+ *
+ * @note Only falling edges are counted (one edge per slot).
+ *
+ * @note All results are integers (no FPU in ESP32-C6).
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "gpio_mcu.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Speed measurement method used to compute the last result
+ */
+typedef enum {
+	TACHOMETER_STOPPED,			/*!< No edges detected during the stop timeout */
+	TACHOMETER_COUNT,			/*!< Edges counted over the window */
+	TACHOMETER_PERIOD			/*!< Period of the last revolution */
+} tachometer_method_t;
+
+/**
+ * @brief Tachometer measurement
+ */
+typedef struct {
+	uint32_t rpm_milli;			/*!< Wheel speed in mRPM (RPM * 1000) */
+	uint32_t speed_mm_s;		/*!< Linear speed in mm/s */
+	uint32_t edges;				/*!< Edges counted in the last window */
+	uint32_t revolutions;		/*!< Total revolutions since TachometerInit() */
+	tachometer_method_t method;	/*!< Method used for this measurement */
+} tachometer_measure_t;
+
+/**
+ * @brief Prototype of callback function called at the end of every window
+ *
+ * @param measure pointer to the new measurement
+ * @param param pointer to callback function parameter
+ */
+typedef void (*tachometer_func)(const tachometer_measure_t *measure, void *param);
+
+/**
+ * @brief Tachometer configuration struct
+ */
+typedef struct {
+	gpio_t gpio;				/*!< GPIO connected to the sensor output */
+	uint16_t slots;				/*!< Number of slots in the encoder disc */
+	uint16_t wheel_diameter_mm;	/*!< Wheel diameter (in mm) */
+	uint16_t window_ms;			/*!< Measurement window (in ms) */
+	uint32_t glitch_ns;			/*!< Pulses shorter than this are ignored (0: filter disabled) */
+	tachometer_func func_p;		/*!< Pointer to callback function (NULL if not required) */
+	void *param_p;				/*!< Pointer to callback function parameter */
+} tachometer_config_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Tachometer initialization
+ *
+ * @note Measurement starts right after initialization.
+ *
+ * @param config Pointer to tachometer configuration
+ * @return true on success, false if the PCNT or window timer could not be configured
+ */
+bool TachometerInit(tachometer_config_t *config);
+
+/**
+ * @brief Read the last measurement
+ *
+ * @param measure Pointer to where the measurement will be copied
+ */
+void TachometerRead(tachometer_measure_t *measure);
+
+/**
+ * @brief Tachometer de-initialization
+ *
+ * @return true
+ */
+bool TachometerDeinit(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TACHOMETER_H */
+
+/*==================[end of file]============================================*/
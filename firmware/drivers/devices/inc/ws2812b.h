@@ -19,6 +19,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 18/10/2026 | ws2812bSendRaw() for pre-corrected colors		                     	|
  * 
  **/
 
@@ -57,6 +58,23 @@ void ws2812bInit(gpio_t pin);
  */
 void ws2812bSend(rgb_led_t led_color);
 
+/**
+ * @brief Send color information to NeoPixel, without gamma correction.
+ * 
+ * @note Use it for colors already corrected with ws2812bGammaCorrection().
+ * 
+ * @param led_color NeoPixel color
+ */
+void ws2812bSendRaw(rgb_led_t led_color);
+
+/**
+ * @brief Gamma correction of a color component.
+ * 
+ * @param component Color level (0 to 255)
+ * @return uint8_t Corrected level
+ */
+uint8_t ws2812bGammaCorrection(uint8_t component);
+
 /**
  * @brief Send a ret command to NeoPixel.
  * 
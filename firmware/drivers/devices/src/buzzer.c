@@ -13,13 +13,25 @@
 #include "buzzer.h"
 #include "delay_mcu.h"
 #include "pwm_mcu.h"
+#include "esp_timer.h"
 /*==================[macros and definitions]=================================*/
 #define PWM_BUZZER      PWM_3
 #define PWM_DC          50
 #define OCTAVE_OFFSET   0
+#define MIN_OCTAVE      4
+#define MAX_OCTAVE      7
+#define US_PER_MS       1000
 /*==================[internal data declaration]==============================*/
-
+static esp_timer_handle_t sequencer_timer = NULL;  /*!< One-shot timer, re-armed on every note */
+static const buzzer_note_t *seq_notes;             /*!< Melody being played */
+static uint16_t seq_length = 0;                    /*!< Notes in the melody */
+static uint16_t seq_index = 0;                     /*!< Next note to play */
+static bool seq_loop = false;                      /*!< Restart at the end of the melody */
+static volatile bool playing = false;              /*!< A melody is being played */
+static buzzer_note_t rtttl_buffer[BUZZER_MAX_NOTES]; /*!< Last compiled RTTTL melody */
 /*==================[internal functions declaration]=========================*/
+static void buzzer_sequencer(void *param);
+static uint16_t rtttl_parse(const char * rtttl_melody, buzzer_note_t *melody, uint16_t max_notes);
 
 /*==================[internal data definition]===============================*/
 uint16_t notes[] = {
@@ -39,33 +51,37 @@ bool isDigit(char c){
         return false;
     }
 }
-/*==================[external functions definition]==========================*/
-void BuzzerInit(gpio_t pin){
-    PWMInit(PWM_BUZZER, pin, NOTE_C4);
-    PWMSetDutyCycle(PWM_BUZZER, PWM_DC);
-    PWMOff(PWM_BUZZER);
-}
-
-void BuzzerOn(void){
-    PWMOn(PWM_BUZZER);
-}
 
-void BuzzerOff(void){
-    PWMOff(PWM_BUZZER);
-}
-
-void BuzzerSetFrec(uint16_t freq){
-    PWMSetFreq(PWM_BUZZER, freq);
-}
-
-void BuzzerPlayTone(uint16_t freq, uint16_t duration){
-	PWMSetFreq(PWM_BUZZER, freq);
-	PWMOn(PWM_BUZZER);
-	DelayMs(duration);
-	PWMOff(PWM_BUZZER);
+/**
+ * @brief Sequencer timer callback: starts the next note and re-arms the timer
+ * with its duration.
+ */
+static void buzzer_sequencer(void *param){
+    const buzzer_note_t *note;
+    if(seq_index >= seq_length){
+        if(!seq_loop){
+            PWMOff(PWM_BUZZER);
+            playing = false;
+            return;
+        }
+        seq_index = 0;
+    }
+    note = &seq_notes[seq_index++];
+    if(note->freq){
+        PWMSetFreq(PWM_BUZZER, note->freq);
+        PWMOn(PWM_BUZZER);
+    }
+    else{
+        PWMOff(PWM_BUZZER);
+    }
+    esp_timer_start_once(sequencer_timer, (uint64_t)note->duration * US_PER_MS);
 }
 
-void BuzzerPlayRtttl(const char * rtttl_melody){
+/**
+ * @brief RTTTL parser. Notes are stored in melody (up to max_notes) or, when
+ * melody is NULL, played as they are parsed (no length limit).
+ */
+static uint16_t rtttl_parse(const char * rtttl_melody, buzzer_note_t *melody, uint16_t max_notes){
     uint8_t default_dur = 4;
     uint8_t default_oct = 6;
     int bpm = 63;
@@ -74,9 +90,12 @@ void BuzzerPlayRtttl(const char * rtttl_melody){
     long duration;
     uint8_t note;
     uint8_t scale;
+    uint16_t length = 0;
+    buzzer_note_t current;
 
     /* find the start (skip name, etc) */
-    while(*rtttl_melody != ':') rtttl_melody++; // ignore name
+    while(*rtttl_melody && (*rtttl_melody != ':')) rtttl_melody++; // ignore name
+    if(*rtttl_melody == 0) return 0;
     rtttl_melody++;                             // skip ':'
 
     /* get default duration */
@@ -108,7 +127,7 @@ void BuzzerPlayRtttl(const char * rtttl_melody){
         while(isDigit(*rtttl_melody)){
         num = (num * 10) + (*rtttl_melody++ - '0');
         }
-        bpm = num;
+        if(num > 0) bpm = num;
         rtttl_melody++;     // skip colon
     }
 
@@ -116,7 +135,7 @@ void BuzzerPlayRtttl(const char * rtttl_melody){
     wholenote = (60 * 1000L / bpm) * 4;  // this is the time for whole note (in milliseconds)
 
     /* now begin note loop */
-    while(*rtttl_melody){
+    while(*rtttl_melody && ((melody == NULL) || (length < max_notes))){
         /* first, get note duration, if available */
         num = 0;
         while(isDigit(*rtttl_melody)){
@@ -174,21 +193,118 @@ void BuzzerPlayRtttl(const char * rtttl_melody){
             scale = default_oct;
         }
         scale += OCTAVE_OFFSET;
+        /* b# is the C of the next octave */
+        if(note > 12){
+            note -= 12;
+            scale++;
+        }
 
         if(*rtttl_melody == ','){
             rtttl_melody++; // skip comma for next note (or we may be at the end)
         }
-        /* now play the note */
-        if(note){
-            BuzzerPlayTone(notes[(scale - 4) * 12 + note], duration);
+        /* now store or play the note (out of range octaves are played as rests) */
+        if(note && (scale >= MIN_OCTAVE) && (scale <= MAX_OCTAVE)){
+            current.freq = notes[(scale - MIN_OCTAVE) * 12 + note];
+        }
+        else{
+            current.freq = 0;
+        }
+        current.duration = (duration > UINT16_MAX) ? UINT16_MAX : duration;
+        if(melody != NULL){
+            melody[length] = current;
+        }
+        else if(current.freq){
+            BuzzerPlayTone(current.freq, current.duration);
         }
         else{
-            DelayMs(duration);
+            DelayMs(current.duration);
         }
+        length++;
+    }
+    return length;
+}
+
+/*==================[external functions definition]==========================*/
+void BuzzerInit(gpio_t pin){
+    PWMInit(PWM_BUZZER, pin, NOTE_C4);
+    PWMSetDutyCycle(PWM_BUZZER, PWM_DC);
+    PWMOff(PWM_BUZZER);
+    if(sequencer_timer == NULL){
+        const esp_timer_create_args_t sequencer_args = {
+            .callback = buzzer_sequencer,
+            .name = "buzzer"
+        };
+        esp_timer_create(&sequencer_args, &sequencer_timer);
+    }
+}
+
+void BuzzerOn(void){
+    PWMOn(PWM_BUZZER);
+}
+
+void BuzzerOff(void){
+    PWMOff(PWM_BUZZER);
+}
+
+void BuzzerSetFrec(uint16_t freq){
+    PWMSetFreq(PWM_BUZZER, freq);
+}
+
+void BuzzerPlayTone(uint16_t freq, uint16_t duration){
+	PWMSetFreq(PWM_BUZZER, freq);
+	PWMOn(PWM_BUZZER);
+	DelayMs(duration);
+	PWMOff(PWM_BUZZER);
+}
+
+uint16_t BuzzerCompileRtttl(const char * rtttl_melody, buzzer_note_t *melody, uint16_t max_notes){
+    if(melody == NULL){
+        return 0;
     }
+    return rtttl_parse(rtttl_melody, melody, max_notes);
+}
+
+void BuzzerPlayRtttl(const char * rtttl_melody){
+    BuzzerStop();
+    rtttl_parse(rtttl_melody, NULL, 0);
+}
+
+bool BuzzerPlayMelody(const buzzer_note_t *melody, uint16_t length, bool loop){
+    if((sequencer_timer == NULL) || (length == 0)){
+        return false;
+    }
+    BuzzerStop();
+    seq_notes = melody;
+    seq_length = length;
+    seq_index = 0;
+    seq_loop = loop;
+    playing = true;
+    buzzer_sequencer(NULL);
+    return true;
+}
+
+bool BuzzerPlayRtttlAsync(const char * rtttl_melody, bool loop){
+    BuzzerStop();
+    return BuzzerPlayMelody(rtttl_buffer, BuzzerCompileRtttl(rtttl_melody, rtttl_buffer, BUZZER_MAX_NOTES), loop);
+}
+
+void BuzzerStop(void){
+    if(sequencer_timer != NULL){
+        esp_timer_stop(sequencer_timer);
+    }
+    playing = false;
+    PWMOff(PWM_BUZZER);
+}
+
+bool BuzzerIsPlaying(void){
+    return playing;
 }
 
 void BuzzerDeinit(void){
-    
+    BuzzerStop();
+    if(sequencer_timer != NULL){
+        esp_timer_delete(sequencer_timer);
+        sequencer_timer = NULL;
+    }
 }
 /*==================[end of file]============================================*/
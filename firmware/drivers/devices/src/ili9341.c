@@ -15,6 +15,7 @@
 #include "spi_mcu.h"
 #include "gpio_mcu.h"
 #include "delay_mcu.h"
+#include "trace_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define NULL 0
 
@@ -237,6 +238,7 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	static int16_t x_dist, y_dist;
 	static uint8_t pixel[MAX_VALUE_SIZE];
 
+	TRACE_ENTER(TRACE_ILI9341);
 	x_dist = x1 - x0;
 	y_dist = y1 - y0;
 	if (x0 > x1){
@@ -265,6 +267,7 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	}
 	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
 	WriteLCD(&lcd_pixel);
+	TRACE_EXIT(TRACE_ILI9341);
 }
 
 /*==================[external functions definition]==========================*/
@@ -804,6 +807,7 @@ void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
 	static int32_t bytes_count;
 	static uint8_t pixel[MAX_VALUE_SIZE];
 
+	TRACE_ENTER(TRACE_ILI9341);
 	SetCursorPosition(x, y, x + width - 1, y + height - 1);
 
 	/* Number of bytes to write. We have to write 2 bytes/pixel */
@@ -828,6 +832,7 @@ void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
 	}
 	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
 	WriteLCD(&lcd_pixel);
+	TRACE_EXIT(TRACE_ILI9341);
 }
 
 uint8_t ILI9341DeInit(void){
@@ -16,6 +16,9 @@
 /*==================[macros and definitions]=================================*/
 #define MAX_F_SPEED 	100		/*!< Max foward speed  */
 #define MAX_B_SPEED 	-100	/*!< Max backward speed */
+#define MAX_F_SPEED_FINE 	1000	/*!< Max foward speed (fine) */
+#define MAX_B_SPEED_FINE 	-1000	/*!< Max backward speed (fine) */
+#define FINE_PER_SPEED	10		/*!< Fine speed steps per speed step */
 #define PWM_FREQ 		50		/*!< PWM frequency (Hz) */
 #define N_MOTORS		2		/*!< Number of motors */
 #define EN_1_2			GPIO_22
@@ -49,46 +52,29 @@ uint8_t L293Init(void){
 }
 
 uint8_t L293SetSpeed(l293_motor_t motor, int8_t speed){
+	if (speed > MAX_F_SPEED) speed = MAX_F_SPEED;
+	if (speed < MAX_B_SPEED) speed = MAX_B_SPEED;
+	return L293SetSpeedFine(motor, (int16_t)speed * FINE_PER_SPEED);
+}
+
+uint8_t L293SetSpeedFine(l293_motor_t motor, int16_t speed){
 	uint8_t err = 0;
+	uint16_t duty;
+
+	if (speed > MAX_F_SPEED_FINE) speed = MAX_F_SPEED_FINE;
+	if (speed < MAX_B_SPEED_FINE) speed = MAX_B_SPEED_FINE;
+	duty = (speed < 0) ? -speed : speed;
 
 	switch(motor){
 	case MOTOR_1:
-		if(speed == 0){
-			PWMSetDutyCycle(PWM_0, speed);
-			GPIOOff(A_1);
-			GPIOOff(A_2);
-		}
-		if(speed > 0){
-			if (speed > MAX_F_SPEED) speed = MAX_F_SPEED;
-			PWMSetDutyCycle(PWM_0, speed);
-			GPIOOn(A_1);
-			GPIOOff(A_2);
-		}
-		if(speed < 0){
-			if (speed < MAX_B_SPEED) speed = MAX_B_SPEED;
-			PWMSetDutyCycle(PWM_0, -speed);
-			GPIOOn(A_1);
-			GPIOOff(A_2);
-		}
+		PWMSetDutyRatio(PWM_0, duty, MAX_F_SPEED_FINE);
+		GPIOState(A_1, speed > 0);
+		GPIOState(A_2, speed < 0);
 		break;
 	case MOTOR_2:
-		if(speed == 0){
-			PWMSetDutyCycle(PWM_1, speed);
-			GPIOOff(A_3);
-			GPIOOff(A_4);
-		}
-		if(speed > 0){
-			if (speed > MAX_F_SPEED) speed = MAX_F_SPEED;
-			PWMSetDutyCycle(PWM_1, speed);
-			GPIOOn(A_3);
-			GPIOOff(A_4);
-		}
-		if(speed < 0){
-			if (speed < MAX_B_SPEED) speed = MAX_B_SPEED;
-			PWMSetDutyCycle(PWM_1, -speed);
-			GPIOOn(A_3);
-			GPIOOff(A_4);
-		}
+		PWMSetDutyRatio(PWM_1, duty, MAX_F_SPEED_FINE);
+		GPIOState(A_3, speed > 0);
+		GPIOState(A_4, speed < 0);
 		break;
 	default:
 		err = 1;
@@ -12,6 +12,7 @@
 /*==================[inclusions]=============================================*/
 #include "lcditse0803.h"
 #include "gpio_mcu.h"
+#include "gpio_fast_out_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_BCD_1	GPIO_20
 #define GPIO_BCD_2	GPIO_21
@@ -20,31 +21,37 @@
 #define GPIO_SEL_1	GPIO_19
 #define GPIO_SEL_2	GPIO_18
 #define GPIO_SEL_3	GPIO_9
+#define SEL_1		(1 << 4)	/*!< Bus bits of the SEL lines (after the 4 BCD bits) */
+#define SEL_2		(1 << 5)
+#define SEL_3		(1 << 6)
+#define BCD_OFF		0x0F		/*!< BCD code that blanks a digit */
+#define LCD_SETUP_US	1			/*!< BCD to latch enable setup (CD4543, 3.3 V, with margin) */
+#define LCD_PULSE_US	1			/*!< Latch enable pulse width */
 /*==================[internal data definition]===============================*/
 static uint16_t actual_value = 0; /*variable that saves the value to be shown in the display LCD*/
+static const gpio_t lcd_pins[] = {GPIO_BCD_1, GPIO_BCD_2, GPIO_BCD_3, GPIO_BCD_4, GPIO_SEL_1, GPIO_SEL_2, GPIO_SEL_3};
+static gpio_bus_t lcd_bus = GPIO_BUS_MAX;	/*!< BCD and SEL lines, written at once */
 /*==================[internal functions declaration]=========================*/
 /** @brief Aux function to load a digit to the LCD Display
  *
  */
 bool LcdItsE0803BCDtoPin(uint8_t value){
-	GPIOState(GPIO_BCD_1, (value & (1<<0))>>0);
-	GPIOState(GPIO_BCD_2, (value & (1<<1))>>1);
-	GPIOState(GPIO_BCD_3, (value & (1<<2))>>2);
-	GPIOState(GPIO_BCD_4, (value & (1<<3))>>3);
+	GPIOBusWriteMasked(lcd_bus, 0x0F, value);
 	return true;
 }
 /*==================[external functions definition]==========================*/
 bool LcdItsE0803Init(void){
-	/* Configuration of pins of data*/
-	GPIOInit(GPIO_BCD_1, GPIO_OUTPUT);
-	GPIOInit(GPIO_BCD_2, GPIO_OUTPUT);
-	GPIOInit(GPIO_BCD_3, GPIO_OUTPUT);
-	GPIOInit(GPIO_BCD_4, GPIO_OUTPUT);
-
-	/* Configuration of pins of control*/
-	GPIOInit(GPIO_SEL_1, GPIO_OUTPUT);
-	GPIOInit(GPIO_SEL_2, GPIO_OUTPUT);
-	GPIOInit(GPIO_SEL_3, GPIO_OUTPUT);
+	/* Configuration of pins of data and control */
+	gpio_bus_config_t bus_config = {
+		.pins = lcd_pins,
+		.pin_qty = sizeof(lcd_pins) / sizeof(lcd_pins[0]),
+		.strobe = SEL_1 | SEL_2 | SEL_3,
+		.setup_us = LCD_SETUP_US,
+		.pulse_us = LCD_PULSE_US,
+	};
+	if(!GPIOBusInit(&bus_config, &lcd_bus)){
+		return false;
+	}
 
 	actual_value=0;
 	LcdItsE0803Write(actual_value);
@@ -60,20 +67,10 @@ bool LcdItsE0803Write(uint16_t value) {
 		tens = (value-(hundreds*100))/10;
 		units = (value-(hundreds*100)-(tens*10));
 
-		/* Write hundreds */
-		LcdItsE0803BCDtoPin(hundreds);
-		GPIOOn(GPIO_SEL_1);
-		GPIOOff(GPIO_SEL_1);
-
-		/* Write tens */
-		LcdItsE0803BCDtoPin(tens);
-		GPIOOn(GPIO_SEL_2);
-		GPIOOff(GPIO_SEL_2);
-
-		/* Write units */
-		LcdItsE0803BCDtoPin(units);
-		GPIOOn(GPIO_SEL_3);
-		GPIOOff(GPIO_SEL_3);
+		/* Write hundreds, tens and units */
+		GPIOBusStrobe(lcd_bus, hundreds, SEL_1);
+		GPIOBusStrobe(lcd_bus, tens, SEL_2);
+		GPIOBusStrobe(lcd_bus, units, SEL_3);
 		return true; /* return 1 for values lower than 999 */
 	}
 	else
@@ -85,20 +82,13 @@ uint16_t LcdItsE0803Read(void){
 }
 
 void LcdItsE0803Off(void){
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_1);
-	GPIOOff(GPIO_SEL_1);
-
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_2);
-	GPIOOff(GPIO_SEL_2);
-
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_3);
-	GPIOOff(GPIO_SEL_3);
+	GPIOBusStrobe(lcd_bus, BCD_OFF, SEL_1);
+	GPIOBusStrobe(lcd_bus, BCD_OFF, SEL_2);
+	GPIOBusStrobe(lcd_bus, BCD_OFF, SEL_3);
 }
 
 bool LcdItsE0803DeInit(void){
+	GPIOBusDeinit(lcd_bus);
 	GPIODeinit();
 	return true;
 }
@@ -12,15 +12,19 @@
 /*==================[inclusions]=============================================*/
 #include "led.h"
 #include "gpio_mcu.h"
+#include "gpio_fast_out_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_LED1 GPIO_11
 #define GPIO_LED2 GPIO_10
 #define GPIO_LED3 GPIO_5
+#define LEDS_ALL (LED_1 | LED_2 | LED_3)
 /*==================[internal data declaration]==============================*/
+static gpio_bus_t leds_bus = GPIO_BUS_MAX;	/*!< Bus bits match led_t values */
 
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
+static const gpio_t leds_pins[] = {GPIO_LED3, GPIO_LED2, GPIO_LED1};
 
 /*==================[external data definition]===============================*/
 
@@ -29,91 +33,47 @@
 /*==================[external functions definition]==========================*/
 
 uint8_t LedsInit(void){
-	/** Configuration of the GPIO */
-	GPIOInit(GPIO_LED1, GPIO_OUTPUT);
-	GPIOInit(GPIO_LED2, GPIO_OUTPUT);
-	GPIOInit(GPIO_LED3, GPIO_OUTPUT);
-
-	/** Turn off leds*/
-	GPIOOff(GPIO_LED1);
-	GPIOOff(GPIO_LED2);
-	GPIOOff(GPIO_LED3);
-
-	return true;
+	/** Configuration of the GPIO (leds are turned off) */
+	gpio_bus_config_t bus_config = {
+		.pins = leds_pins,
+		.pin_qty = sizeof(leds_pins) / sizeof(leds_pins[0]),
+		.strobe = 0,
+	};
+	return GPIOBusInit(&bus_config, &leds_bus);
 }
 
 /** \brief Function to turn on a specific led */
 uint8_t LedOn(led_t led){
-	uint8_t result = false;
-	switch (led){
-	case LED_1:
-		GPIOOn(GPIO_LED1);
-		result = true;
-		break;
-	case LED_2:
-		GPIOOn(GPIO_LED2);
-		result = true;
-		break;
-	case LED_3:
-		GPIOOn(GPIO_LED3);
-		result = true;
-		break;
+	if((led & LEDS_ALL) == 0){
+		return false;
 	}
-	return result;
+	GPIOBusWriteMasked(leds_bus, led, led);
+	return true;
 }
 
 uint8_t LedOff(led_t led){
-	uint8_t result = false;
-	switch (led){
-	case LED_1:
-		GPIOOff(GPIO_LED1);
-		result = true;
-		break;
-	case LED_2:
-		GPIOOff(GPIO_LED2);
-		result = true;
-		break;
-	case LED_3:
-		GPIOOff(GPIO_LED3);
-		result = true;
-		break;
+	if((led & LEDS_ALL) == 0){
+		return false;
 	}
-	return result;
+	GPIOBusWriteMasked(leds_bus, led, 0);
+	return true;
 }
 
 uint8_t LedToggle(led_t led){
-	uint8_t result = false;
-
-	switch (led){
-	case LED_1:
-		GPIOToggle(GPIO_LED1);
-		result = true;
-		break;
-	case LED_2:
-		GPIOToggle(GPIO_LED2);
-		result = true;
-		break;
-	case LED_3:
-		GPIOToggle(GPIO_LED3);
-		result = true;
-		break;
+	if((led & LEDS_ALL) == 0){
+		return false;
 	}
-
-	return result;
+	GPIOBusWriteMasked(leds_bus, led, ~GPIOBusRead(leds_bus));
+	return true;
 }
 
 uint8_t LedsOffAll(void){
-	GPIOOff(GPIO_LED1);
-	GPIOOff(GPIO_LED2);
-	GPIOOff(GPIO_LED3);
-	
+	GPIOBusWrite(leds_bus, 0);
 	return true;
 }
 
 uint8_t LedsMask(uint8_t mask){
-	GPIOState(GPIO_LED1, (mask & LED_1) >> 2);
-	GPIOState(GPIO_LED2, (mask & LED_2) >> 1);
-	GPIOState(GPIO_LED3, (mask & LED_3));
+	GPIOBusWrite(leds_bus, mask);
 	return true;
 }
 
@@ -0,0 +1,213 @@
+/**
+ * @file motor_control.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "motor_control.h"
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+/*==================[macros and definitions]=================================*/
+#define US_PER_S			1000000
+#define Q16_SHIFT			16
+#define OUT_MAX_Q16			((int64_t)MOTOR_CONTROL_OUT_MAX << Q16_SHIFT)
+#define CONTROL_TASK_STACK	2048
+#define CONTROL_TASK_PRIO	15		/*!< Above application and UART tasks */
+/*==================[internal data declaration]==============================*/
+static TaskHandle_t control_task_handle = NULL;
+static motor_control_config_t cfg;
+static portMUX_TYPE control_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static volatile int32_t setpoint = 0;		/*!< Desired speed */
+static volatile bool reset_integral = false;	/*!< Clear integral term on next iteration */
+static int64_t integral_q16 = 0;			/*!< Integral term (Q16, ‰) */
+static int32_t prev_feedback = 0;			/*!< Feedback of the previous iteration */
+static int64_t output_q16 = 0;				/*!< Slew limited output (Q16, ‰) */
+static int64_t slew_step_q16 = 0;			/*!< Max output change per iteration (0: no limit) */
+static volatile int16_t output = 0;			/*!< Last output applied (‰) */
+
+static motor_control_stats_t stats;
+static uint64_t exec_sum = 0;				/*!< Sum of execution times (for mean) */
+static int64_t last_iteration_us = 0;		/*!< Start of the previous iteration */
+/*==================[internal functions declaration]=========================*/
+static void motor_control_isr(void *param);
+static void motor_control_task(void *param);
+static int32_t motor_control_step(void);
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void motor_control_isr(void *param){
+	vTaskNotifyGiveFromISR(control_task_handle, pdFALSE);
+}
+
+/**
+ * @brief One iteration of the PID + feed-forward controller.
+ *
+ * @return int32_t new output (‰)
+ */
+static int32_t motor_control_step(void){
+	int32_t sp = setpoint;
+	int32_t fb = cfg.feedback_func();
+	int64_t error = (int64_t)sp - fb;
+
+	if(reset_integral){
+		reset_integral = false;
+		integral_q16 = 0;
+	}
+
+	/* Derivative on measurement: no kick on setpoint changes */
+	int64_t derivative = -((int64_t)fb - prev_feedback);
+	prev_feedback = fb;
+
+	int64_t p_ff = (int64_t)cfg.kp * error + (int64_t)cfg.kd * derivative + (int64_t)cfg.kff * sp;
+	int64_t target = p_ff + integral_q16;
+
+	/* Anti-windup: integrate only if not pushing further into saturation */
+	int64_t integral_new = integral_q16 + (int64_t)cfg.ki * error;
+	if(!((target >= OUT_MAX_Q16) && (error > 0)) && !((target <= -OUT_MAX_Q16) && (error < 0))){
+		integral_q16 = integral_new;
+		if(integral_q16 > OUT_MAX_Q16) integral_q16 = OUT_MAX_Q16;
+		if(integral_q16 < -OUT_MAX_Q16) integral_q16 = -OUT_MAX_Q16;
+		target = p_ff + integral_q16;
+	}
+	if(target > OUT_MAX_Q16) target = OUT_MAX_Q16;
+	if(target < -OUT_MAX_Q16) target = -OUT_MAX_Q16;
+
+	/* Slew rate limit */
+	if(slew_step_q16 > 0){
+		int64_t delta = target - output_q16;
+		if(delta > slew_step_q16) delta = slew_step_q16;
+		if(delta < -slew_step_q16) delta = -slew_step_q16;
+		output_q16 += delta;
+	} else{
+		output_q16 = target;
+	}
+
+	return (int32_t)(output_q16 >> Q16_SHIFT);
+}
+
+static void motor_control_task(void *param){
+	uint32_t pending;
+	int64_t start, end;
+	uint32_t exec, period;
+	int32_t out;
+	int32_t last_out = 0;
+
+	while(true){
+		pending = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		start = esp_timer_get_time();
+
+		out = motor_control_step();
+		output = out;
+		if(out != last_out){
+			L293SetSpeedFine(cfg.motor, out);
+			last_out = out;
+		}
+
+		end = esp_timer_get_time();
+		exec = end - start;
+		portENTER_CRITICAL(&control_mux);
+		if(stats.iterations > 0){
+			period = start - last_iteration_us;
+			if(period < stats.period_min) stats.period_min = period;
+			if(period > stats.period_max) stats.period_max = period;
+		}
+		last_iteration_us = start;
+		stats.iterations++;
+		stats.overruns += pending - 1;
+		if(exec < stats.exec_min) stats.exec_min = exec;
+		if(exec > stats.exec_max) stats.exec_max = exec;
+		exec_sum += exec;
+		portEXIT_CRITICAL(&control_mux);
+	}
+}
+
+/*==================[external functions definition]==========================*/
+bool MotorControlInit(motor_control_config_t *config){
+	if(config->feedback_func == NULL){
+		return false;
+	}
+	cfg = *config;
+	if(cfg.rate_hz == 0){
+		cfg.rate_hz = MOTOR_CONTROL_DEFAULT_HZ;
+	}
+	slew_step_q16 = ((int64_t)cfg.slew_permille_s << Q16_SHIFT) / cfg.rate_hz;
+	setpoint = 0;
+	integral_q16 = 0;
+	output_q16 = 0;
+	output = 0;
+	prev_feedback = cfg.feedback_func();
+	MotorControlResetStats();
+
+	if(xTaskCreate(motor_control_task, "motor_control", CONTROL_TASK_STACK, NULL,
+			CONTROL_TASK_PRIO, &control_task_handle) != pdPASS){
+		return false;
+	}
+	timer_config_t timer_cfg = {
+		.timer = cfg.timer,
+		.period = US_PER_S / cfg.rate_hz,
+		.func_p = motor_control_isr,
+		.param_p = NULL
+	};
+	TimerInit(&timer_cfg);
+	TimerStart(cfg.timer);
+
+	return true;
+}
+
+void MotorControlSetSpeed(int32_t speed){
+	setpoint = speed;
+}
+
+void MotorControlBrake(void){
+	setpoint = 0;
+	reset_integral = true;
+}
+
+int16_t MotorControlGetOutput(void){
+	return output;
+}
+
+void MotorControlGetStats(motor_control_stats_t *data){
+	portENTER_CRITICAL(&control_mux);
+	*data = stats;
+	if(stats.iterations > 0){
+		data->exec_avg = exec_sum / stats.iterations;
+	}
+	portEXIT_CRITICAL(&control_mux);
+}
+
+void MotorControlResetStats(void){
+	portENTER_CRITICAL(&control_mux);
+	stats.iterations = 0;
+	stats.overruns = 0;
+	stats.exec_min = UINT32_MAX;
+	stats.exec_max = 0;
+	stats.exec_avg = 0;
+	stats.period_min = UINT32_MAX;
+	stats.period_max = 0;
+	exec_sum = 0;
+	portEXIT_CRITICAL(&control_mux);
+}
+
+bool MotorControlDeinit(void){
+	TimerDeinit(cfg.timer);
+	if(control_task_handle != NULL){
+		vTaskDelete(control_task_handle);
+		control_task_handle = NULL;
+	}
+	L293SetSpeed(cfg.motor, 0);
+	return true;
+}
+
+/*==================[end of file]============================================*/
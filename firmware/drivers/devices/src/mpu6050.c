@@ -17,8 +17,9 @@
 #define I2C_NUM I2C_NUM_0
 
 /*==================[internal data definition]===============================*/
-uint8_t devAddr;
-uint8_t buffer[14];
+static uint8_t devAddr;
+static uint8_t buffer[14];
+static uint32_t fifo_period_us = 1000;     /*!< Sample period set by MPU6050_setupFIFOMotion6() */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[external functions definition]==========================*/
@@ -2739,6 +2740,83 @@ void MPU6050_getFIFOBytes(uint8_t *data, uint8_t length) {
 void MPU6050_setFIFOByte(uint8_t data) {
     I2C_writeByte(devAddr, MPU6050_RA_FIFO_R_W, data);
 }
+/** Configure the FIFO buffer for accelerometer and gyroscope samples.
+ * @param rate_hz Sample rate (4 to 1000 Hz)
+ * @return Actual sample rate (Hz)
+ * @see getFIFOMotion6()
+ */
+uint16_t MPU6050_setupFIFOMotion6(uint16_t rate_hz) {
+    uint16_t divider;
+    if (rate_hz < 4) {
+        rate_hz = 4;
+    } else if (rate_hz > 1000) {
+        rate_hz = 1000;
+    }
+    divider = 1000 / rate_hz;
+    // With the DLPF enabled the gyroscope output rate is 1 kHz
+    if (rate_hz >= 200) {
+        MPU6050_setDLPFMode(MPU6050_DLPF_BW_98);
+    } else if (rate_hz >= 100) {
+        MPU6050_setDLPFMode(MPU6050_DLPF_BW_42);
+    } else {
+        MPU6050_setDLPFMode(MPU6050_DLPF_BW_20);
+    }
+    MPU6050_setRate(divider - 1);
+    MPU6050_setFIFOEnabled(false);
+    MPU6050_setTempFIFOEnabled(false);
+    MPU6050_setAccelFIFOEnabled(true);
+    MPU6050_setXGyroFIFOEnabled(true);
+    MPU6050_setYGyroFIFOEnabled(true);
+    MPU6050_setZGyroFIFOEnabled(true);
+    MPU6050_resetFIFO();
+    MPU6050_setFIFOEnabled(true);
+    fifo_period_us = 1000 * divider;
+    return 1000 / divider;
+}
+/** Read the accelerometer and gyroscope samples stored in the FIFO buffer.
+ * @param samples Array for 6 values per sample
+ * @param max Max number of samples to read
+ * @param stamp Time of the samples read (NULL if not needed)
+ * @return Number of samples read
+ * @see setupFIFOMotion6()
+ */
+uint16_t MPU6050_getFIFOMotion6(int16_t *samples, uint16_t max, timestamp_block_t *stamp) {
+    // Up to 21 samples per I2C transfer
+    uint8_t data[21 * MPU6050_MOTION6_BYTES];
+    uint16_t count = MPU6050_getFIFOCount();
+    uint64_t now = TimestampGet();
+    uint16_t qty, chunk, read = 0;
+    if (count >= MPU6050_FIFO_SIZE) {
+        // Overflow: the oldest bytes were overwritten, samples are misaligned
+        MPU6050_setFIFOEnabled(false);
+        MPU6050_resetFIFO();
+        MPU6050_setFIFOEnabled(true);
+        if (stamp != NULL) {
+            TimestampBlock(stamp, now, 0, fifo_period_us);
+        }
+        return 0;
+    }
+    qty = count / MPU6050_MOTION6_BYTES;
+    if (qty > max) {
+        qty = max;
+    }
+    if (stamp != NULL) {
+        // The samples left in the FIFO are newer than the last one read
+        TimestampBlock(stamp, now - (uint64_t)(count / MPU6050_MOTION6_BYTES - qty) * fifo_period_us, qty, fifo_period_us);
+    }
+    while (read < qty) {
+        chunk = qty - read;
+        if (chunk > sizeof(data) / MPU6050_MOTION6_BYTES) {
+            chunk = sizeof(data) / MPU6050_MOTION6_BYTES;
+        }
+        MPU6050_getFIFOBytes(data, chunk * MPU6050_MOTION6_BYTES);
+        for (uint16_t i = 0; i < chunk * MPU6050_MOTION6_BYTES; i += 2) {
+            *samples++ = (((int16_t)data[i]) << 8) | data[i + 1];
+        }
+        read += chunk;
+    }
+    return read;
+}
 
 // WHO_AM_I register
 
@@ -11,7 +11,11 @@
 
 /*==================[inclusions]=============================================*/
 #include "neopixel_stripe.h"
+#include <stdlib.h>
 #include "ws2812b.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
 /*==================[macros and definitions]=================================*/
 #define RED_MSK         0x00FF0000
 #define GREEN_MSK       0x0000FF00
@@ -21,27 +25,161 @@
 #define BLUE_OFFSET     0
 #define MAX_BRIGHT  	255
 #define BRIGHT_OFFSET   8
+#define LUT_SIZE        256
+#define HUE_LUT_OFFSET  8       /*!< 16 bits hue to LUT index */
+#define HUE_ACC_OFFSET  24      /*!< 16.16 hue to LUT index */
+#define US_PER_S        1000000
+#define FRAME_TASK_STACK 2048
+#define FRAME_TASK_PRIO 4
 /*==================[internal data declaration]==============================*/
 uint16_t stripe_length;
 uint8_t stripe_bright = MAX_BRIGHT;
-neopixel_color_t *stripe_colors; 
+neopixel_color_t *stripe_colors;                /*!< Back buffer (written by setters) */
+static uint16_t stripe_offset = 0;              /*!< Ring offset of pixel 0 in stripe_colors */
+static const neopixel_color_t *array_colors = NULL; /*!< Array shown by NeoPixelSetArray() (NULL: back buffer) */
+static uint8_t level_lut[LUT_SIZE];             /*!< Brightness + gamma for each color level */
+static neopixel_color_t hue_lut[LUT_SIZE];      /*!< Color wheel for the last sat/val used */
+static int16_t hue_lut_sat = -1, hue_lut_val = -1;
+static rgb_led_t *front_buffer = NULL;          /*!< Frame being sent */
+static volatile bool frame_dirty = false;       /*!< Back buffer changed since last frame */
+static volatile bool frame_blank = false;       /*!< Next frame is all off */
+static TaskHandle_t frame_task_handle = NULL;
+static volatile bool frame_exit = false;        /*!< Frame task must end */
+static volatile bool frame_task_done = false;   /*!< Frame task ended (front buffer no longer used) */
+static esp_timer_handle_t frame_timer = NULL;
+static portMUX_TYPE stripe_mux = portMUX_INITIALIZER_UNLOCKED;
 /*==================[internal functions declaration]=========================*/
-
+static void neopixel_update(void);
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Index in stripe_colors of a pixel in the stripe.
+ */
+static inline uint16_t neopixel_index(uint16_t pixel){
+	uint32_t index = (uint32_t)pixel + stripe_offset;
+	return (index >= stripe_length) ? index - stripe_length : index;
+}
+
+/**
+ * @brief Precomputes brightness and gamma correction for the 256 color levels.
+ */
+static void neopixel_build_level_lut(void){
+	for(uint16_t i = 0; i < LUT_SIZE; i++){
+		level_lut[i] = ws2812bGammaCorrection((i * stripe_bright) >> BRIGHT_OFFSET);
+	}
+}
+
+static inline rgb_led_t neopixel_to_led(neopixel_color_t color){
+	rgb_led_t led;
+	led.red = level_lut[(color & RED_MSK) >> RED_OFFSET];
+	led.green = level_lut[(color & GREEN_MSK) >> GREEN_OFFSET];
+	led.blue = level_lut[(color & BLUE_MSK) >> BLUE_OFFSET];
+	return led;
+}
+
+/**
+ * @brief Color shown in a pixel: from the array of NeoPixelSetArray() or the back buffer.
+ */
+static inline neopixel_color_t neopixel_shown(uint16_t pixel, uint16_t index){
+	return (array_colors != NULL) ? array_colors[pixel] : stripe_colors[index];
+}
+
+/**
+ * @brief Sends the back buffer to the stripe.
+ */
+static void neopixel_send(void){
+	uint16_t index = stripe_offset;
+	ws2812bSendRet();
+	ws2812bSendRet();
+	ws2812bSendRet();
+	for(uint16_t i = 0; i < stripe_length; i++){
+		ws2812bSendRaw(neopixel_to_led(neopixel_shown(i, index)));
+		if(++index >= stripe_length){
+			index = 0;
+		}
+	}
+	ws2812bSendRet();
+}
+
+/**
+ * @brief Copies the back buffer to the front buffer and sends it to the stripe.
+ */
+static void neopixel_send_frame(void){
+	uint16_t index;
+	portENTER_CRITICAL(&stripe_mux);
+	index = stripe_offset;
+	for(uint16_t i = 0; i < stripe_length; i++){
+		if(frame_blank){
+			front_buffer[i].red = front_buffer[i].green = front_buffer[i].blue = 0;
+		} else{
+			front_buffer[i] = neopixel_to_led(neopixel_shown(i, index));
+		}
+		if(++index >= stripe_length){
+			index = 0;
+		}
+	}
+	frame_dirty = false;
+	portEXIT_CRITICAL(&stripe_mux);
+
+	ws2812bSendRet();
+	ws2812bSendRet();
+	ws2812bSendRet();
+	for(uint16_t i = 0; i < stripe_length; i++){
+		ws2812bSendRaw(front_buffer[i]);
+	}
+	ws2812bSendRet();
+}
+
+/**
+ * @brief Called after every change: sends the stripe now, or marks it
+ * to be sent in the next frame (frame mode).
+ */
+static void neopixel_update(void){
+	if(frame_task_handle != NULL){
+		frame_dirty = true;
+	} else{
+		neopixel_send();
+	}
+}
+
+static void neopixel_frame_timer(void *param){
+	xTaskNotifyGive(frame_task_handle);
+}
+
+static void neopixel_frame_task(void *param){
+	while(true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if(frame_exit){
+			break;
+		}
+		if(frame_dirty){
+			neopixel_send_frame();
+		}
+	}
+	/* Only ends between frames, NeoPixelFrameStop() frees the front buffer */
+	frame_task_done = true;
+	vTaskDelete(NULL);
+}
 
 /*==================[external functions definition]==========================*/
 
 void NeoPixelInit(gpio_t pin, uint16_t len, neopixel_color_t *color_array){
     stripe_length = len;
 	stripe_colors = color_array;
+	stripe_offset = 0;
+	neopixel_build_level_lut();
     ws2812bInit(pin);
 }
 
 void NeoPixelAllOff(void){
+	if(frame_task_handle != NULL){
+		frame_blank = true;
+		frame_dirty = true;
+		return;
+	}
     rgb_led_t led;
 	ws2812bSendRet();
 	ws2812bSendRet();
@@ -50,72 +188,152 @@ void NeoPixelAllOff(void){
 		led.red = 0;
 		led.green = 0;
 		led.blue = 0;
-		ws2812bSend(led);
+		ws2812bSendRaw(led);
 	}
 	ws2812bSendRet();
 }
 
 void NeoPixelAllColor(neopixel_color_t color){
+	portENTER_CRITICAL(&stripe_mux);
 	for (uint16_t i = 0; i < stripe_length; i++){
 		stripe_colors[i] = color;
 	}
-	NeoPixelSetArray(stripe_colors);
+	array_colors = NULL;
+	frame_blank = false;
+	portEXIT_CRITICAL(&stripe_mux);
+	neopixel_update();
 }
 
 void NeoPixelSetPixel(uint16_t pixel, neopixel_color_t color){
-	stripe_colors[pixel] = color;
-	NeoPixelSetArray(stripe_colors);
+	if(pixel >= stripe_length){
+		return;
+	}
+	portENTER_CRITICAL(&stripe_mux);
+	stripe_colors[neopixel_index(pixel)] = color;
+	array_colors = NULL;
+	frame_blank = false;
+	portEXIT_CRITICAL(&stripe_mux);
+	neopixel_update();
 }
 
-void NeoPixelSetArray(neopixel_color_t *color_array){
-    rgb_led_t led;
-	uint16_t red, green, blue;
-	ws2812bSendRet();
-	ws2812bSendRet();
-	ws2812bSendRet();
-	for (uint16_t i = 0; i < stripe_length; i++){
-		red = ((color_array[i] & RED_MSK) >> RED_OFFSET) * stripe_bright;
-		green = ((color_array[i] & GREEN_MSK) >> GREEN_OFFSET) * stripe_bright;
-		blue = ((color_array[i] & BLUE_MSK) >> BLUE_OFFSET) * stripe_bright;
-		led.red = red >> BRIGHT_OFFSET;
-		led.green = green >> BRIGHT_OFFSET;
-		led.blue = blue >> BRIGHT_OFFSET;
-		ws2812bSend(led);
+neopixel_color_t NeoPixelGetPixel(uint16_t pixel){
+	if(pixel >= stripe_length){
+		return 0;
 	}
-	ws2812bSendRet();
+	return stripe_colors[neopixel_index(pixel)];
 }
 
-void NeoPixelShift(bool upwards){
-	neopixel_color_t carry;
+void NeoPixelSetArray(neopixel_color_t *color_array){
+	portENTER_CRITICAL(&stripe_mux);
+	/* The array is shown as is, the one given to NeoPixelInit() is not modified */
+	array_colors = (color_array != stripe_colors) ? color_array : NULL;
+	frame_blank = false;
+	portEXIT_CRITICAL(&stripe_mux);
+	neopixel_update();
+}
 
+void NeoPixelShift(bool upwards){
+	if(stripe_length == 0){
+		return;
+	}
+	portENTER_CRITICAL(&stripe_mux);
+	array_colors = NULL;
 	if(upwards){
-		carry = stripe_colors[stripe_length-1];
-		for (uint16_t i = 0; i < stripe_length-1; i++){
-			stripe_colors[stripe_length-1-i] = stripe_colors[stripe_length-2-i]; 
-		}
-		stripe_colors[0] = carry;
+		stripe_offset = (stripe_offset == 0) ? stripe_length - 1 : stripe_offset - 1;
 	}else{
-		carry = stripe_colors[0];
-		for (uint16_t i = 0; i < stripe_length-1; i++){
-			stripe_colors[i] = stripe_colors[i+1]; 
-		}
-		stripe_colors[stripe_length-1] = carry;
+		stripe_offset = (stripe_offset + 1 >= stripe_length) ? 0 : stripe_offset + 1;
 	}
-	NeoPixelSetArray(stripe_colors);
+	portEXIT_CRITICAL(&stripe_mux);
+	neopixel_update();
 }
 
 void NeoPixelBrightness(uint8_t bright){
+	portENTER_CRITICAL(&stripe_mux);
 	stripe_bright = bright;
-	NeoPixelSetArray(stripe_colors);
+	neopixel_build_level_lut();
+	portEXIT_CRITICAL(&stripe_mux);
+	neopixel_update();
 }
 
 void NeoPixelRainbow(uint16_t first_hue, uint8_t sat, uint8_t val, uint8_t reps){
+	if(stripe_length == 0){
+		return;
+	}
+	if((sat != hue_lut_sat) || (val != hue_lut_val)){
+		for(uint16_t i = 0; i < LUT_SIZE; i++){
+			hue_lut[i] = NeoPixelHSV2Color(i << HUE_LUT_OFFSET, sat, val);
+		}
+		hue_lut_sat = sat;
+		hue_lut_val = val;
+	}
+	/* Hue of each pixel in 16.16 fixed point, accumulated instead of divided per pixel */
+	uint32_t hue_step = ((uint64_t)reps << 32) / stripe_length;
+	uint32_t hue = (uint32_t)first_hue << 16;
+	uint16_t index = stripe_offset;
+	portENTER_CRITICAL(&stripe_mux);
 	for (uint16_t i=0; i<stripe_length; i++) {
-		uint16_t hue = first_hue + (i * reps * 65536) / stripe_length;
-		neopixel_color_t color = NeoPixelHSV2Color(hue, sat, val);
-		stripe_colors[i] = color;
+		stripe_colors[index] = hue_lut[hue >> HUE_ACC_OFFSET];
+		hue += hue_step;
+		if(++index >= stripe_length){
+			index = 0;
+		}
   	}
-	NeoPixelSetArray(stripe_colors);
+	array_colors = NULL;
+	frame_blank = false;
+	portEXIT_CRITICAL(&stripe_mux);
+	neopixel_update();
+}
+
+bool NeoPixelFrameStart(uint8_t fps){
+	if((fps == 0) || (frame_task_handle != NULL)){
+		return false;
+	}
+	front_buffer = malloc(stripe_length * sizeof(rgb_led_t));
+	if(front_buffer == NULL){
+		return false;
+	}
+	frame_exit = false;
+	frame_task_done = false;
+	if(xTaskCreate(neopixel_frame_task, "neopixel", FRAME_TASK_STACK, NULL,
+			FRAME_TASK_PRIO, &frame_task_handle) != pdPASS){
+		free(front_buffer);
+		front_buffer = NULL;
+		return false;
+	}
+	const esp_timer_create_args_t frame_args = {
+		.callback = neopixel_frame_timer,
+		.name = "neopixel"
+	};
+	if(esp_timer_create(&frame_args, &frame_timer) != ESP_OK){
+		frame_timer = NULL;
+		NeoPixelFrameStop();
+		return false;
+	}
+	frame_dirty = true;
+	if(esp_timer_start_periodic(frame_timer, US_PER_S / fps) != ESP_OK){
+		NeoPixelFrameStop();
+		return false;
+	}
+	return true;
+}
+
+void NeoPixelFrameStop(void){
+	if(frame_timer != NULL){
+		esp_timer_stop(frame_timer);
+		esp_timer_delete(frame_timer);
+		frame_timer = NULL;
+	}
+	if(frame_task_handle != NULL){
+		/* Let the task finish the frame being sent before freeing its buffer */
+		frame_exit = true;
+		xTaskNotifyGive(frame_task_handle);
+		while(!frame_task_done){
+			vTaskDelay(1);
+		}
+		frame_task_handle = NULL;
+	}
+	free(front_buffer);
+	front_buffer = NULL;
 }
 
 neopixel_color_t NeoPixelRgb2Color(uint8_t red, uint8_t green, uint8_t blue){
@@ -6,10 +6,11 @@
 #define SERVO_FREQ 	50
 #define MIN_ANG		-90
 #define MAX_ANG		90
-#define ANG_RANGE	180.0
-#define PERIOD_MS   20.0
-#define PULSEW_MS   1.0
-#define PERCENT   	100.0
+#define PERIOD_US   20000	/* PWM period (us) */
+#define CENTER_US   1500	/* Pulse width at 0 degrees (us) */
+#define US_PER_DEG_NUM	100	/* Pulse width change per degree (100/9 us), */
+#define US_PER_DEG_DEN	9	/* adjusted (angle x 2) for the available servos */
+#define SERVO_QTY	4
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
@@ -19,14 +20,13 @@
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
-uint8_t Angle2DutyCicle(int8_t angle){
-	static float h_time;
-	static float duty_cicle;
-	static int16_t deg;
-	deg = 2 * angle + MAX_ANG;	// NOTE: adjusted (angle x 2) for the available servos
-	h_time = (float)(deg/ANG_RANGE) + PULSEW_MS;
-	duty_cicle = (float)(h_time/PERIOD_MS) * PERCENT;
-	return (uint8_t) duty_cicle;
+static uint32_t Angle2PulseUs(int8_t angle){
+	if(angle < MIN_ANG){
+		angle = MIN_ANG;
+	} else if(angle > MAX_ANG){
+		angle = MAX_ANG;
+	}
+	return CENTER_US + ((int32_t)angle * US_PER_DEG_NUM) / US_PER_DEG_DEN;
 }
 /*==================[external functions definition]==========================*/
 
@@ -49,27 +49,20 @@ uint8_t ServoInit(servo_out_t servo, gpio_t gpio){
 }
 
 void ServoMove(servo_out_t servo, int8_t ang){
-	static uint8_t dc;
-	if(ang < MIN_ANG){
-		ang = MIN_ANG;
-	} else if(ang > MAX_ANG){
-		ang = MAX_ANG;
+	PWMSetDutyRatio((pwm_out_t)servo, Angle2PulseUs(ang), PERIOD_US);
+}
+
+void ServoMoveMulti(const servo_out_t *servos, const int8_t *angs, uint8_t qty){
+	pwm_duty_t duties[SERVO_QTY];
+	uint8_t i;
+	if(qty > SERVO_QTY){
+		qty = SERVO_QTY;
 	}
-	dc = Angle2DutyCicle(ang);
-	switch(servo){
-		case SERVO_0:
-			PWMSetDutyCycle(PWM_0, dc);
-			break;
-		case SERVO_1:
-			PWMSetDutyCycle(PWM_1, dc);
-			break;
-		case SERVO_2:
-			PWMSetDutyCycle(PWM_2, dc);
-			break;
-		case SERVO_3:
-			PWMSetDutyCycle(PWM_3, dc);
-			break;
+	for(i = 0; i < qty; i++){
+		duties[i].out = (pwm_out_t)servos[i];
+		duties[i].duty = ((uint64_t)Angle2PulseUs(angs[i]) * PWMGetMaxDuty(duties[i].out)) / PERIOD_US;
 	}
+	PWMSetDutyMulti(duties, qty);
 }
 
 /*==================[end of file]============================================*/
@@ -12,10 +12,34 @@
 /*==================[inclusions]=============================================*/
 #include "switch.h"
 #include "gpio_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_SWITCH1 GPIO_4
 #define GPIO_SWITCH2 GPIO_15
+#define DEBOUNCE_TICKS	2			/*!< Samples with the new level to accept a change */
+#define US_PER_MS		1000
+/**
+ * @brief Key state for the event service
+ */
+typedef struct {
+	gpio_t pin;
+	uint8_t id;					/*!< Bit used in the events */
+	bool pressed;				/*!< Debounced state */
+	uint8_t count;				/*!< Consecutive samples different from the debounced state */
+	bool long_sent;
+	int64_t press_ms;			/*!< Time of the last press */
+	int64_t click_ms;			/*!< Release time of the last short click (-1: none) */
+} key_state_t;
 /*==================[internal data declaration]==============================*/
+static key_state_t keys[SWITCH_KEYS_MAX];
+static uint8_t key_qty = 0;
+static uint8_t next_id = SWITCH_2 << 1;		/*!< Identifier of the next added key */
+static switch_events_config_t events_cfg;
+static QueueHandle_t events_queue = NULL;
+static esp_timer_handle_t debounce_timer = NULL;
+static volatile bool debounce_running = false;
 
 /*==================[internal functions declaration]=========================*/
 
@@ -24,6 +48,101 @@
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Falling edge of any key: hand over to the debounce timer until all
+ * keys are released again
+ */
+static void IRAM_ATTR switch_edge_isr(void *param){
+	for(uint8_t i = 0; i < key_qty; i++){
+		GPIOIntDisable(keys[i].pin);
+	}
+	if(!debounce_running){
+		debounce_running = true;
+		esp_timer_start_periodic(debounce_timer, SWITCH_TICK_MS * US_PER_MS);
+	}
+}
+
+static void switch_send(key_state_t *key, switch_event_type_t type, uint32_t time_ms){
+	switch_event_t event = {
+		.key = key->id,
+		.type = type,
+		.time_ms = time_ms,
+	};
+	xQueueSend(events_queue, &event, 0);
+}
+
+/**
+ * @brief Debounce state machine, runs every SWITCH_TICK_MS while a key is 
+ * pressed or bouncing
+ */
+static void switch_debounce_tick(void *param){
+	int64_t now = esp_timer_get_time() / US_PER_MS;
+	bool idle = true;
+	for(uint8_t i = 0; i < key_qty; i++){
+		key_state_t *key = &keys[i];
+		bool level_pressed = !GPIORead(key->pin);
+		if(level_pressed != key->pressed){
+			if(++key->count >= DEBOUNCE_TICKS){
+				key->count = 0;
+				key->pressed = level_pressed;
+				if(level_pressed){
+					key->press_ms = now;
+					key->long_sent = false;
+					switch_send(key, SWITCH_PRESS, 0);
+					if((key->click_ms >= 0) && (now - key->click_ms <= events_cfg.double_ms)){
+						key->click_ms = -1;
+						switch_send(key, SWITCH_DOUBLE_CLICK, 0);
+					}
+				} else {
+					switch_send(key, SWITCH_RELEASE, now - key->press_ms);
+					key->click_ms = (events_cfg.double_ms && !key->long_sent) ? now : -1;
+				}
+			}
+		} else {
+			key->count = 0;
+		}
+		if(key->pressed && !key->long_sent && events_cfg.long_ms && (now - key->press_ms >= events_cfg.long_ms)){
+			key->long_sent = true;
+			switch_send(key, SWITCH_LONG_PRESS, now - key->press_ms);
+		}
+		if(key->pressed || key->count){
+			idle = false;
+		}
+	}
+	if(idle){
+		// back to edge interrupts (no CPU use while keys are released)
+		esp_timer_stop(debounce_timer);
+		debounce_running = false;
+		for(uint8_t i = 0; i < key_qty; i++){
+			GPIOIntEnable(keys[i].pin);
+		}
+		// a press between the last sample and the interrupt enable has no edge
+		for(uint8_t i = 0; i < key_qty; i++){
+			if(!GPIORead(keys[i].pin)){
+				switch_edge_isr(NULL);
+				break;
+			}
+		}
+	}
+}
+
+static uint8_t switch_add(gpio_t pin, uint8_t id){
+	if((events_queue == NULL) || (key_qty >= SWITCH_KEYS_MAX) || (id == 0)){
+		return 0;
+	}
+	key_state_t *key = &keys[key_qty];
+	key->pin = pin;
+	key->id = id;
+	key->pressed = false;
+	key->count = 0;
+	key->long_sent = false;
+	key->click_ms = -1;
+	GPIOInit(pin, GPIO_INPUT);
+	GPIOInputFilter(pin);
+	key_qty++;
+	GPIOActivInt(pin, switch_edge_isr, false, NULL);
+	return id;
+}
 
 /*==================[external functions definition]==========================*/
 int8_t SwitchesInit(void){
@@ -54,4 +173,47 @@ void SwitchActivInt(switch_t sw, void *ptr_int_func, void *args){
 		break;
 	}
 }
+
+bool SwitchesEventsInit(const switch_events_config_t *config){
+	if(events_queue != NULL){
+		return false;
+	}
+	events_queue = xQueueCreate(config->queue_len, sizeof(switch_event_t));
+	if(events_queue == NULL){
+		return false;
+	}
+	const esp_timer_create_args_t timer_args = {
+		.callback = switch_debounce_tick,
+		.name = "switch_debounce",
+	};
+	if(esp_timer_create(&timer_args, &debounce_timer) != ESP_OK){
+		vQueueDelete(events_queue);
+		events_queue = NULL;
+		return false;
+	}
+	events_cfg = *config;
+	if(config->switches & SWITCH_1){
+		switch_add(GPIO_SWITCH1, SWITCH_1);
+	}
+	if(config->switches & SWITCH_2){
+		switch_add(GPIO_SWITCH2, SWITCH_2);
+	}
+	return true;
+}
+
+uint8_t SwitchAddKey(gpio_t pin){
+	uint8_t id = switch_add(pin, next_id);
+	if(id){
+		next_id <<= 1;
+	}
+	return id;
+}
+
+bool SwitchGetEvent(switch_event_t *event, uint32_t timeout_ms){
+	TickType_t ticks = (timeout_ms == UINT32_MAX) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+	if(events_queue == NULL){
+		return false;
+	}
+	return xQueueReceive(events_queue, event, ticks) == pdTRUE;
+}
 /*==================[end of file]============================================*/
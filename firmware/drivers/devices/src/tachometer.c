@@ -0,0 +1,228 @@
+/**
+ * @file tachometer.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "tachometer.h"
+#include <stddef.h>
+#include "driver/pulse_cnt.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+/*==================[macros and definitions]=================================*/
+#define US_PER_MIN			60000000ULL	/*!< Microseconds in a minute */
+#define MILLI				1000ULL
+#define PI_X100000			314159ULL	/*!< pi * 100000 */
+#define MAX_GLITCH_NS		12000		/*!< PCNT filter limit (1023 APB cycles) */
+#define COUNT_MIN_EDGES		4			/*!< Below this, period method is used */
+#define STOP_REVS			2			/*!< Stopped after this many revolution periods without edges */
+/*==================[internal data declaration]==============================*/
+static pcnt_unit_handle_t pcnt_unit = NULL;		/*!< Handle for the PCNT unit */
+static pcnt_channel_handle_t pcnt_chan = NULL;	/*!< Handle for the PCNT channel */
+static esp_timer_handle_t window_timer = NULL;	/*!< Handle for the window timer */
+static portMUX_TYPE tacho_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint16_t slots;					/*!< Slots per revolution */
+static uint32_t circumference_um;		/*!< Wheel circumference (in um) */
+static tachometer_func tacho_func_p;	/*!< Pointer to the user callback */
+static void *tacho_param_p;				/*!< User callback parameter */
+
+/* Updated from the PCNT ISR (once per revolution) */
+static volatile uint32_t accum_edges = 0;	/*!< Edges of the completed revolutions */
+static volatile int64_t last_rev_us = 0;	/*!< Time of the last revolution */
+static volatile uint32_t rev_period_us = 0;	/*!< Duration of the last revolution (0: unknown) */
+
+/* Window state (only used from the window timer callback) */
+static uint32_t last_total_edges = 0;	/*!< Edge count at the end of the previous window */
+static int64_t last_window_us = 0;		/*!< Time at the end of the previous window */
+static int64_t last_edge_us = 0;		/*!< Time of the last window with edges */
+
+static tachometer_measure_t measure;	/*!< Last measurement */
+/*==================[internal functions declaration]=========================*/
+static bool IRAM_ATTR tachometer_rev_isr(pcnt_unit_handle_t unit, const pcnt_watch_event_data_t *edata, void *user_ctx);
+static void tachometer_window(void *arg);
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief PCNT watch point callback, called when the count reaches the number of slots
+ * (the hardware clears the count to 0 at that point, so the edges are accumulated here).
+ */
+static bool IRAM_ATTR tachometer_rev_isr(pcnt_unit_handle_t unit, const pcnt_watch_event_data_t *edata, void *user_ctx){
+	int64_t now = esp_timer_get_time();
+	portENTER_CRITICAL_ISR(&tacho_mux);
+	if(accum_edges > 0){
+		rev_period_us = now - last_rev_us;
+	}
+	last_rev_us = now;
+	accum_edges += edata->watch_point_value;
+	portEXIT_CRITICAL_ISR(&tacho_mux);
+	return false;
+}
+
+/**
+ * @brief Window timer callback. Reads the PCNT and computes the new measurement.
+ */
+static void tachometer_window(void *arg){
+	tachometer_measure_t new_measure;
+	uint32_t total_edges, period;
+	int64_t rev_us;
+	int count;
+
+	/* Accumulated edges and current count read with the watch point ISR masked */
+	int64_t now = esp_timer_get_time();
+	portENTER_CRITICAL(&tacho_mux);
+	pcnt_unit_get_count(pcnt_unit, &count);
+	total_edges = accum_edges + (uint32_t)count;
+	rev_us = last_rev_us;
+	period = rev_period_us;
+	portEXIT_CRITICAL(&tacho_mux);
+
+	if((int32_t)(total_edges - last_total_edges) < 0){
+		/* Count cleared at the watch point but its ISR is still pending: the
+		 * revolution is completed, only its accumulation is missing */
+		total_edges += slots;
+	}
+	uint32_t edges = total_edges - last_total_edges;
+	uint32_t elapsed_us = now - last_window_us;
+	last_total_edges = total_edges;
+	last_window_us = now;
+	if(edges > 0){
+		last_edge_us = now;
+	}
+
+	new_measure.edges = edges;
+	new_measure.revolutions = total_edges / slots;
+	if(edges >= COUNT_MIN_EDGES){
+		new_measure.method = TACHOMETER_COUNT;
+		new_measure.rpm_milli = (edges * US_PER_MIN * MILLI) / ((uint64_t)slots * elapsed_us);
+	} else if((period > 0) && ((now - last_edge_us) < (int64_t)STOP_REVS * period)){
+		/* Time since the last revolution is a lower bound of the current period */
+		if((now - rev_us) > period){
+			period = now - rev_us;
+		}
+		new_measure.method = TACHOMETER_PERIOD;
+		new_measure.rpm_milli = (US_PER_MIN * MILLI) / period;
+	} else if(edges > 0){
+		/* Less than two revolutions since start: nothing better than the count */
+		new_measure.method = TACHOMETER_COUNT;
+		new_measure.rpm_milli = (edges * US_PER_MIN * MILLI) / ((uint64_t)slots * elapsed_us);
+	} else{
+		new_measure.method = TACHOMETER_STOPPED;
+		new_measure.rpm_milli = 0;
+	}
+	new_measure.speed_mm_s = ((uint64_t)new_measure.rpm_milli * circumference_um) / (US_PER_MIN);
+
+	portENTER_CRITICAL(&tacho_mux);
+	measure = new_measure;
+	portEXIT_CRITICAL(&tacho_mux);
+
+	if(tacho_func_p != NULL){
+		tacho_func_p(&new_measure, tacho_param_p);
+	}
+}
+
+/*==================[external functions definition]==========================*/
+bool TachometerInit(tachometer_config_t *config){
+	if((config->slots == 0) || (config->window_ms == 0)){
+		return false;
+	}
+	slots = config->slots;
+	circumference_um = ((uint32_t)config->wheel_diameter_mm * PI_X100000) / 100;
+	tacho_func_p = config->func_p;
+	tacho_param_p = config->param_p;
+	accum_edges = 0;
+	rev_period_us = 0;
+	last_total_edges = 0;
+
+	GPIOInit(config->gpio, GPIO_INPUT);
+
+	/* PCNT counts 0..slots-1 and is auto-cleared when reaching slots */
+	pcnt_unit_config_t unit_config = {
+		.high_limit = config->slots,
+		.low_limit = -1,
+	};
+	if(pcnt_new_unit(&unit_config, &pcnt_unit) != ESP_OK){
+		pcnt_unit = NULL;
+		return false;
+	}
+	if(config->glitch_ns > 0){
+		pcnt_glitch_filter_config_t filter_config = {
+			.max_glitch_ns = (config->glitch_ns > MAX_GLITCH_NS) ? MAX_GLITCH_NS : config->glitch_ns,
+		};
+		pcnt_unit_set_glitch_filter(pcnt_unit, &filter_config);
+	}
+	pcnt_chan_config_t chan_config = {
+		.edge_gpio_num = config->gpio,
+		.level_gpio_num = -1,
+	};
+	if(pcnt_new_channel(pcnt_unit, &chan_config, &pcnt_chan) != ESP_OK){
+		TachometerDeinit();
+		return false;
+	}
+	pcnt_channel_set_edge_action(pcnt_chan, PCNT_CHANNEL_EDGE_ACTION_HOLD, PCNT_CHANNEL_EDGE_ACTION_INCREASE);
+	pcnt_unit_add_watch_point(pcnt_unit, config->slots);
+	pcnt_event_callbacks_t cbs = {
+		.on_reach = tachometer_rev_isr,
+	};
+	pcnt_unit_register_event_callbacks(pcnt_unit, &cbs, NULL);
+	if((pcnt_unit_enable(pcnt_unit) != ESP_OK) || (pcnt_unit_clear_count(pcnt_unit) != ESP_OK) ||
+	   (pcnt_unit_start(pcnt_unit) != ESP_OK)){
+		TachometerDeinit();
+		return false;
+	}
+
+	const esp_timer_create_args_t window_args = {
+		.callback = tachometer_window,
+		.name = "tachometer",
+	};
+	if(esp_timer_create(&window_args, &window_timer) != ESP_OK){
+		window_timer = NULL;
+		TachometerDeinit();
+		return false;
+	}
+	last_window_us = esp_timer_get_time();
+	last_edge_us = last_window_us;
+	if(esp_timer_start_periodic(window_timer, (uint64_t)config->window_ms * MILLI) != ESP_OK){
+		TachometerDeinit();
+		return false;
+	}
+
+	return true;
+}
+
+void TachometerRead(tachometer_measure_t *data){
+	portENTER_CRITICAL(&tacho_mux);
+	*data = measure;
+	portEXIT_CRITICAL(&tacho_mux);
+}
+
+bool TachometerDeinit(void){
+	if(window_timer != NULL){
+		esp_timer_stop(window_timer);
+		esp_timer_delete(window_timer);
+		window_timer = NULL;
+	}
+	if(pcnt_unit != NULL){
+		pcnt_unit_stop(pcnt_unit);
+		pcnt_unit_remove_watch_point(pcnt_unit, slots);
+		pcnt_unit_disable(pcnt_unit);
+		if(pcnt_chan != NULL){
+			pcnt_del_channel(pcnt_chan);
+			pcnt_chan = NULL;
+		}
+		pcnt_del_unit(pcnt_unit);
+		pcnt_unit = NULL;
+	}
+	return true;
+}
+
+/*==================[end of file]============================================*/
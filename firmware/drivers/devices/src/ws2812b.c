@@ -368,6 +368,20 @@ void ws2812bSend(rgb_led_t led_color){
     }
 }
 
+void ws2812bSendRaw(rgb_led_t led_color){
+    uint8_t i;
+    uint32_t grb = (led_color.green << 16) | (led_color.red << 8) | led_color.blue;
+    for(i=0; i<24; i++){
+        if(grb & (1UL << 23)){
+            ws2812bSendHigh(pin_number);
+        }
+        else{
+            ws2812bSendLow(pin_number);
+        }
+        grb <<= 1;
+    }
+}
+
 void ws2812bSendRet(void){
     GPIOFastWrite(0);
     DelayUs(RET_CMD);
@@ -14,6 +14,16 @@
  * @note The ESP-EDU have 4 analog inputs and 1 analog output, but the designated pin for 
  * the latter is shared with analog output 0 (CH0).
  *
+ * @note Readings are returned in calibrated mV. The eFuse calibration curve of each
+ * input is tabulated once in AnalogInputInit(), so every conversion is an integer
+ * interpolation (no curve evaluation nor float math). AnalogInputReadOversampled()
+ * and AnalogInputScan() average N samples (ADC_OVERSAMPLE_MIN to ADC_OVERSAMPLE_MAX)
+ * taken by the ADC digital controller at ADC_SCAN_FREQ (DMA, no CPU timing).
+ *
+ * @note The waveform generator (AnalogOutputWaveInit()) plays a sample table on the
+ * DAC from a timer interrupt, with optional linear interpolation between samples.
+ * Tables can be looped or streamed with double buffering (AnalogOutputWaveQueue()).
+ *
  * @author Albano Peñalva
  *
  * @section changelog
@@ -21,11 +31,18 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 24/02/2024 | Document creation		                         						|
+ * | 18/10/2026 | Calibrated mV readings (LUT), oversampling and multi-channel scan		|
+ * | 18/10/2026 | Timer driven waveform generator for the DAC							|
+ * | 18/10/2026 | Single reads report errors, oneshot reads and scans serialized		|
+ * | 18/10/2026 | Timestamps of the scan conversions (timestamp_mcu.h)					|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include "stdbool.h"
+#include "timer_mcu.h"
+#include "timestamp_mcu.h"
 /*==================[macros]=================================================*/
 typedef enum adc_ch {
 	CH0 = 0,				/*!< Channel 0 */
@@ -40,6 +57,13 @@ typedef enum adc_mode {
 } adc_mode_t;
 
 #define DAC	0    			/*!< DAC pin. Override CH0 declaration*/
+
+#define ADC_CH_QTY			4		/*!< Number of analog inputs */
+#define ADC_OVERSAMPLE_MIN	4		/*!< Min samples averaged by oversampled reads */
+#define ADC_OVERSAMPLE_MAX	256		/*!< Max samples averaged by oversampled reads */
+#define ADC_SCAN_FREQ		20000	/*!< Conversions per second in oversampled reads and scans (all channels) */
+#define DAC_WAVE_INTERP_MAX	16		/*!< Max DAC updates per waveform sample (interpolation) */
+#define DAC_WAVE_UPDATE_MAX	50000	/*!< Max DAC updates per second of the waveform generator */
 /*==================[typedef]================================================*/
 /**
  * @brief Analog inputs config structure
@@ -53,6 +77,21 @@ typedef struct {
 	uint16_t sample_frec;	/*!< Sample frequency min: 20kHz - max: 2MHz (only for continuous mode)  */
 } analog_input_config_t;	
 
+/**
+ * @brief DAC waveform generator config structure
+ * 
+ */
+typedef struct {
+	timer_mcu_t timer;		/*!< Timer used to pace the DAC updates (not shared with other tasks) */
+	const uint8_t *samples;	/*!< Sample table (from 0 to 255, as AnalogOutputWrite()) */
+	uint16_t size;			/*!< Number of samples in the table */
+	uint32_t sample_frec;	/*!< Samples per second */
+	uint8_t interp;			/*!< DAC updates per sample, linearly interpolated: 1 (none), 2, 4, 8 or 16 */
+	bool loop;				/*!< Restart the table when it ends and no other buffer is queued */
+	void *func_p;			/*!< Pointer to callback function called (from ISR) when a buffer ends, may be NULL */
+	void *param_p;			/*!< Pointer to callback function parameters */
+} analog_wave_config_t;
+
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -74,11 +113,59 @@ void AnalogOutputInit(void);
 /**
  * @brief Read single channel.
  * 
- * @param channel Channel selected
+ * @param channel Channel selected (initialized in ADC_SINGLE mode)
+ * @param value Read variable pointer (in mV, not modified on failure)
+ * @return true Value read
+ * @return false ADC not initialized or conversion failed
+ */
+bool AnalogInputReadSingle(adc_ch_t channel, uint16_t *value);
+
+/**
+ * @brief Read single channel, without calibration.
+ * 
+ * @note Waits while another task runs AnalogInputScan() / AnalogInputReadOversampled().
+ *
+ * @param channel Channel selected (initialized in ADC_SINGLE mode)
+ * @param value Read variable pointer (ADC counts, 0 to 4095, not modified on failure)
+ * @return true Value read
+ * @return false ADC not initialized or conversion failed
+ */
+bool AnalogInputReadRaw(adc_ch_t channel, uint16_t *value);
+
+/**
+ * @brief Read single channel averaging several samples.
+ * 
+ * @note Takes samples / ADC_SCAN_FREQ seconds (e.g. 3.2 ms for 64 samples).
+ * The average keeps 4 extra bits of resolution until the calibration is applied.
+ * 
+ * @param channel Channel selected (initialized in ADC_SINGLE mode)
+ * @param samples Number of samples averaged (ADC_OVERSAMPLE_MIN to ADC_OVERSAMPLE_MAX)
  * @param value Read variable pointer (in mV)
- * @return null
+ * @return true Value read
+ * @return false Invalid parameters or ADC not available
+ */
+bool AnalogInputReadOversampled(adc_ch_t channel, uint16_t samples, uint16_t *value);
+
+/**
+ * @brief Read several channels in one call, averaging several samples of each.
+ * 
+ * Channels are converted in turns (CH_a, CH_b, ..., CH_a, CH_b, ...), so the 
+ * averages cover the same time interval.
+ * 
+ * @note Takes qty * samples / ADC_SCAN_FREQ seconds. Scans and single reads
+ * from other tasks wait for each other.
+ * 
+ * @param channels Array of channels (initialized in ADC_SINGLE mode, not repeated)
+ * @param qty Number of channels (1 to ADC_CH_QTY)
+ * @param samples Number of samples averaged for each channel (ADC_OVERSAMPLE_MIN to ADC_OVERSAMPLE_MAX)
+ * @param values Array to store the readings (in mV, same order as channels)
+ * @param stamp Time of each round of conversions (samples rounds, qty / ADC_SCAN_FREQ
+ * apart), see TimestampSample(). The averages are centered between the first and the
+ * last round (NULL if not needed)
+ * @return true Values read
+ * @return false Invalid parameters or ADC not available
  */
-void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value);
+bool AnalogInputScan(const adc_ch_t *channels, uint8_t qty, uint16_t samples, uint16_t *values, timestamp_block_t *stamp);
 
 /**
  * @brief Start convertion for ADC module in continuous mode
@@ -109,6 +196,59 @@ void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
  */
 void AnalogOutputWrite(uint8_t value);
 
+/**
+ * @brief DAC waveform generator initialization.
+ * 
+ * Configures the selected timer to interrupt every 1 / (sample_frec * interp) s 
+ * (rounded to us). Each interrupt writes one value to the DAC, so playback costs 
+ * no task switches. The generator is stopped after init.
+ * 
+ * @note AnalogOutputInit() must be called first. sample_frec * interp must not
+ * exceed DAC_WAVE_UPDATE_MAX.
+ * 
+ * @param config Waveform generator config structure
+ * @return true Generator configured
+ * @return false Invalid parameters or DAC not initialized
+ */
+bool AnalogOutputWaveInit(analog_wave_config_t *config);
+
+/**
+ * @brief Start (or resume) waveform playback.
+ * 
+ * @note After a not looped buffer ended, it plays it again (or the queued one).
+ */
+void AnalogOutputWaveStart(void);
+
+/**
+ * @brief Stop waveform playback. The DAC keeps the last value written.
+ */
+void AnalogOutputWaveStop(void);
+
+/**
+ * @brief Queue the next buffer to play (double buffering).
+ * 
+ * The buffer starts right after the current one ends, without gaps (interpolation 
+ * continues across the boundary). Then the callback is called and a new buffer 
+ * can be queued, while the previous one can be refilled.
+ * 
+ * @note Can be called from the callback (ISR context). If playback already ended
+ * (not looped), AnalogOutputWaveStart() plays the queued buffer.
+ * 
+ * @param samples Sample table (from 0 to 255). Must remain valid until it ends.
+ * @param size Number of samples in the table
+ * @return true Buffer queued
+ * @return false A buffer is already queued or invalid parameters
+ */
+bool AnalogOutputWaveQueue(const uint8_t *samples, uint16_t size);
+
+/**
+ * @brief Check if the waveform generator is playing.
+ * 
+ * @return true Playing
+ * @return false Stopped or finished (not looped and nothing queued)
+ */
+bool AnalogOutputWaveRunning(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -20,6 +20,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 22/03/2024 | Document creation		                         						|
+ * | 18/10/2026 | Received frames stamped with timestamp_mcu (BleReadTimestamp())		|
  * 
  **/
 
@@ -94,6 +95,13 @@ void BleSendString(const char *msg);
  */
 void BleSendBuffer(const char *data, uint8_t nbytes);
 
+/**
+ * @brief Reception time of the frame being processed by the read callback (see timestamp_mcu.h)
+ * 
+ * @return uint64_t Time (us since boot), 0 if no frame received yet
+ */
+uint64_t BleReadTimestamp(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -8,6 +8,17 @@
  ** @{ */
 
 /** \brief GPIO driver to use gpio ouputs with faster functions than gpio_mcu.
+ * 
+ * Groups of pins are handled as parallel buses: every write updates all the 
+ * selected bits of a bus at once, so multi-pin values (BCD digits, LED masks, 
+ * data buses) change without intermediate states.
+ * 
+ * @note Buses use the CPU dedicated GPIO channels (a single instruction per write)
+ * while there are free channels: 8 in the ESP32-C6, one per pin. GPIOBusInit() 
+ * leaves GPIO_FAST_RESERVED of them for GPIOFastInit() (WS2812B bit timing), so 
+ * other buses share 7: e.g. LEDs (3) and LCD (7) do not fit together. Buses 
+ * without channels (a warning is logged) write the GPIO set / clear registers: 
+ * atomic, but cleared and set bits change a few cycles apart.
  * 
  * @author Albano Peñalva
  *
@@ -16,6 +27,9 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/11/2023 | Document creation		                         						|
+ * | 18/10/2026 | Multiple buses of any width, masked writes and strobe lines			|
+ * | 18/10/2026 | Strobe setup time and pulse width										|
+ * | 18/10/2026 | Dedicated channel reserved for GPIOFastInit(), atomic register path	|
  * 
  **/
 
@@ -24,28 +38,98 @@
 #include <stdint.h>
 #include "gpio_mcu.h"
 /*==================[macros]=================================================*/
-
+#define GPIO_BUS_MAX		4		/*!< Max number of buses */
+#define GPIO_BUS_WIDTH_MAX	24		/*!< Max number of pins of a bus */
+#define GPIO_FAST_RESERVED	1		/*!< Dedicated GPIO channels kept for GPIOFastInit() */
 /*==================[typedef]================================================*/
+/**
+ * @brief Bus identifier (returned by GPIOBusInit())
+ */
+typedef uint8_t gpio_bus_t;
 
+/**
+ * @brief Bus configuration struct
+ */
+typedef struct {
+	const gpio_t *pins;		/*!< Pins of the bus, from bit 0 */
+	uint8_t pin_qty;		/*!< Number of pins (1 to GPIO_BUS_WIDTH_MAX) */
+	uint32_t strobe;		/*!< Bits used as strobe lines by GPIOBusStrobe() (0 if none) */
+	uint16_t setup_us;		/*!< Min time from data to strobe rising edge, in us (0: next write) */
+	uint16_t pulse_us;		/*!< Min strobe pulse width, in us (0: next write) */
+} gpio_bus_config_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
 
 /**
- * @brief 
+ * @brief Single bus initialization (used by the WS2812B driver)
  * 
- * @param pin_list 
- * @param pin_qty 
+ * @param pin_list Pins of the bus, from bit 0
+ * @param pin_qty Number of pins
  */
 void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty);
 
 /**
- * @brief 
+ * @brief Write all the pins of the bus initialized with GPIOFastInit()
  * 
- * @param value 
+ * @param value Value to write (bit 0 to the first pin)
  */
 void GPIOFastWrite(uint16_t value);
 
+/**
+ * @brief Bus initialization. Pins are configured as outputs in low state.
+ * 
+ * @param config Bus configuration
+ * @param bus Bus identifier
+ * @return true Bus created
+ * @return false Invalid parameters or no buses available
+ */
+bool GPIOBusInit(const gpio_bus_config_t *config, gpio_bus_t *bus);
+
+/**
+ * @brief Release a bus (pins keep their state).
+ * 
+ * @param bus Bus identifier
+ */
+void GPIOBusDeinit(gpio_bus_t bus);
+
+/**
+ * @brief Write all the pins of the bus
+ * 
+ * @param bus Bus identifier
+ * @param value Value to write (bit 0 to the first pin)
+ */
+void GPIOBusWrite(gpio_bus_t bus, uint32_t value);
+
+/**
+ * @brief Write some pins of the bus, the others keep their state
+ * 
+ * @param bus Bus identifier
+ * @param mask Bits to update
+ * @param value Value to write (bit 0 to the first pin)
+ */
+void GPIOBusWriteMasked(gpio_bus_t bus, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Write the data bits (not configured as strobe) and then pulse strobe lines.
+ * 
+ * @note Without setup_us / pulse_us the edges are a few CPU cycles apart (tens of ns),
+ * faster than most latches accept.
+ * 
+ * @param bus Bus identifier
+ * @param value Value of the data bits
+ * @param strobe Strobe lines to pulse (high and then low), among the configured ones
+ */
+void GPIOBusStrobe(gpio_bus_t bus, uint32_t value, uint32_t strobe);
+
+/**
+ * @brief Read the state of the pins of the bus
+ * 
+ * @param bus Bus identifier
+ * @return Last value written (bit 0 from the first pin)
+ */
+uint32_t GPIOBusRead(gpio_bus_t bus);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -26,6 +26,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 18/10/2026 | Enable/disable of GPIO interrupts									|
+ * | 18/10/2026 | Interrupt edges stamped with timestamp_mcu (GPIOReadEdgeTime())		|
  * 
  **/
 
@@ -134,6 +136,35 @@ bool GPIORead(gpio_t pin);
  */
 void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args);
 
+/**
+ * @brief Enable again the interrupt of a GPIO (configured with GPIOActivInt())
+ * 
+ * @note Can be called from an ISR
+ * 
+ * @param pin GPIO number
+ */
+void GPIOIntEnable(gpio_t pin);
+
+/**
+ * @brief Disable the interrupt of a GPIO, keeping its configuration
+ * 
+ * @note Can be called from an ISR
+ * 
+ * @param pin GPIO number
+ */
+void GPIOIntDisable(gpio_t pin);
+
+/**
+ * @brief Time of the last interrupt edge of a GPIO (configured with GPIOActivInt()),
+ * taken in the ISR before calling the callback (see timestamp_mcu.h)
+ *
+ * @note Can be called from an ISR (from the callback: time of the current edge)
+ *
+ * @param pin GPIO number
+ * @return uint64_t Time (us since boot), 0 if no edge yet
+ */
+uint64_t GPIOReadEdgeTime(gpio_t pin);
+
 /**
  * @brief Configure an input glitch filter to a GPIO
  * 
@@ -21,6 +21,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 30/01/2024 | Document creation		                         |
+ * | 18/10/2026 | Transfer time measured with trace_mcu (TRACE_I2C)	 |
  *
  */
 
@@ -0,0 +1,153 @@
+#ifndef LOGGER_MCU_H
+#define LOGGER_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Logger Logger
+ ** @{ */
+
+/** \brief Flash data logger for the ESP-EDU Board.
+ *
+ * Stores samples of several sources (each sample: 1 to LOGGER_CHANNELS_MAX
+ * int32 values and a timestamp in us, see timestamp_mcu.h) in a data partition
+ * of the flash.
+ *
+ * LoggerWrite() only encodes the sample in a RAM buffer (it can be called from
+ * tasks and ISRs). When a buffer is full a writer task stores it as a block of
+ * the partition while the next buffer is filled, so the acquisition never waits
+ * for the flash. Samples are dropped (LoggerStatus()) only if all buffers are
+ * waiting for the flash.
+ *
+ * The partition is used as a circular log: blocks are written in order and,
+ * when it is full, the oldest sector is erased, so all sectors are erased the
+ * same number of times (wear leveling). On start up the log continues after
+ * the last block written.
+ *
+ * Values and time differences are stored as variable length integers (1 byte
+ * for values from -64 to 63). Sources with delta enabled store the difference
+ * with the previous sample: slow signals take 1 or 2 bytes per value. Each
+ * block can be decoded by itself.
+ *
+ * LoggerExport() sends the log through a serial port, the logger_decode.py
+ * script (firmware/tools) converts it to a CSV file per source.
+ *
+ * @note The partition is declared in the project partitions.csv (type data,
+ * subtype 0x40), for example: "datalog, data, 0x40, , 2M,"
+ *
+ * @note While the flash is written or erased the cache is disabled: only IRAM
+ * interrupts run (a sector erase takes up to 50 ms). Set CONFIG_SPI_FLASH_AUTO_SUSPEND
+ * in sdkconfig to suspend the erase on interrupts and cache misses instead.
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ * | 18/10/2026 | LoggerErase() keeps the erase count of each sector					|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "uart_mcu.h"
+/*==================[macros]=================================================*/
+#define LOGGER_PARTITION		"datalog"	/*!< Default partition label */
+#define LOGGER_BLOCK_SIZE		1024		/*!< Bytes written to the flash at once (4 pages) */
+#define LOGGER_BUFFERS			2			/*!< RAM buffers (one is filled while the others are written) */
+#define LOGGER_SOURCES_MAX		8
+#define LOGGER_CHANNELS_MAX		8			/*!< Values per sample */
+/*==================[typedef]================================================*/
+/**
+ * @brief Logger configuration struct
+ */
+typedef struct {
+	const char *partition;	/*!< Partition label (NULL: LOGGER_PARTITION) */
+	uint8_t priority;		/*!< Writer task priority (lower than the acquisition tasks) */
+} logger_config_t;
+
+/**
+ * @brief Data source
+ */
+typedef struct {
+	const char *name;		/*!< Name in the export (the string is not copied) */
+	uint8_t channels;		/*!< Values per sample (1 to LOGGER_CHANNELS_MAX) */
+	bool delta;				/*!< Store differences between samples (for slow signals) */
+} logger_source_t;
+
+/**
+ * @brief Logger status
+ */
+typedef struct {
+	uint32_t blocks_used;	/*!< Blocks with data */
+	uint32_t blocks_total;	/*!< Blocks in the partition */
+	uint32_t dropped;		/*!< Samples lost because all buffers were full */
+	uint32_t erase_max;		/*!< Erase count of the most worn sector */
+} logger_status_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Find the partition and the last block written, and start the writer task.
+ *
+ * @param config Logger configuration
+ * @return true Logger ready
+ * @return false Partition not found or too small
+ */
+bool LoggerInit(const logger_config_t *config);
+
+/**
+ * @brief Add a data source.
+ *
+ * @param source Source description
+ * @return int8_t Source id for LoggerWrite(), -1 on error
+ */
+int8_t LoggerAddSource(const logger_source_t *source);
+
+/**
+ * @brief Store a sample (from tasks or ISRs).
+ *
+ * @param source Source id
+ * @param values Sample values (as many as the source channels)
+ * @return true Sample stored in RAM
+ * @return false Not initialized, invalid source or all buffers full (sample dropped)
+ */
+bool LoggerWrite(int8_t source, const int32_t *values);
+
+/**
+ * @brief Write the partially filled buffer to the flash and wait until it is written.
+ */
+void LoggerFlush(void);
+
+/**
+ * @brief Erase the whole log, sector by sector, keeping their erase counts.
+ */
+void LoggerErase(void);
+
+/**
+ * @brief Read the logger status.
+ *
+ * @param status Logger status
+ */
+void LoggerStatus(logger_status_t *status);
+
+/**
+ * @brief Send the log through a serial port (flushes first).
+ *
+ * Text lines "#LOG,<block_size>,<blocks>" and "#SRC,<id>,<name>,<channels>,<delta>"
+ * for each source, "#DATA", then the blocks (binary, oldest first) and "#END".
+ * Use a high baud rate (921600): 1 MB takes 11 s.
+ *
+ * @param port Serial port (initialized)
+ */
+void LoggerExport(uart_mcu_port_t port);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
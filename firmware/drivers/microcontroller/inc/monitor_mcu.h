@@ -0,0 +1,107 @@
+#ifndef MONITOR_MCU_H
+#define MONITOR_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Monitor Monitor
+ ** @{ */
+
+/** \brief Runtime monitor for the ESP-EDU Board.
+ *
+ * A low priority task samples the FreeRTOS tasks every period and sends a
+ * short report through a serial port or BLE, to size the task stacks and
+ * find the tasks that use the CPU:
+ *
+ * | Line                                        | Content                                          |
+ * |:--------------------------------------------|:-------------------------------------------------|
+ * | \#MON,uptime_ms,idle_pct,heap_free,heap_min | Header: CPU idle % and free heap (bytes)         |
+ * | T,name,priority,cpu_pct,stack_free          | One line per task: CPU % in the period and min free stack (bytes) |
+ * | Q,name,used,size                            | One line per queue added with MonitorAddQueue()  |
+ * | I,name,rate_hz                              | One line per counter added with MonitorAddIsr()  |
+ *
+ * CPU percentages have one decimal. A stack_free below 256 bytes means the
+ * task is close to overflow.
+ *
+ * @note Requires CONFIG_FREERTOS_USE_TRACE_FACILITY, and
+ * CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS for the CPU % (otherwise cpu_pct
+ * and idle_pct are sent as -1).
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "uart_mcu.h"
+/*==================[macros]=================================================*/
+#define MONITOR_TASKS_MAX	24		/*!< Max tasks reported */
+#define MONITOR_QUEUES_MAX	8		/*!< Max queues added with MonitorAddQueue() */
+#define MONITOR_ISR_MAX		8		/*!< Max counters added with MonitorAddIsr() */
+/*==================[typedef]================================================*/
+/**
+ * @brief Report destination
+ */
+typedef enum {
+	MONITOR_UART,		/*!< Serial port (must be initialized) */
+	MONITOR_BLE,		/*!< BLE (sent only while connected) */
+} monitor_output_t;
+
+/**
+ * @brief Monitor configuration struct
+ */
+typedef struct {
+	monitor_output_t output;	/*!< Report destination */
+	uart_mcu_port_t port;		/*!< Serial port (MONITOR_UART) */
+	uint32_t period_ms;			/*!< Report period */
+	uint8_t priority;			/*!< Monitor task priority (1 recommended) */
+} monitor_config_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Start the monitor task.
+ *
+ * @param config Monitor configuration
+ * @return true Monitor started
+ * @return false Trace facility disabled in sdkconfig or task not created
+ */
+bool MonitorInit(const monitor_config_t *config);
+
+/**
+ * @brief Add a queue to the report (messages waiting and size).
+ *
+ * @param queue Queue handle (QueueHandle_t)
+ * @param name Name in the report (the string is not copied)
+ * @return true Queue added
+ */
+bool MonitorAddQueue(void *queue, const char *name);
+
+/**
+ * @brief Add an interrupt counter to the report.
+ *
+ * @param name Name in the report (the string is not copied)
+ * @return int8_t Counter id for MonitorIsrCount(), -1 if there is no room
+ */
+int8_t MonitorAddIsr(const char *name);
+
+/**
+ * @brief Count an interrupt (call it from the ISR or the driver callback).
+ *
+ * @param id Counter id returned by MonitorAddIsr()
+ */
+void MonitorIsrCount(int8_t id);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
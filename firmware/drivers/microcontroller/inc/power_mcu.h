@@ -0,0 +1,134 @@
+#ifndef POWER_MCU_H
+#define POWER_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Power Power
+ ** @{ */
+
+/** \brief Power management driver for the ESP-EDU Board.
+ *
+ * This driver provide functions to enable dynamic frequency scaling (DFS) and 
+ * automatic light sleep, to select the light sleep wake up sources and to keep 
+ * the CPU at full speed (or awake) while a time critical job runs.
+ * 
+ * @note Requires CONFIG_PM_ENABLE (and CONFIG_FREERTOS_USE_TICKLESS_IDLE for light 
+ * sleep) in sdkconfig. With CONFIG_PM_PROFILING, PowerPrintStats() shows the time 
+ * spent in each mode.
+ * 
+ * @note The CPU goes to light sleep only when all tasks are blocked and no driver 
+ * holds a lock: a running timer (TimerStart() until TimerStop()), an ADC scan, 
+ * a SPI transaction or the DAC keep it awake. FreeRTOS delays and timeouts wake 
+ * it up on time.
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "gpio_mcu.h"
+#include "uart_mcu.h"
+/*==================[macros]=================================================*/
+#define POWER_FREQ_MAX_MHZ	160		/*!< Max CPU frequency */
+#define POWER_FREQ_MIN_MHZ	40		/*!< Min CPU frequency (XTAL) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Power management configuration struct
+ */
+typedef struct {
+	uint16_t max_freq_mhz;	/*!< CPU frequency while a task is running (80, 120 or 160 MHz) */
+	uint16_t min_freq_mhz;	/*!< CPU frequency while idle (40 MHz or more) */
+	bool light_sleep;		/*!< Enter light sleep when idle */
+} power_config_t;
+
+/**
+ * @brief Lock types
+ */
+typedef enum {
+	POWER_LOCK_CPU_MAX,		/*!< Keep the CPU at max_freq_mhz */
+	POWER_LOCK_NO_SLEEP,	/*!< Keep the CPU out of light sleep (frequency can be lowered) */
+} power_lock_type_t;
+
+/**
+ * @brief Power lock handle
+ */
+typedef void *power_lock_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Power management initialization.
+ * 
+ * @param config Power management configuration
+ * @return true Configuration applied
+ * @return false Invalid frequencies or power management not enabled in sdkconfig
+ */
+bool PowerInit(const power_config_t *config);
+
+/**
+ * @brief Wake up from light sleep on a GPIO level.
+ * 
+ * @note The GPIO must be initialized as input.
+ * 
+ * @param pin GPIO number
+ * @param level true: wake up on high level - false: wake up on low level
+ * @return true Wake up source enabled
+ */
+bool PowerWakeOnGpio(gpio_t pin, bool level);
+
+/**
+ * @brief Wake up from light sleep when data arrives to a serial port.
+ * 
+ * @note The characters received while waking up are lost, the sender should
+ * send a wake up byte first.
+ * 
+ * @param port Serial port (initialized)
+ * @param edges Number of RX rising edges that wake up the CPU (3 or more)
+ * @return true Wake up source enabled
+ */
+bool PowerWakeOnUart(uart_mcu_port_t port, uint8_t edges);
+
+/**
+ * @brief Create a power lock.
+ * 
+ * @param type Lock type
+ * @param name Name shown by PowerPrintStats()
+ * @param lock Lock handle
+ * @return true Lock created
+ */
+bool PowerLockCreate(power_lock_type_t type, const char *name, power_lock_t *lock);
+
+/**
+ * @brief Acquire a lock (nested calls are counted).
+ * 
+ * @param lock Lock handle
+ */
+void PowerLockAcquire(power_lock_t lock);
+
+/**
+ * @brief Release a lock.
+ * 
+ * @param lock Lock handle
+ */
+void PowerLockRelease(power_lock_t lock);
+
+/**
+ * @brief Print the power locks and the time spent in each mode (CONFIG_PM_PROFILING).
+ */
+void PowerPrintStats(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif 
+
+/*==================[end of file]============================================*/
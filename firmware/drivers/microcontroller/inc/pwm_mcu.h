@@ -14,6 +14,10 @@
  * @note It can setup up to 4 PWM outputs, with independet duty 
  * cycle and frequency configuration
  *
+ * @note Each output uses the highest duty resolution available for its
+ * frequency (up to 19 bits at low frequencies). Use PWMGetMaxDuty() and
+ * PWMSetDutyRaw() to access the full resolution.
+ *
  * @author Albano Peñalva
  * 
  * @section changelog
@@ -21,6 +25,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 23/01/2024 | Document creation		                         |
+ * | 18/10/2026 | Full resolution duty, fades and synced updates |
  *
  */
 
@@ -36,6 +41,14 @@ typedef enum pwm_out {
 	PWM_2,		/**< PWM output 3 */
 	PWM_3		/**< PWM output 4 */
 } pwm_out_t;
+
+/**
+ * @brief Duty cycle of one output, used for synchronized updates
+ */
+typedef struct {
+	pwm_out_t out;		/*!< PWM output */
+	uint32_t duty;		/*!< Duty cycle in timer counts (0 to PWMGetMaxDuty()) */
+} pwm_duty_t;
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
@@ -74,6 +87,77 @@ void PWMOff(pwm_out_t out);
  */
 void PWMSetDutyCycle(pwm_out_t out, uint8_t duty_cycle);
 
+/**
+ * @brief Get the duty cycle value equivalent to 100% for an PWM output
+ * 
+ * @note It depends on the frequency of the output, so it may change
+ * after PWMSetFreq().
+ * 
+ * @param out PWM output 
+ * @return uint32_t 100% duty cycle in timer counts
+ */
+uint32_t PWMGetMaxDuty(pwm_out_t out);
+
+/**
+ * @brief Change PWM duty cycle of an PWM output with full timer resolution
+ * 
+ * @param out PWM output 
+ * @param duty duty cycle in timer counts (0 to PWMGetMaxDuty())
+ */
+void PWMSetDutyRaw(pwm_out_t out, uint32_t duty);
+
+/**
+ * @brief Change PWM duty cycle of an PWM output as a fraction (num / den)
+ * 
+ * @note E.g. PWMSetDutyRatio(out, 1500, 20000) sets a 1.5 ms pulse in a 
+ * 20 ms period. Resolution is the one of the timer.
+ * 
+ * @param out PWM output 
+ * @param num numerator (clipped to den)
+ * @param den denominator
+ */
+void PWMSetDutyRatio(pwm_out_t out, uint32_t num, uint32_t den);
+
+/**
+ * @brief Change duty cycle of several PWM outputs at once
+ * 
+ * All the new duty cycles are written first and then latched together. Each
+ * output has its own LEDC timer and switches to its new value at the end of
+ * its own PWM period: outputs switch in the same period (no intermediate
+ * states between them) only if they have the same frequency and their timers
+ * were aligned with PWMSync().
+ * 
+ * @param duties Array of outputs and duty cycles (in timer counts, invalid outputs are skipped)
+ * @param qty Number of elements in the array
+ */
+void PWMSetDutyMulti(const pwm_duty_t *duties, uint8_t qty);
+
+/**
+ * @brief Align the periods of several PWM outputs
+ * 
+ * @note Outputs should have the same frequency.
+ * 
+ * @param outs Array of PWM outputs
+ * @param qty Number of elements in the array
+ */
+void PWMSync(const pwm_out_t *outs, uint8_t qty);
+
+/**
+ * @brief Ramp the duty cycle of an PWM output in hardware
+ * 
+ * The LEDC peripheral changes the duty cycle from the current value to
+ * the target in the given time, without CPU intervention. 
+ * The function returns immediately.
+ * 
+ * @note Setting the duty cycle of the output stops the fade.
+ * 
+ * @param out PWM output 
+ * @param duty target duty cycle in timer counts (0 to PWMGetMaxDuty())
+ * @param time_ms fade duration (in ms)
+ * @return uint8_t 0 fade started, 1 invalid output or LEDC fade service not available
+ */
+uint8_t PWMFade(pwm_out_t out, uint32_t duty, uint32_t time_ms);
+
 /**
  * @brief Change frequency of an PWM output
  * 
@@ -26,6 +26,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 18/10/2026 | RtcRead() with the cached conversion of timestamp_mcu				|
  * 
  **/
 
@@ -21,6 +21,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 09/02/2024 | Document creation		                         						|
+ * | 18/10/2026 | Transfer time measured with trace_mcu (TRACE_SPI)						|
  * 
  **/
 /*==================[inclusions]=============================================*/
@@ -17,6 +17,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/10/2023 | Document creation		                         						|
+ * | 18/10/2026 | Timers hold the power management lock only while running			|
+ * | 18/10/2026 | TimerDeinit() releases the hardware timer								|
  * 
  **/
 
@@ -57,6 +59,9 @@ void TimerInit(timer_config_t *timer_ini);
 /**
  * @brief Start timer count
  * 
+ * @note While the timer runs the CPU does not enter light sleep (see power_mcu.h).
+ * From an ISR it only restarts a timer stopped from an ISR (tasks must start it first).
+ * 
  * @param timer Timer number
  */
 void TimerStart(timer_mcu_t timer);
@@ -74,6 +79,9 @@ uint32_t TimerRead(timer_mcu_t timer);
 /**
  * @brief Pause timer
  * 
+ * @note When called from an ISR the timer keeps the CPU awake until it is 
+ * stopped again (or deinitialized) from a task.
+ * 
  * @param timer Timer number
  */
 void TimerStop(timer_mcu_t timer);
@@ -98,6 +106,13 @@ void TimerReset(timer_mcu_t timer);
  */
 void TimerUpdatePeriod(timer_mcu_t timer, uint32_t period);
 
+/**
+ * @brief Stop the timer and release it, TimerInit() can be called again
+ * 
+ * @param timer Timer number
+ */
+void TimerDeinit(timer_mcu_t timer);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
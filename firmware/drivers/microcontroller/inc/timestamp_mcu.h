@@ -0,0 +1,133 @@
+#ifndef TIMESTAMP_MCU_H
+#define TIMESTAMP_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Timestamp Timestamp
+ ** @{ */
+
+/** \brief Common timebase for the ESP-EDU Board.
+ *
+ * All timestamps are microseconds since boot in 64 bits (monotonic, it doesn't
+ * wrap), read from the system timer used by esp_timer: TimestampGet() can be
+ * called from tasks and ISRs and takes less than 1 us. Samples of different
+ * sensors stamped with it can be aligned and latencies between them measured.
+ *
+ * Stamps provided by other drivers with the same timebase:
+ * - GPIOReadEdgeTime(): last edge of a GPIO with interrupt (taken in the ISR).
+ * - UartReadTimestamp(): last received data event.
+ * - BleReadTimestamp(): frame being processed by the BLE read callback.
+ * - Blocks of samples taken at a fixed rate (ADC scans, IMU FIFO): TimestampBlock()
+ *   stamps the last sample and TimestampSample() gives the time of each one.
+ *
+ * For short intervals (a few instructions) TimestampCycles() reads the CPU
+ * cycle counter.
+ *
+ * TimestampToCalendar() converts a timestamp to date and time (RtcConfig()
+ * sets the clock). The conversion is cached: within the same minute it only
+ * adds the seconds, so it can be used for every sample of a log.
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "rtc_mcu.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Block of samples taken at a fixed rate
+ */
+typedef struct {
+	uint64_t last;			/*!< Time of the last sample (us) */
+	uint32_t period_us;		/*!< Sample period (us) */
+	uint16_t qty;			/*!< Samples in the block */
+} timestamp_block_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Read the time since boot (from tasks or ISRs).
+ *
+ * @return uint64_t Time (us)
+ */
+uint64_t TimestampGet(void);
+
+/**
+ * @brief Read the CPU cycle counter (from tasks or ISRs).
+ *
+ * @note It wraps every 27 s at 160 MHz. With power management enabled the CPU
+ * frequency changes: hold a POWER_LOCK_CPU_MAX lock while measuring.
+ *
+ * @return uint32_t CPU cycles
+ */
+uint32_t TimestampCycles(void);
+
+/**
+ * @brief Convert a difference of TimestampCycles() to nanoseconds (at the current CPU frequency).
+ *
+ * @param cycles CPU cycles
+ * @return uint32_t Time (ns)
+ */
+uint32_t TimestampCyclesToNs(uint32_t cycles);
+
+/**
+ * @brief Stamp a block of samples taken at a fixed rate (from tasks or ISRs).
+ *
+ * @param block Block to stamp
+ * @param last Time of the last sample, usually TimestampGet() when the block is read
+ * @param qty Samples in the block
+ * @param period_us Sample period (us)
+ */
+void TimestampBlock(timestamp_block_t *block, uint64_t last, uint16_t qty, uint32_t period_us);
+
+/**
+ * @brief Time of a sample of a block.
+ *
+ * @param block Stamped block
+ * @param index Sample index (0: first sample)
+ * @return uint64_t Time (us)
+ */
+uint64_t TimestampSample(const timestamp_block_t *block, uint16_t index);
+
+/**
+ * @brief Convert a timestamp to Unix time (us since 1/1/1970).
+ *
+ * @note Not for ISRs.
+ *
+ * @param time Timestamp (us)
+ * @return int64_t Unix time (us)
+ */
+int64_t TimestampToUnix(uint64_t time);
+
+/**
+ * @brief Convert a timestamp to date and time (same fields as RtcRead()).
+ *
+ * @note Not for ISRs.
+ *
+ * @param time Timestamp (us)
+ * @param rtc Date and time
+ */
+void TimestampToCalendar(uint64_t time, rtc_t *rtc);
+
+/**
+ * @brief Read again the wall clock after it is changed (RtcConfig() calls it).
+ */
+void TimestampSync(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,149 @@
+#ifndef TRACE_MCU_H
+#define TRACE_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Trace Trace
+ ** @{ */
+
+/** \brief Execution time trace for the ESP-EDU Board.
+ *
+ * Measures the time spent in the instrumented functions with the CPU cycle
+ * counter. Each TRACE_ENTER()/TRACE_EXIT() pair stores an event (start and
+ * duration) in a ring buffer of the current core, and updates the statistics
+ * of its id: count, min, mean, max and the 50, 90 and 99 percentiles (from a
+ * histogram with 4 bins per octave, so percentiles are within 12.5%).
+ *
+ * Each core writes only its own buffer and statistics, with its interrupts
+ * masked for a few instructions: there are no locks between cores and the
+ * functions can be used from tasks and ISRs.
+ *
+ * The statistics are sent by TraceExportStats(). TraceExportEvents() sends
+ * the last events, the trace_to_chrome.py script (firmware/tools) converts
+ * them to a Chrome trace / Perfetto JSON file.
+ *
+ * @note Enabled with CONFIG_TRACE_ENABLE (menuconfig -> Drivers -> Trace).
+ * When it is disabled TRACE_ENTER()/TRACE_EXIT() are empty and the
+ * instrumented functions don't change.
+ *
+ * @note The cycle counter follows the CPU clock: TraceStart() keeps the CPU at
+ * max frequency while tracing (see power_mcu.h), otherwise the times measured
+ * while the frequency is lowered are wrong.
+ *
+ * Example:
+ * @code
+ * void Process(void){
+ * 	TRACE_ENTER(TRACE_USER_0);
+ * 	...
+ * 	TRACE_EXIT(TRACE_USER_0);
+ * }
+ * @endcode
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+#include "uart_mcu.h"
+/*==================[macros]=================================================*/
+#ifdef CONFIG_TRACE_ENABLE
+/** @brief Start measuring a block (declares a local variable, use once per id in a function) */
+#define TRACE_ENTER(id)		uint32_t trace_start_##id = TraceEnter(id)
+/** @brief End of the block started with TRACE_ENTER() (same id, same function) */
+#define TRACE_EXIT(id)		TraceExit(id, trace_start_##id)
+#else
+#define TRACE_ENTER(id)		((void)0)
+#define TRACE_EXIT(id)		((void)0)
+#endif
+/*==================[typedef]================================================*/
+/**
+ * @brief Trace ids (instrumented functions)
+ */
+typedef enum {
+	TRACE_IIR,		/*!< IIR filters (iir_filter.c) */
+	TRACE_FFT,		/*!< FFT magnitude (fft.c) */
+	TRACE_IMU,		/*!< IMU orientation filter (imu_filter.c) */
+	TRACE_ILI9341,	/*!< Display drawing (ili9341.c) */
+	TRACE_SPI,		/*!< SPI transfers */
+	TRACE_I2C,		/*!< I2C transfers */
+	TRACE_UART,		/*!< UART transmission */
+	TRACE_USER_0,	/*!< Free for the application */
+	TRACE_USER_1,	/*!< Free for the application */
+	TRACE_USER_2,	/*!< Free for the application */
+	TRACE_USER_3,	/*!< Free for the application */
+	TRACE_ID_QTY,
+} trace_id_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Clear the events and statistics and start recording.
+ *
+ * Keeps the CPU at max frequency until TraceStop().
+ */
+void TraceStart(void);
+
+/**
+ * @brief Stop recording (events and statistics are kept).
+ */
+void TraceStop(void);
+
+/**
+ * @brief Set the name of an id (for the TRACE_USER_x ids).
+ *
+ * @param id Trace id
+ * @param name Name (the string is not copied)
+ */
+void TraceSetName(trace_id_t id, const char *name);
+
+/**
+ * @brief Register the start of a block (use TRACE_ENTER()).
+ *
+ * @param id Trace id
+ * @return uint32_t Cycle count at start
+ */
+uint32_t TraceEnter(trace_id_t id);
+
+/**
+ * @brief Register the end of a block (use TRACE_EXIT()). Can be called from ISRs.
+ *
+ * @param id Trace id
+ * @param start Cycle count returned by TraceEnter()
+ */
+void TraceExit(trace_id_t id, uint32_t start);
+
+/**
+ * @brief Send the statistics of each id with events through a serial port.
+ *
+ * One line per id: "name,count,min_us,mean_us,p50_us,p90_us,p99_us,max_us"
+ *
+ * @param port Serial port (initialized)
+ */
+void TraceExportStats(uart_mcu_port_t port);
+
+/**
+ * @brief Send the events in the ring buffers (oldest first) through a serial port.
+ *
+ * First line "#TRACE,<cycles_per_us>", then one line per event "core,name,start_cycles,cycles"
+ * and last line "#END".
+ *
+ * @param port Serial port (initialized)
+ */
+void TraceExportEvents(uart_mcu_port_t port);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
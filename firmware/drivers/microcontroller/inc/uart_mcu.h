@@ -17,6 +17,10 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 02/07/2024 | Document creation		                         						|
+ * | 18/10/2026 | XTAL clock source when power management is enabled					|
+ * | 18/10/2026 | Transmission time measured with trace_mcu (TRACE_UART)				|
+ * | 18/10/2026 | UartSendBufferWait() for bulk transfers								|
+ * | 18/10/2026 | Received data stamped with timestamp_mcu (UartReadTimestamp())		|
  * 
  **/
 
@@ -70,6 +74,21 @@ uint8_t UartReadByte(uart_mcu_port_t port, uint8_t *data);
  */
 uint8_t UartReadBuffer(uart_mcu_port_t port, uint8_t *data, uint16_t nbytes);
 
+/**
+ * @brief Time of the last received data event (see timestamp_mcu.h)
+ * 
+ * The driver reports the data when the FIFO fills or after a pause of 10
+ * characters: call it from the reception callback (only with func_p != UART_NO_INT).
+ * 
+ * @note The time is taken by the driver event task when it receives the event
+ * (after xQueueReceive()), so it includes the interrupt to task latency: the
+ * data arrived up to 10 characters plus a scheduling delay before it.
+ * 
+ * @param port Port to read from
+ * @return uint64_t Time (us since boot), 0 if no data received yet
+ */
+uint64_t UartReadTimestamp(uart_mcu_port_t port);
+
 /**
  * @brief Send a single byte trough serial port
  * 
@@ -97,6 +116,16 @@ void UartSendString(uart_mcu_port_t port, const char *msg);
  */
 void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes);
 
+/**
+ * @brief Send a large buffer through serial port, waiting while the transmit 
+ * buffer is full (no bytes are lost). Not to be called from an ISR.
+ * 
+ * @param port Port for sending data
+ * @param data Pointer to array of data to be transmitted
+ * @param nbytes Number of bytes to be sended
+ */
+void UartSendBufferWait(uart_mcu_port_t port, const char *data, uint32_t nbytes);
+
 /**
  * @brief Convert a number to a String (char array ended with '\0')
  * 
@@ -11,20 +11,56 @@
 
 /*==================[inclusions]=============================================*/
 #include "analog_io_mcu.h"
+#include "timestamp_mcu.h"
 #include "driver/gptimer.h"
 #include "driver/sdm.h"
 #include "esp_adc/adc_cali_scheme.h"
 #include "esp_adc/adc_oneshot.h"
 #include "esp_adc/adc_continuous.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 /*==================[macros and definitions]=================================*/
 #define ADC_BITWIDTH 		SOC_ADC_DIGI_MAX_BITWIDTH	// 12 bit resolution
 #define ADC_ATTENUATION		ADC_ATTEN_DB_12				// 12dB attenuation (for 0-3,3V ADC range)
+#define ADC_MAX_RAW			((1 << ADC_BITWIDTH) - 1)
+#define LUT_SHIFT			5							/*!< Calibration table: one point every 32 counts */
+#define LUT_POINTS			(((ADC_MAX_RAW + 1) >> LUT_SHIFT) + 1)
+#define OVERSAMPLE_BITS		4							/*!< Extra resolution of the averages */
+#define FRAC_BITS			(LUT_SHIFT + OVERSAMPLE_BITS)
+#define SCAN_FRAME_SIZE		(64 * SOC_ADC_DIGI_RESULT_BYTES)	/*!< DMA frame (64 conversions) */
+#define SCAN_TIMEOUT_MS		100
+#define US_PER_SEC			1000000
+#define DAC_MIDSCALE		128							/*!< AnalogOutputWrite() value for 0 pulse density */
 /*==================[internal data declaration]==============================*/
-adc_cali_handle_t adc_calibration_single_0, adc_calibration_single_1, adc_calibration_single_2, adc_calibration_single_3;
+adc_cali_handle_t adc_calibration_single[ADC_CH_QTY];
 adc_oneshot_unit_handle_t adc1_single; 
 adc_continuous_handle_t adc2_cont;
 sdm_channel_handle_t dac = NULL;
 bool adc1_single_used = false;
+static adc_continuous_handle_t adc_scan = NULL;
+static uint16_t adc_lut[ADC_CH_QTY][LUT_POINTS];	/*!< Calibrated mV every 2^LUT_SHIFT counts */
+static bool adc_lut_ready[ADC_CH_QTY] = {false};
+static uint8_t scan_frame[SCAN_FRAME_SIZE];
+static SemaphoreHandle_t adc_mutex = NULL;			/*!< ADC1 is shared by oneshot reads and scans */
+static StaticSemaphore_t adc_mutex_buffer;
+/**
+ * @brief DAC waveform generator state (shared with the timer ISR)
+ */
+static struct {
+	timer_mcu_t timer;
+	const uint8_t *volatile buf;	/*!< Buffer playing */
+	volatile uint16_t size;
+	const uint8_t *volatile next;	/*!< Buffer queued (NULL if none) */
+	volatile uint16_t next_size;
+	uint16_t index;					/*!< Sample playing */
+	uint8_t phase;					/*!< Interpolation step inside the sample */
+	uint8_t shift;					/*!< log2(interp) */
+	bool loop;
+	volatile bool running;
+	bool ended;						/*!< Last buffer ended with nothing queued */
+	void (*func_p)(void*);
+	void *param_p;
+} dac_wave = {.buf = NULL};
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -36,9 +72,152 @@ adc_oneshot_chan_cfg_t adc_config_single = {
 	.bitwidth = ADC_BITWIDTH,
 	.atten = ADC_ATTENUATION,
 };					
+static const adc_channel_t adc_channel[ADC_CH_QTY] = {ADC_CHANNEL_0, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3};
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Tabulate the calibration curve of a channel. The last point (one
+ * step past ADC_MAX_RAW) is extrapolated from the previous segment.
+ */
+static void adc_build_lut(adc_ch_t channel){
+	int mv;
+	uint16_t *lut = adc_lut[channel];
+	for(uint16_t i = 0; i < LUT_POINTS - 1; i++){
+		adc_cali_raw_to_voltage(adc_calibration_single[channel], i << LUT_SHIFT, &mv);
+		lut[i] = (mv > 0) ? mv : 0;
+	}
+	adc_cali_raw_to_voltage(adc_calibration_single[channel], ADC_MAX_RAW, &mv);
+	lut[LUT_POINTS - 1] = (mv > lut[LUT_POINTS - 2]) ? 
+		lut[LUT_POINTS - 2] + ((mv - lut[LUT_POINTS - 2]) << LUT_SHIFT) / ((1 << LUT_SHIFT) - 1) : lut[LUT_POINTS - 2];
+	adc_lut_ready[channel] = true;
+}
+
+/**
+ * @brief Calibrated mV of a reading with OVERSAMPLE_BITS fractional bits
+ * (linear interpolation between table points, integer only)
+ */
+static uint16_t adc_to_mv(adc_ch_t channel, uint32_t raw_frac){
+	const uint16_t *lut = adc_lut[channel];
+	uint32_t seg = raw_frac >> FRAC_BITS;
+	uint32_t frac = raw_frac & ((1 << FRAC_BITS) - 1);
+	return lut[seg] + ((((uint32_t)(lut[seg + 1] - lut[seg])) * frac + (1 << (FRAC_BITS - 1))) >> FRAC_BITS);
+}
+
+/**
+ * @brief Sum samples conversions of each channel with the ADC digital controller (DMA).
+ * The stamp (if not NULL) gives the time of each round of conversions (one per channel).
+ */
+static bool adc_scan_sum(const adc_ch_t *channels, uint8_t qty, uint16_t samples, uint32_t *sums, timestamp_block_t *stamp){
+	adc_digi_pattern_config_t pattern[ADC_CH_QTY];
+	uint16_t count[ADC_CH_QTY] = {0};
+	uint32_t pending = (uint32_t)qty * samples;
+	uint32_t read_bytes, n;
+	uint64_t read_time = 0;
+	uint8_t i;
+	if(adc_scan == NULL){
+		adc_continuous_handle_cfg_t handle_cfg = {
+			.max_store_buf_size = 4 * SCAN_FRAME_SIZE,
+			.conv_frame_size = SCAN_FRAME_SIZE,
+		};
+		if(adc_continuous_new_handle(&handle_cfg, &adc_scan) != ESP_OK){
+			adc_scan = NULL;
+			return false;
+		}
+	}
+	for(i = 0; i < qty; i++){
+		pattern[i].atten = ADC_ATTENUATION;
+		pattern[i].channel = adc_channel[channels[i]];
+		pattern[i].unit = ADC_UNIT_1;
+		pattern[i].bit_width = ADC_BITWIDTH;
+		sums[i] = 0;
+	}
+	adc_continuous_config_t scan_cfg = {
+		.pattern_num = qty,
+		.adc_pattern = pattern,
+		.sample_freq_hz = ADC_SCAN_FREQ,
+		.conv_mode = ADC_CONV_SINGLE_UNIT_1,
+		.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+	};
+	if(adc_continuous_config(adc_scan, &scan_cfg) != ESP_OK){
+		return false;
+	}
+	if(adc_continuous_start(adc_scan) != ESP_OK){
+		return false;
+	}
+	while(pending > 0){
+		if(adc_continuous_read(adc_scan, scan_frame, SCAN_FRAME_SIZE, &read_bytes, SCAN_TIMEOUT_MS) != ESP_OK){
+			break;
+		}
+		read_time = TimestampGet();
+		for(n = 0; (n < read_bytes) && (pending > 0); n += SOC_ADC_DIGI_RESULT_BYTES){
+			adc_digi_output_data_t *data = (adc_digi_output_data_t *)&scan_frame[n];
+			/* The pattern may not start with the first channel: match them by number */
+			for(i = 0; i < qty; i++){
+				if((data->type2.channel == adc_channel[channels[i]]) && (count[i] < samples)){
+					sums[i] += data->type2.data;
+					count[i]++;
+					pending--;
+					break;
+				}
+			}
+		}
+	}
+	adc_continuous_stop(adc_scan);
+	adc_continuous_flush_pool(adc_scan);
+	if((stamp != NULL) && (pending == 0)){
+		/* The frame ended (read_bytes - n) / SOC_ADC_DIGI_RESULT_BYTES conversions after the last one used */
+		TimestampBlock(stamp, read_time - (uint64_t)((read_bytes - n) / SOC_ADC_DIGI_RESULT_BYTES) * US_PER_SEC / ADC_SCAN_FREQ,
+			samples, (uint32_t)qty * US_PER_SEC / ADC_SCAN_FREQ);
+	}
+	return pending == 0;
+}
+
+/**
+ * @brief Waveform generator timer callback: writes one (interpolated) value 
+ * to the DAC and moves to the next sample or buffer
+ */
+static void IRAM_ATTR dac_wave_isr(void *param){
+	const uint8_t *buf = dac_wave.buf;
+	uint16_t index = dac_wave.index;
+	int32_t s0 = buf[index];
+	int32_t s1;
+	if(dac_wave.shift){
+		if(index + 1 < dac_wave.size){
+			s1 = buf[index + 1];
+		} else if(dac_wave.next != NULL){
+			s1 = dac_wave.next[0];
+		} else if(dac_wave.loop){
+			s1 = buf[0];
+		} else {
+			s1 = s0;
+		}
+		s0 += ((s1 - s0) * dac_wave.phase) >> dac_wave.shift;
+	}
+	sdm_channel_set_pulse_density(dac, (int8_t)(s0 - DAC_MIDSCALE));
+	if(++dac_wave.phase < (1 << dac_wave.shift)){
+		return;
+	}
+	dac_wave.phase = 0;
+	if(++index < dac_wave.size){
+		dac_wave.index = index;
+		return;
+	}
+	// end of buffer
+	dac_wave.index = 0;
+	if(dac_wave.next != NULL){
+		dac_wave.size = dac_wave.next_size;
+		dac_wave.buf = dac_wave.next;
+		dac_wave.next = NULL;
+	} else if(!dac_wave.loop){
+		TimerStop(dac_wave.timer);
+		dac_wave.ended = true;
+		dac_wave.running = false;
+	}
+	if(dac_wave.func_p != NULL){
+		dac_wave.func_p(dac_wave.param_p);
+	}
+}
 
 /*==================[external functions definition]==========================*/
 
@@ -48,54 +227,21 @@ void AnalogInputInit(analog_input_config_t *config){
 	switch(config->mode){
 		case ADC_SINGLE:
         	if(!adc1_single_used){
+				adc_mutex = xSemaphoreCreateMutexStatic(&adc_mutex_buffer);
 				adc_oneshot_new_unit(&init_config_single, &adc1_single);
 				adc1_single_used = true;
 			}
-			switch(config->input){
-				case CH0:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_0, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_0 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_0, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_0, &adc_calibration_single_0));
-				break;
-				case CH1:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_1, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_1 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_1, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_1, &adc_calibration_single_1));
-				break;
-				case CH2:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_2, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_2 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_2, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_2, &adc_calibration_single_2));
-				break;
-				case CH3:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_3, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_3 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_3, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_3, &adc_calibration_single_3));
-				break;
+    		adc_oneshot_config_channel(adc1_single, adc_channel[config->input], &adc_config_single);
+			if(!adc_lut_ready[config->input]){
+				// create calibration curve and tabulate it
+				adc_cali_curve_fitting_config_t cali_config = {
+					.unit_id = ADC_UNIT_1,
+					.chan = adc_channel[config->input], 
+					.atten = ADC_ATTENUATION,
+					.bitwidth = ADC_BITWIDTH,
+				};
+				ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config, &adc_calibration_single[config->input]));
+				adc_build_lut(config->input);
 			}
 		break;
 		case ADC_CONTINUOUS:
@@ -127,21 +273,57 @@ void AnalogOutputInit(void){
 	sdm_channel_enable(dac);
 }
 
-void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
-    switch(channel){
-		case CH0:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_0, (int*)value);
-		break;
-		case CH1:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_1, (int*)value);
-		break;
-		case CH2:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_2, (int*)value);
-		break;
-		case CH3:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_3, (int*)value);
-		break;
+bool AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
+	uint16_t raw;
+	if(!AnalogInputReadRaw(channel, &raw)){
+		return false;
+	}
+	*value = adc_to_mv(channel, (uint32_t)raw << OVERSAMPLE_BITS);
+	return true;
+}
+
+bool AnalogInputReadRaw(adc_ch_t channel, uint16_t *value){
+	int raw = 0;
+	esp_err_t err;
+	if(!adc1_single_used || (channel >= ADC_CH_QTY)){
+		return false;
+	}
+	xSemaphoreTake(adc_mutex, portMAX_DELAY);
+	err = adc_oneshot_read(adc1_single, adc_channel[channel], &raw);
+	xSemaphoreGive(adc_mutex);
+	if(err != ESP_OK){
+		return false;
 	}
+	*value = raw;
+	return true;
+}
+
+bool AnalogInputReadOversampled(adc_ch_t channel, uint16_t samples, uint16_t *value){
+	return AnalogInputScan(&channel, 1, samples, value, NULL);
+}
+
+bool AnalogInputScan(const adc_ch_t *channels, uint8_t qty, uint16_t samples, uint16_t *values, timestamp_block_t *stamp){
+	uint32_t sums[ADC_CH_QTY];
+	if((qty == 0) || (qty > ADC_CH_QTY) || (samples < ADC_OVERSAMPLE_MIN) || (samples > ADC_OVERSAMPLE_MAX)){
+		return false;
+	}
+	for(uint8_t i = 0; i < qty; i++){
+		if((channels[i] >= ADC_CH_QTY) || !adc_lut_ready[channels[i]]){
+			return false;
+		}
+	}
+	/* Scans share scan_frame and the continuous handle, and block oneshot reads */
+	xSemaphoreTake(adc_mutex, portMAX_DELAY);
+	bool read = adc_scan_sum(channels, qty, samples, sums, stamp);
+	xSemaphoreGive(adc_mutex);
+	if(!read){
+		return false;
+	}
+	for(uint8_t i = 0; i < qty; i++){
+		/* Average with OVERSAMPLE_BITS fractional bits, rounded */
+		values[i] = adc_to_mv(channels[i], ((sums[i] << OVERSAMPLE_BITS) + samples / 2) / samples);
+	}
+	return true;
 }
 
 void AnalogStartContinuous(adc_ch_t channel){
@@ -157,10 +339,95 @@ void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
 }
 
 void AnalogOutputWrite(uint8_t value){
-	int8_t density = value - 128;
+	int8_t density = value - DAC_MIDSCALE;
 	sdm_channel_set_pulse_density(dac, density);
 }
 
+bool AnalogOutputWaveInit(analog_wave_config_t *config){
+	uint8_t shift = 0;
+	uint32_t update_frec;
+	if((dac == NULL) || (config->samples == NULL) || (config->size == 0) || (config->sample_frec == 0)){
+		return false;
+	}
+	while((1 << shift) < config->interp){
+		shift++;
+	}
+	if((config->interp == 0) || (config->interp > DAC_WAVE_INTERP_MAX) || ((1 << shift) != config->interp)){
+		return false;
+	}
+	update_frec = config->sample_frec << shift;
+	if((update_frec > DAC_WAVE_UPDATE_MAX) || (update_frec < config->sample_frec)){
+		return false;
+	}
+	if(dac_wave.running){
+		AnalogOutputWaveStop();
+	}
+	timer_config_t timer_cfg = {
+		.timer = config->timer,
+		.period = (US_PER_SEC + update_frec / 2) / update_frec,
+		.func_p = dac_wave_isr,
+		.param_p = NULL,
+	};
+	if((dac_wave.buf != NULL) && (dac_wave.timer == config->timer)){
+		// timer already owned by the generator
+		TimerUpdatePeriod(timer_cfg.timer, timer_cfg.period);
+	} else {
+		if(dac_wave.buf != NULL){
+			// release the timer used by the previous waveform
+			TimerDeinit(dac_wave.timer);
+		}
+		TimerInit(&timer_cfg);
+	}
+	dac_wave.timer = config->timer;
+	dac_wave.buf = config->samples;
+	dac_wave.size = config->size;
+	dac_wave.next = NULL;
+	dac_wave.index = 0;
+	dac_wave.phase = 0;
+	dac_wave.shift = shift;
+	dac_wave.loop = config->loop;
+	dac_wave.func_p = config->func_p;
+	dac_wave.param_p = config->param_p;
+	dac_wave.ended = false;
+	return true;
+}
+
+void AnalogOutputWaveStart(void){
+	if((dac_wave.buf != NULL) && !dac_wave.running){
+		if(dac_wave.ended && (dac_wave.next != NULL)){
+			// buffer queued after the previous one ended
+			dac_wave.size = dac_wave.next_size;
+			dac_wave.buf = dac_wave.next;
+			dac_wave.next = NULL;
+		}
+		dac_wave.ended = false;
+		dac_wave.running = true;
+		TimerStart(dac_wave.timer);
+	}
+}
+
+void AnalogOutputWaveStop(void){
+	if(dac_wave.buf != NULL){
+		// also after the playback ended in the ISR: releases the timer power lock
+		TimerStop(dac_wave.timer);
+		dac_wave.running = false;
+	}
+}
+
+bool IRAM_ATTR AnalogOutputWaveQueue(const uint8_t *samples, uint16_t size){
+	if((samples == NULL) || (size == 0) || (dac_wave.next != NULL)){
+		return false;
+	}
+	// size first: the ISR takes the buffer as soon as the pointer is set
+	dac_wave.next_size = size;
+	dac_wave.next = samples;
+	return true;
+}
+
+bool AnalogOutputWaveRunning(void){
+	return dac_wave.running;
+}
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -27,6 +27,8 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+
+#include "timestamp_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define TAG "ble_mcu"
 #define MTU_MAX_BYTES		20	 /* GATT Maximum Transmission Unit */
@@ -69,11 +71,13 @@ typedef struct {
 	size_t length;
 	uint8_t payload[PAYLOAD_SIZE];
 	TaskHandle_t taskHandle;
+	uint64_t time;				/* reception time (us) */
 } CMD_t;
 /*==================[internal data declaration]==============================*/
 char * device_name; /* Device name */
 void (*ble_read_isr_p)(uint8_t * data, uint8_t length);  /* Pointer to callback function for reading data */
 ble_status_t status = BLE_OFF;
+static uint64_t ble_read_time = 0;  /* Reception time of the frame being read */
 static uint16_t spp_handle_table[SPP_IDX_NB];   /* Service database table */
 /* GATT profile struct */
 struct gatts_profile_inst {
@@ -309,6 +313,7 @@ static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 			cmdBuf.command = CMD_BLUETOOTH_DATA;
 			memcpy(cmdBuf.payload, param->write.value, param->write.len);
 			cmdBuf.length = param->write.len;
+			cmdBuf.time = TimestampGet();
 			xQueueSend(xQueueRead, &cmdBuf, 0);
 			break;
 		case ESP_GATTS_EXEC_WRITE_EVT:
@@ -397,6 +402,7 @@ static void read_task(void* pvParameters) {
 	CMD_t cmdBuf;
 	while(1) {
 		xQueueReceive(xQueueRead, &cmdBuf, portMAX_DELAY);
+		ble_read_time = cmdBuf.time;
 		if(ble_read_isr_p != BLE_NO_INT){
             ble_read_isr_p(cmdBuf.payload, cmdBuf.length);
         }
@@ -558,6 +564,10 @@ ble_status_t BleStatus(void){
 	return status;
 }
 
+uint64_t BleReadTimestamp(void){
+	return ble_read_time;
+}
+
 void BleSendByte(const char *data){
 	CMD_t cmdBuf;
 	if(status == BLE_CONNECTED){
@@ -16,11 +16,35 @@
 #include <string.h>
 #include "driver/gpio.h"
 #include "driver/dedic_gpio.h"
+#include "soc/gpio_reg.h"
+#include "soc/soc_caps.h"
+#include "esp_rom_sys.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
 /*==================[macros and definitions]=================================*/
-
+#define BUS_MASK(qty)   ((1UL << (qty)) - 1)
+#define DEDIC_CHANNELS  SOC_DEDIC_GPIO_OUT_CHANNELS_NUM
 /*==================[internal data declaration]==============================*/
+/**
+ * @brief Bus state
+ */
+typedef struct {
+    bool used;
+    dedic_gpio_bundle_handle_t bundle;  /*!< Dedicated GPIO bundle (NULL: output register) */
+    uint32_t mask;                      /*!< Valid bits of the bus */
+    uint32_t strobe;                    /*!< Strobe bits */
+    uint16_t setup_us;                  /*!< Data to strobe delay */
+    uint16_t pulse_us;                  /*!< Strobe pulse width */
+    uint32_t pin_mask[GPIO_BUS_WIDTH_MAX];  /*!< Output register bit of each bus bit */
+    uint8_t pin_qty;
+} gpio_bus_state_t;
+
+static gpio_bus_state_t buses[GPIO_BUS_MAX];
+static uint8_t dedic_used = 0;          /*!< Dedicated GPIO channels taken by buses */
+static const char *TAG = "gpio_fast";
+gpio_bus_t busA = GPIO_BUS_MAX;
 dedic_gpio_bundle_handle_t bundleA = NULL;
-int bundleA_gpios[16];
+uint32_t bundleA_mask = 0;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -28,31 +52,180 @@ int bundleA_gpios[16];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Write bus bits through the GPIO set / clear registers (atomic, no 
+ * read-modify-write): bits cleared first, then bits set, a few cycles later
+ */
+static void IRAM_ATTR gpio_bus_reg_write(gpio_bus_state_t *b, uint32_t mask, uint32_t value){
+    uint32_t set = 0, clr = 0;
+    for(uint8_t i = 0; i < b->pin_qty; i++){
+        if(mask & (1UL << i)){
+            if(value & (1UL << i)){
+                set |= b->pin_mask[i];
+            } else {
+                clr |= b->pin_mask[i];
+            }
+        }
+    }
+    REG_WRITE(GPIO_OUT_W1TC_REG, clr);
+    REG_WRITE(GPIO_OUT_W1TS_REG, set);
+}
 
-/*==================[external functions definition]==========================*/
-
-void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty){
-    memcpy(bundleA_gpios, pin_list, pin_qty);
+/**
+ * @brief Bus initialization, leaving reserve dedicated channels free for 
+ * GPIOFastInit()
+ */
+static bool gpio_bus_init(const gpio_bus_config_t *config, gpio_bus_t *bus, uint8_t reserve){
+    int gpios[GPIO_BUS_WIDTH_MAX];
+    gpio_bus_state_t *b = NULL;
+    if((config->pins == NULL) || (config->pin_qty == 0) || (config->pin_qty > GPIO_BUS_WIDTH_MAX)){
+        return false;
+    }
+    for(gpio_bus_t i = 0; i < GPIO_BUS_MAX; i++){
+        if(!buses[i].used){
+            b = &buses[i];
+            *bus = i;
+            break;
+        }
+    }
+    if(b == NULL){
+        return false;
+    }
     gpio_config_t io_conf = {
         .mode = GPIO_MODE_OUTPUT,
+        .pin_bit_mask = 0,
     };
-    for (int i = 0; i < pin_qty; i++) {
-        io_conf.pin_bit_mask = 1ULL << bundleA_gpios[i];
-        gpio_config(&io_conf);
-    }
-    // Create bundleA, output only
-    dedic_gpio_bundle_config_t bundleA_config = {
-        .gpio_array = bundleA_gpios,
-        .array_size = pin_qty,
+    for(uint8_t i = 0; i < config->pin_qty; i++){
+        gpios[i] = config->pins[i];
+        b->pin_mask[i] = 1UL << config->pins[i];
+        io_conf.pin_bit_mask |= 1ULL << config->pins[i];
+    }
+    gpio_config(&io_conf);
+    b->pin_qty = config->pin_qty;
+    b->mask = BUS_MASK(config->pin_qty);
+    b->strobe = config->strobe & b->mask;
+    b->setup_us = config->setup_us;
+    b->pulse_us = config->pulse_us;
+    // Dedicated GPIO bundle, output only (if there are enough free channels)
+    b->bundle = NULL;
+    dedic_gpio_bundle_config_t bundle_config = {
+        .gpio_array = gpios,
+        .array_size = config->pin_qty,
         .flags = {
             .out_en = 1,
         },
     };
-    ESP_ERROR_CHECK(dedic_gpio_new_bundle(&bundleA_config, &bundleA));
+    if((dedic_used + config->pin_qty + reserve <= DEDIC_CHANNELS) &&
+       (dedic_gpio_new_bundle(&bundle_config, &b->bundle) == ESP_OK)){
+        dedic_used += config->pin_qty;
+    } else{
+        b->bundle = NULL;
+        ESP_LOGW(TAG, "bus %u: no dedicated GPIO channels left, using the GPIO registers", *bus);
+    }
+    b->used = true;
+    GPIOBusWrite(*bus, 0);
+    return true;
 }
 
-void GPIOFastWrite(uint16_t value){
-    dedic_gpio_bundle_write(bundleA, 0xFF, value);
+/*==================[external functions definition]==========================*/
+
+void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty){
+    gpio_bus_config_t config = {
+        .pins = pin_list,
+        .pin_qty = pin_qty,
+        .strobe = 0,
+    };
+    if(gpio_bus_init(&config, &busA, 0)){
+        // keep the bundle to write it without the bus lookup (WS2812B timing)
+        bundleA = buses[busA].bundle;
+        bundleA_mask = buses[busA].mask;
+        if(bundleA == NULL){
+            ESP_LOGE(TAG, "GPIOFastInit without dedicated GPIO channels: WS2812B timing not guaranteed");
+        }
+    }
+}
+
+void IRAM_ATTR GPIOFastWrite(uint16_t value){
+    if(bundleA != NULL){
+        dedic_gpio_bundle_write(bundleA, bundleA_mask, value);
+    } else {
+        GPIOBusWrite(busA, value);
+    }
+}
+
+bool GPIOBusInit(const gpio_bus_config_t *config, gpio_bus_t *bus){
+    return gpio_bus_init(config, bus, (bundleA == NULL) ? GPIO_FAST_RESERVED : 0);
+}
+
+void GPIOBusDeinit(gpio_bus_t bus){
+    if((bus < GPIO_BUS_MAX) && buses[bus].used){
+        if(buses[bus].bundle != NULL){
+            dedic_gpio_del_bundle(buses[bus].bundle);
+            buses[bus].bundle = NULL;
+            dedic_used -= buses[bus].pin_qty;
+        }
+        if(bus == busA){
+            bundleA = NULL;
+            busA = GPIO_BUS_MAX;
+        }
+        buses[bus].used = false;
+    }
+}
+
+void IRAM_ATTR GPIOBusWrite(gpio_bus_t bus, uint32_t value){
+    GPIOBusWriteMasked(bus, 0xFFFFFFFF, value);
+}
+
+void IRAM_ATTR GPIOBusWriteMasked(gpio_bus_t bus, uint32_t mask, uint32_t value){
+    gpio_bus_state_t *b;
+    if((bus >= GPIO_BUS_MAX) || !buses[bus].used){
+        return;
+    }
+    b = &buses[bus];
+    mask &= b->mask;
+    if(b->bundle != NULL){
+        dedic_gpio_bundle_write(b->bundle, mask, value);
+    } else {
+        gpio_bus_reg_write(b, mask, value);
+    }
+}
+
+void IRAM_ATTR GPIOBusStrobe(gpio_bus_t bus, uint32_t value, uint32_t strobe){
+    gpio_bus_state_t *b;
+    if((bus >= GPIO_BUS_MAX) || !buses[bus].used){
+        return;
+    }
+    b = &buses[bus];
+    strobe &= b->strobe;
+    GPIOBusWriteMasked(bus, ~b->strobe, value);
+    if(b->setup_us){
+        esp_rom_delay_us(b->setup_us);
+    }
+    GPIOBusWriteMasked(bus, strobe, strobe);
+    if(b->pulse_us){
+        esp_rom_delay_us(b->pulse_us);
+    }
+    GPIOBusWriteMasked(bus, strobe, 0);
+}
+
+uint32_t GPIOBusRead(gpio_bus_t bus){
+    gpio_bus_state_t *b;
+    uint32_t value = 0;
+    uint32_t out;
+    if((bus >= GPIO_BUS_MAX) || !buses[bus].used){
+        return 0;
+    }
+    b = &buses[bus];
+    if(b->bundle != NULL){
+        return dedic_gpio_bundle_read_out(b->bundle) & b->mask;
+    }
+    out = REG_READ(GPIO_OUT_REG);
+    for(uint8_t i = 0; i < b->pin_qty; i++){
+        if(out & b->pin_mask[i]){
+            value |= 1UL << i;
+        }
+    }
+    return value;
 }
 
-/*==================[end of file]============================================*/
\ No newline at end of file
+/*==================[end of file]============================================*/
@@ -14,6 +14,9 @@
 #include <stdint.h>
 #include "driver/gpio.h"
 #include "driver/gpio_filter.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_attr.h"
+#include "timestamp_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_QTY 	24
 #define FILTER_QTY	8
@@ -23,6 +26,12 @@ typedef struct{
 	gpio_pull_mode_t pull;		/*!< GPIO pull-up/pull-down resistor */
 	bool state;					/*!< GPIO output state */
 } digital_io_t;
+
+typedef struct{
+	void (*func_p)(void *);		/*!< User interrupt callback */
+	void *args;					/*!< User callback parameter */
+	volatile uint64_t edge_time;	/*!< Time of the last edge (us) */
+} gpio_isr_t;
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
@@ -59,9 +68,18 @@ gpio_flex_glitch_filter_config_t filter_config = {
 	.window_width_ns = 700,
 	.window_thres_ns = 600,
 };
+static gpio_isr_t gpio_isr[GPIO_QTY];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief GPIO interrupt: stamps the edge before calling the user callback.
+ */
+static void IRAM_ATTR gpio_isr_handler(void *param){
+	gpio_isr_t *isr = (gpio_isr_t *)param;
+	isr->edge_time = TimestampGet();
+	isr->func_p(isr->args);
+}
 
 /*==================[external functions definition]==========================*/
 void GPIOInit(gpio_t pin, io_t io){
@@ -113,7 +131,27 @@ void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args){
 		gpio_install_isr_service(0);
 		isr_service_installed = true;
 	}
-    gpio_isr_handler_add(gpio_list[pin].pin, ptr_int_func, (void *)args);	
+	gpio_isr[pin].func_p = ptr_int_func;
+	gpio_isr[pin].args = args;
+	gpio_isr[pin].edge_time = 0;
+	gpio_isr_handler_add(gpio_list[pin].pin, gpio_isr_handler, &gpio_isr[pin]);
+}
+
+void GPIOIntEnable(gpio_t pin){
+	gpio_intr_enable(gpio_list[pin].pin);
+}
+
+void GPIOIntDisable(gpio_t pin){
+	gpio_intr_disable(gpio_list[pin].pin);
+}
+
+uint64_t GPIOReadEdgeTime(gpio_t pin){
+	uint64_t time;
+	/* 64 bit read is not atomic: repeat if an edge arrives in between */
+	do{
+		time = gpio_isr[pin].edge_time;
+	} while(time != gpio_isr[pin].edge_time);
+	return time;
 }
 
 void GPIOInputFilter(gpio_t pin){
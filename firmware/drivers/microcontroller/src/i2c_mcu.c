@@ -17,6 +17,7 @@
 //#include "sdkconfig.h"
 
 #include "i2c_mcu.h"
+#include "trace_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define I2C_NUM I2C_NUM_0
 
@@ -125,6 +126,7 @@ int8_t I2C_readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t ti
  */
 int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
 	i2c_cmd_handle_t cmd;
+	TRACE_ENTER(TRACE_I2C);
 	I2C_SelectRegister(devAddr, regAddr);
 
 	cmd = i2c_cmd_link_create();
@@ -139,6 +141,7 @@ int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *
 	ESP_ERROR_CHECK(i2c_master_stop(cmd));
 	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
 	i2c_cmd_link_delete(cmd);
+	TRACE_EXIT(TRACE_I2C);
 
 	return length;
 }
@@ -235,6 +238,7 @@ bool I2C_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
  */
 bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data){
 	i2c_cmd_handle_t cmd;
+	TRACE_ENTER(TRACE_I2C);
 
 	cmd = i2c_cmd_link_create();
 	ESP_ERROR_CHECK(i2c_master_start(cmd));
@@ -245,6 +249,7 @@ bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *d
 	ESP_ERROR_CHECK(i2c_master_stop(cmd));
 	i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS);
 	i2c_cmd_link_delete(cmd);
+	TRACE_EXIT(TRACE_I2C);
 	return true;
 }
 
@@ -0,0 +1,431 @@
+/**
+ * @file logger_mcu.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "logger_mcu.h"
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_partition.h"
+#include "timestamp_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define LOGGER_MAGIC			0x474F4C44		/*!< "DLOG" */
+#define LOGGER_EMPTY			0x59544D45		/*!< "EMTY": erased sector, only keeps its erase count */
+#define LOGGER_SUBTYPE			0x40			/*!< Partition subtype (data) */
+#define LOGGER_SECTOR_SIZE		4096			/*!< Flash erase unit */
+#define LOGGER_BLOCKS_SECTOR	(LOGGER_SECTOR_SIZE / LOGGER_BLOCK_SIZE)
+#define LOGGER_HEADER_SIZE		sizeof(logger_header_t)
+#define LOGGER_RECORD_MAX		(1 + 10 + LOGGER_CHANNELS_MAX * 5)	/*!< id, time and values (varints) */
+#define LOGGER_KEY				0x80			/*!< Record flag: absolute values */
+#define LOGGER_STACK_SIZE		3072
+#define LOGGER_UART_CHUNK		256				/*!< Bytes read from the flash for each UART transfer */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Block header. Records follow: id (| LOGGER_KEY), time and values.
+ *
+ * The time of the first record is absolute (us), the others store the
+ * difference with the previous record. Values are zigzag varints, the
+ * difference with the previous sample of the source unless it is the first
+ * record of the source in the block (LOGGER_KEY).
+ */
+typedef struct {
+	uint32_t magic;		/*!< LOGGER_MAGIC, LOGGER_EMPTY or 0xFFFFFFFF (erased block) */
+	uint32_t seq;		/*!< Block number since the log was created */
+	uint32_t erases;	/*!< Erase count of the sector */
+	uint16_t used;		/*!< Bytes used, header included */
+	uint16_t crc;		/*!< CRC-16/CCITT of the records */
+} logger_header_t;
+
+typedef struct {
+	logger_source_t source;
+	int32_t last[LOGGER_CHANNELS_MAX];	/*!< Last sample stored */
+} logger_src_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const esp_partition_t *partition = NULL;
+static uint32_t blocks_total;
+static uint32_t blocks_used;
+static uint32_t block_next;		/*!< Next block to write (position in the partition) */
+static uint32_t block_seq;		/*!< Sequence number of the next block */
+static uint32_t sector_erases;	/*!< Erase count of the sector being written */
+static uint32_t erase_max;
+static uint32_t dropped;
+
+static uint8_t buffers[LOGGER_BUFFERS][LOGGER_BLOCK_SIZE];
+static uint8_t fill_idx;		/*!< Buffer being filled (if full_qty < LOGGER_BUFFERS) */
+static uint8_t write_idx;		/*!< Oldest buffer waiting for the writer task */
+static volatile uint8_t full_qty;
+static uint16_t buffer_used;	/*!< Bytes used in the buffer being filled */
+static uint8_t buffer_keyed;	/*!< Sources with absolute values in the buffer being filled */
+static int64_t buffer_time;		/*!< Time of the last record in the buffer being filled */
+
+static logger_src_t sources[LOGGER_SOURCES_MAX];
+static uint8_t source_qty = 0;
+
+static portMUX_TYPE logger_mux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t writer_task = NULL;
+static SemaphoreHandle_t flash_mutex = NULL;	/*!< Writer task and export */
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint16_t logger_crc(const uint8_t *data, uint32_t size){
+	uint16_t crc = 0xFFFF;
+	for(uint32_t i = 0; i < size; i++){
+		crc ^= (uint16_t)data[i] << 8;
+		for(uint8_t b = 0; b < 8; b++){
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+		}
+	}
+	return crc;
+}
+
+static uint8_t logger_varint(uint8_t *out, uint64_t value){
+	uint8_t n = 0;
+	while(value >= 0x80){
+		out[n++] = (value & 0x7F) | 0x80;
+		value >>= 7;
+	}
+	out[n++] = value;
+	return n;
+}
+
+/**
+ * @brief Small positive and negative values to small unsigned values (0, -1, 1, -2... -> 0, 1, 2, 3...).
+ */
+static inline uint32_t logger_zigzag(int32_t value){
+	return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+/**
+ * @brief Encode a record for the buffer being filled (called with logger_mux taken).
+ */
+static uint8_t logger_encode(uint8_t *record, int8_t id, const int32_t *values, int64_t time){
+	const logger_src_t *src = &sources[id];
+	bool key = !src->source.delta || !(buffer_keyed & (1 << id));
+	bool first = (buffer_used == LOGGER_HEADER_SIZE);
+	uint8_t size = 0;
+
+	record[size++] = id | (key ? LOGGER_KEY : 0);
+	size += logger_varint(&record[size], first ? (uint64_t)time : (uint64_t)(time - buffer_time));
+	for(uint8_t ch = 0; ch < src->source.channels; ch++){
+		size += logger_varint(&record[size], logger_zigzag(key ? values[ch] : (int32_t)((uint32_t)values[ch] - (uint32_t)src->last[ch])));
+	}
+	return size;
+}
+
+/**
+ * @brief Start filling a buffer.
+ */
+static void logger_buffer_reset(void){
+	buffer_used = LOGGER_HEADER_SIZE;
+	buffer_keyed = 0;
+}
+
+/**
+ * @brief Pass the buffer being filled to the writer task (called with logger_mux taken).
+ */
+static void logger_buffer_close(void){
+	((logger_header_t *)buffers[fill_idx])->used = buffer_used;
+	fill_idx = (fill_idx + 1) % LOGGER_BUFFERS;
+	full_qty++;
+	if(full_qty < LOGGER_BUFFERS){
+		logger_buffer_reset();
+	}
+}
+
+static void logger_notify(void){
+	if(xPortInIsrContext()){
+		BaseType_t higher_woken = pdFALSE;
+		vTaskNotifyGiveFromISR(writer_task, &higher_woken);
+		portYIELD_FROM_ISR(higher_woken);
+	} else{
+		xTaskNotifyGive(writer_task);
+	}
+}
+
+/**
+ * @brief Erase a sector before writing its first block, keeping its erase count.
+ */
+static void logger_erase_sector(uint32_t sector){
+	logger_header_t old;
+	esp_partition_read(partition, sector * LOGGER_SECTOR_SIZE, &old, sizeof(old));
+	if(old.magic == LOGGER_MAGIC){
+		/* The oldest sector of a full log: its blocks are lost */
+		sector_erases = old.erases + 1;
+		blocks_used = (blocks_used > LOGGER_BLOCKS_SECTOR) ? blocks_used - LOGGER_BLOCKS_SECTOR : 0;
+	} else if(old.magic == LOGGER_EMPTY){
+		sector_erases = old.erases + 1;
+	} else{
+		sector_erases = 1;
+	}
+	if(sector_erases > erase_max){
+		erase_max = sector_erases;
+	}
+	esp_partition_erase_range(partition, sector * LOGGER_SECTOR_SIZE, LOGGER_SECTOR_SIZE);
+}
+
+static void logger_write_block(uint8_t *block){
+	logger_header_t *header = (logger_header_t *)block;
+	xSemaphoreTake(flash_mutex, portMAX_DELAY);
+	if(block_next % LOGGER_BLOCKS_SECTOR == 0){
+		logger_erase_sector(block_next / LOGGER_BLOCKS_SECTOR);
+	}
+	header->magic = LOGGER_MAGIC;
+	header->seq = block_seq++;
+	header->erases = sector_erases;
+	header->crc = logger_crc(block + LOGGER_HEADER_SIZE, header->used - LOGGER_HEADER_SIZE);
+	/* The unused bytes stay erased */
+	memset(block + header->used, 0xFF, LOGGER_BLOCK_SIZE - header->used);
+	esp_partition_write(partition, block_next * LOGGER_BLOCK_SIZE, block, LOGGER_BLOCK_SIZE);
+	block_next = (block_next + 1) % blocks_total;
+	if(blocks_used < blocks_total){
+		blocks_used++;
+	}
+	xSemaphoreGive(flash_mutex);
+}
+
+/**
+ * @brief Send a text line (after the binary data the UART FIFO can be full).
+ */
+static void logger_send_line(uart_mcu_port_t port, const char *line){
+	UartSendBufferWait(port, line, strlen(line));
+}
+
+static void logger_writer_task(void *param){
+	while(true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		while(full_qty > 0){
+			logger_write_block(buffers[write_idx]);
+			portENTER_CRITICAL(&logger_mux);
+			write_idx = (write_idx + 1) % LOGGER_BUFFERS;
+			if(full_qty-- == LOGGER_BUFFERS){
+				/* There was no buffer to fill: the one just written */
+				logger_buffer_reset();
+			}
+			portEXIT_CRITICAL(&logger_mux);
+		}
+	}
+}
+
+/**
+ * @brief Find the last block written: the first block of each sector has the
+ * highest sequence number of the newest sector.
+ */
+static void logger_scan(void){
+	logger_header_t header;
+	uint32_t sectors = blocks_total / LOGGER_BLOCKS_SECTOR;
+	uint32_t head = 0, head_seq = 0, b;
+	bool found = false;
+
+	blocks_used = 0;
+	erase_max = 0;
+	for(uint32_t s = 0; s < sectors; s++){
+		esp_partition_read(partition, s * LOGGER_SECTOR_SIZE, &header, sizeof(header));
+		if((header.magic == LOGGER_MAGIC) || (header.magic == LOGGER_EMPTY)){
+			if(header.erases > erase_max){
+				erase_max = header.erases;
+			}
+		}
+		if(header.magic != LOGGER_MAGIC){
+			continue;
+		}
+		blocks_used += LOGGER_BLOCKS_SECTOR;
+		if(!found || ((int32_t)(header.seq - head_seq) > 0)){
+			head = s;
+			head_seq = header.seq;
+			found = true;
+		}
+	}
+	block_seq = 0;
+	block_next = 0;
+	if(!found){
+		return;
+	}
+	/* The newest sector can be partially written */
+	blocks_used -= LOGGER_BLOCKS_SECTOR;
+	for(b = 0; b < LOGGER_BLOCKS_SECTOR; b++){
+		esp_partition_read(partition, (head * LOGGER_BLOCKS_SECTOR + b) * LOGGER_BLOCK_SIZE, &header, sizeof(header));
+		if(header.magic != LOGGER_MAGIC){
+			break;
+		}
+		block_seq = header.seq + 1;
+		sector_erases = header.erases;
+		blocks_used++;
+	}
+	block_next = (head * LOGGER_BLOCKS_SECTOR + b) % blocks_total;
+}
+/*==================[external functions definition]==========================*/
+bool LoggerInit(const logger_config_t *config){
+	const char *label = (config->partition != NULL) ? config->partition : LOGGER_PARTITION;
+	if(partition != NULL){
+		return true;
+	}
+	const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, LOGGER_SUBTYPE, label);
+	if((part == NULL) || (part->size < 2 * LOGGER_SECTOR_SIZE)){
+		return false;
+	}
+	blocks_total = (part->size / LOGGER_SECTOR_SIZE) * LOGGER_BLOCKS_SECTOR;
+	flash_mutex = xSemaphoreCreateMutex();
+	if(flash_mutex == NULL){
+		return false;
+	}
+	partition = part;
+	logger_scan();
+	fill_idx = 0;
+	write_idx = 0;
+	full_qty = 0;
+	logger_buffer_reset();
+	if(xTaskCreate(logger_writer_task, "logger", LOGGER_STACK_SIZE, NULL, config->priority, &writer_task) != pdPASS){
+		partition = NULL;
+		return false;
+	}
+	return true;
+}
+
+int8_t LoggerAddSource(const logger_source_t *source){
+	if((source_qty >= LOGGER_SOURCES_MAX) || (source->channels == 0) || (source->channels > LOGGER_CHANNELS_MAX)){
+		return -1;
+	}
+	sources[source_qty].source = *source;
+	memset(sources[source_qty].last, 0, sizeof(sources[source_qty].last));
+	return source_qty++;
+}
+
+bool LoggerWrite(int8_t source, const int32_t *values){
+	uint8_t record[LOGGER_RECORD_MAX];
+	uint8_t size;
+	bool stored = false, notify = false;
+	if((partition == NULL) || (source < 0) || (source >= source_qty)){
+		return false;
+	}
+	logger_src_t *src = &sources[source];
+
+	portENTER_CRITICAL_SAFE(&logger_mux);
+	/* Read inside the critical section: times always increase in the buffer */
+	int64_t time = (int64_t)TimestampGet();
+	/* Second attempt in a new buffer (the record is encoded again as the first one) */
+	for(uint8_t attempt = 0; (attempt < 2) && (full_qty < LOGGER_BUFFERS); attempt++){
+		size = logger_encode(record, source, values, time);
+		if(buffer_used + size <= LOGGER_BLOCK_SIZE){
+			memcpy(&buffers[fill_idx][buffer_used], record, size);
+			buffer_used += size;
+			buffer_time = time;
+			buffer_keyed |= 1 << source;
+			memcpy(src->last, values, src->source.channels * sizeof(int32_t));
+			stored = true;
+			break;
+		}
+		logger_buffer_close();
+		notify = true;
+	}
+	if(!stored){
+		dropped++;
+	}
+	portEXIT_CRITICAL_SAFE(&logger_mux);
+	if(notify){
+		logger_notify();
+	}
+	return stored;
+}
+
+void LoggerFlush(void){
+	bool notify = false;
+	if(partition == NULL){
+		return;
+	}
+	portENTER_CRITICAL(&logger_mux);
+	if((full_qty < LOGGER_BUFFERS) && (buffer_used > LOGGER_HEADER_SIZE)){
+		logger_buffer_close();
+		notify = true;
+	}
+	portEXIT_CRITICAL(&logger_mux);
+	if(notify){
+		xTaskNotifyGive(writer_task);
+	}
+	while(full_qty > 0){
+		vTaskDelay(pdMS_TO_TICKS(10));
+	}
+}
+
+void LoggerErase(void){
+	logger_header_t header;
+	if(partition == NULL){
+		return;
+	}
+	LoggerFlush();
+	xSemaphoreTake(flash_mutex, portMAX_DELAY);
+	/* Sector by sector, leaving an empty header with the erase count (wear leveling) */
+	erase_max = 0;
+	for(uint32_t s = 0; s < blocks_total / LOGGER_BLOCKS_SECTOR; s++){
+		esp_partition_read(partition, s * LOGGER_SECTOR_SIZE, &header, sizeof(header));
+		header.erases = ((header.magic == LOGGER_MAGIC) || (header.magic == LOGGER_EMPTY)) ? header.erases + 1 : 1;
+		header.magic = LOGGER_EMPTY;
+		header.seq = 0;
+		header.used = LOGGER_HEADER_SIZE;
+		header.crc = 0;
+		esp_partition_erase_range(partition, s * LOGGER_SECTOR_SIZE, LOGGER_SECTOR_SIZE);
+		esp_partition_write(partition, s * LOGGER_SECTOR_SIZE, &header, sizeof(header));
+		if(header.erases > erase_max){
+			erase_max = header.erases;
+		}
+	}
+	sector_erases = 0;
+	blocks_used = 0;
+	block_next = 0;
+	block_seq = 0;
+	xSemaphoreGive(flash_mutex);
+}
+
+void LoggerStatus(logger_status_t *status){
+	status->blocks_used = blocks_used;
+	status->blocks_total = blocks_total;
+	status->dropped = dropped;
+	status->erase_max = erase_max;
+}
+
+void LoggerExport(uart_mcu_port_t port){
+	char chunk[LOGGER_UART_CHUNK];
+	uint32_t first, count, address;
+	if(partition == NULL){
+		return;
+	}
+	LoggerFlush();
+	xSemaphoreTake(flash_mutex, portMAX_DELAY);
+	count = blocks_used;
+	first = (block_next + blocks_total - blocks_used) % blocks_total;
+	xSemaphoreGive(flash_mutex);
+
+	snprintf(chunk, sizeof(chunk), "#LOG,%u,%lu\r\n", LOGGER_BLOCK_SIZE, count);
+	logger_send_line(port, chunk);
+	for(uint8_t i = 0; i < source_qty; i++){
+		snprintf(chunk, sizeof(chunk), "#SRC,%u,%s,%u,%u\r\n", i, sources[i].source.name,
+			sources[i].source.channels, sources[i].source.delta);
+		logger_send_line(port, chunk);
+	}
+	logger_send_line(port, "#DATA\r\n");
+	/* Block by block: the writer task only waits for one block. If the log wraps
+	 * around meanwhile newer blocks are sent, the decoder sorts them by sequence */
+	for(uint32_t i = 0; i < count; i++){
+		address = ((first + i) % blocks_total) * LOGGER_BLOCK_SIZE;
+		xSemaphoreTake(flash_mutex, portMAX_DELAY);
+		for(uint32_t offset = 0; offset < LOGGER_BLOCK_SIZE; offset += LOGGER_UART_CHUNK){
+			esp_partition_read(partition, address + offset, chunk, LOGGER_UART_CHUNK);
+			UartSendBufferWait(port, chunk, LOGGER_UART_CHUNK);
+		}
+		xSemaphoreGive(flash_mutex);
+	}
+	logger_send_line(port, "\r\n#END\r\n");
+}
+
+/*==================[end of file]============================================*/
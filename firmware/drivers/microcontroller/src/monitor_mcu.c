@@ -0,0 +1,188 @@
+/**
+ * @file monitor_mcu.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "monitor_mcu.h"
+#include <stdio.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "esp_system.h"
+#include "ble_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define MONITOR_STACK_SIZE	3072
+#define MONITOR_LINE_SIZE	64
+/*==================[internal data declaration]==============================*/
+typedef struct {
+	QueueHandle_t queue;
+	const char *name;
+} monitor_queue_t;
+
+typedef struct {
+	const char *name;
+	volatile uint32_t count;	/*!< Incremented by MonitorIsrCount() */
+	uint32_t last;				/*!< Count at the last report */
+} monitor_isr_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static monitor_config_t monitor_config;
+static monitor_queue_t monitor_queues[MONITOR_QUEUES_MAX];
+static uint8_t monitor_queue_qty = 0;
+static monitor_isr_t monitor_isr[MONITOR_ISR_MAX];
+static uint8_t monitor_isr_qty = 0;
+
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY
+static TaskStatus_t monitor_tasks[MONITOR_TASKS_MAX];
+/* Run time counters of the last report, by task number */
+static UBaseType_t last_task_number[MONITOR_TASKS_MAX];
+static configRUN_TIME_COUNTER_TYPE last_task_time[MONITOR_TASKS_MAX];
+static UBaseType_t last_task_qty = 0;
+#endif
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY
+static void monitor_send(const char *line){
+	if(monitor_config.output == MONITOR_BLE){
+		BleSendString(line);
+	} else{
+		UartSendString(monitor_config.port, line);
+	}
+}
+
+/**
+ * @brief Run time of a task in the last report (0 for new tasks).
+ */
+static configRUN_TIME_COUNTER_TYPE monitor_last_time(UBaseType_t number){
+	for(UBaseType_t i = 0; i < last_task_qty; i++){
+		if(last_task_number[i] == number){
+			return last_task_time[i];
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief CPU use in per mille with one decimal (-1 without run time stats).
+ */
+static void monitor_permille(char *text, size_t size, configRUN_TIME_COUNTER_TYPE time, configRUN_TIME_COUNTER_TYPE total){
+	if(total == 0){
+		snprintf(text, size, "-1");
+		return;
+	}
+	uint32_t permille = (uint32_t)(((uint64_t)time * 1000 + total / 2) / total);
+	snprintf(text, size, "%lu.%lu", permille / 10, permille % 10);
+}
+
+static void monitor_task(void *param){
+	char line[MONITOR_LINE_SIZE];
+	char cpu[8];
+	configRUN_TIME_COUNTER_TYPE total, last_total = 0, elapsed, idle, time;
+	int64_t now_us, last_us = esp_timer_get_time();
+	uint32_t elapsed_ms, count;
+	UBaseType_t task_qty;
+	TickType_t wake = xTaskGetTickCount();
+
+	while(true){
+		vTaskDelayUntil(&wake, pdMS_TO_TICKS(monitor_config.period_ms));
+		now_us = esp_timer_get_time();
+		elapsed_ms = (uint32_t)((now_us - last_us) / 1000);
+		last_us = now_us;
+		task_qty = uxTaskGetSystemState(monitor_tasks, MONITOR_TASKS_MAX, &total);
+		/* Run time of all cores (0 without CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS) */
+		elapsed = (total - last_total) * portNUM_PROCESSORS;
+		last_total = total;
+
+		idle = 0;
+		for(UBaseType_t i = 0; i < task_qty; i++){
+			if(strncmp(monitor_tasks[i].pcTaskName, "IDLE", 4) == 0){
+				idle += monitor_tasks[i].ulRunTimeCounter - monitor_last_time(monitor_tasks[i].xTaskNumber);
+			}
+		}
+		monitor_permille(cpu, sizeof(cpu), idle, elapsed);
+		snprintf(line, sizeof(line), "#MON,%lu,%s,%lu,%lu\r\n", (uint32_t)(now_us / 1000), cpu,
+			esp_get_free_heap_size(), esp_get_minimum_free_heap_size());
+		monitor_send(line);
+
+		for(UBaseType_t i = 0; i < task_qty; i++){
+			time = monitor_tasks[i].ulRunTimeCounter - monitor_last_time(monitor_tasks[i].xTaskNumber);
+			monitor_permille(cpu, sizeof(cpu), time, elapsed);
+			snprintf(line, sizeof(line), "T,%s,%u,%s,%lu\r\n", monitor_tasks[i].pcTaskName,
+				(unsigned)monitor_tasks[i].uxCurrentPriority, cpu, (uint32_t)monitor_tasks[i].usStackHighWaterMark);
+			monitor_send(line);
+		}
+		for(UBaseType_t i = 0; i < task_qty; i++){
+			last_task_number[i] = monitor_tasks[i].xTaskNumber;
+			last_task_time[i] = monitor_tasks[i].ulRunTimeCounter;
+		}
+		last_task_qty = task_qty;
+
+		for(uint8_t i = 0; i < monitor_queue_qty; i++){
+			UBaseType_t used = uxQueueMessagesWaiting(monitor_queues[i].queue);
+			snprintf(line, sizeof(line), "Q,%s,%u,%u\r\n", monitor_queues[i].name, (unsigned)used,
+				(unsigned)(used + uxQueueSpacesAvailable(monitor_queues[i].queue)));
+			monitor_send(line);
+		}
+		for(uint8_t i = 0; i < monitor_isr_qty; i++){
+			count = monitor_isr[i].count;
+			snprintf(line, sizeof(line), "I,%s,%lu\r\n", monitor_isr[i].name,
+				(elapsed_ms > 0) ? (uint32_t)(((uint64_t)(count - monitor_isr[i].last) * 1000) / elapsed_ms) : 0);
+			monitor_isr[i].last = count;
+			monitor_send(line);
+		}
+	}
+}
+#endif
+/*==================[external functions definition]==========================*/
+bool MonitorInit(const monitor_config_t *config){
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY
+	if(config->period_ms == 0){
+		return false;
+	}
+	monitor_config = *config;
+	return xTaskCreate(monitor_task, "monitor", MONITOR_STACK_SIZE, NULL, config->priority, NULL) == pdPASS;
+#else
+	return false;
+#endif
+}
+
+bool MonitorAddQueue(void *queue, const char *name){
+	if((queue == NULL) || (monitor_queue_qty >= MONITOR_QUEUES_MAX)){
+		return false;
+	}
+	monitor_queues[monitor_queue_qty].queue = (QueueHandle_t)queue;
+	monitor_queues[monitor_queue_qty].name = name;
+	monitor_queue_qty++;
+	return true;
+}
+
+int8_t MonitorAddIsr(const char *name){
+	if(monitor_isr_qty >= MONITOR_ISR_MAX){
+		return -1;
+	}
+	monitor_isr[monitor_isr_qty].name = name;
+	monitor_isr[monitor_isr_qty].count = 0;
+	monitor_isr[monitor_isr_qty].last = 0;
+	return monitor_isr_qty++;
+}
+
+void IRAM_ATTR MonitorIsrCount(int8_t id){
+	if((id >= 0) && (id < monitor_isr_qty)){
+		__atomic_fetch_add(&monitor_isr[id].count, 1, __ATOMIC_RELAXED);
+	}
+}
+
+/*==================[end of file]============================================*/
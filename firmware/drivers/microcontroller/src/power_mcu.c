@@ -0,0 +1,84 @@
+/**
+ * @file power_mcu.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "power_mcu.h"
+#include <stdio.h>
+#include "esp_pm.h"
+#include "esp_sleep.h"
+#include "driver/gpio.h"
+#include "driver/uart.h"
+/*==================[macros and definitions]=================================*/
+#define UART_WAKEUP_MIN_EDGES	3		/*!< Min threshold accepted by the UART */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool PowerInit(const power_config_t *config){
+	if((config->max_freq_mhz > POWER_FREQ_MAX_MHZ) || (config->min_freq_mhz < POWER_FREQ_MIN_MHZ) ||
+	   (config->min_freq_mhz > config->max_freq_mhz)){
+		return false;
+	}
+	esp_pm_config_t pm_config = {
+		.max_freq_mhz = config->max_freq_mhz,
+		.min_freq_mhz = config->min_freq_mhz,
+		.light_sleep_enable = config->light_sleep,
+	};
+	return esp_pm_configure(&pm_config) == ESP_OK;
+}
+
+bool PowerWakeOnGpio(gpio_t pin, bool level){
+	if(gpio_wakeup_enable(pin, level ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL) != ESP_OK){
+		return false;
+	}
+	return esp_sleep_enable_gpio_wakeup() == ESP_OK;
+}
+
+bool PowerWakeOnUart(uart_mcu_port_t port, uint8_t edges){
+	uart_port_t uart_num = (port == UART_PC) ? UART_NUM_0 : UART_NUM_1;
+	if(edges < UART_WAKEUP_MIN_EDGES){
+		edges = UART_WAKEUP_MIN_EDGES;
+	}
+	if(uart_set_wakeup_threshold(uart_num, edges) != ESP_OK){
+		return false;
+	}
+	return esp_sleep_enable_uart_wakeup(uart_num) == ESP_OK;
+}
+
+bool PowerLockCreate(power_lock_type_t type, const char *name, power_lock_t *lock){
+	esp_pm_lock_type_t pm_type = (type == POWER_LOCK_CPU_MAX) ? ESP_PM_CPU_FREQ_MAX : ESP_PM_NO_LIGHT_SLEEP;
+	return esp_pm_lock_create(pm_type, 0, name, (esp_pm_lock_handle_t *)lock) == ESP_OK;
+}
+
+void PowerLockAcquire(power_lock_t lock){
+	if(lock != NULL){
+		esp_pm_lock_acquire((esp_pm_lock_handle_t)lock);
+	}
+}
+
+void PowerLockRelease(power_lock_t lock){
+	if(lock != NULL){
+		esp_pm_lock_release((esp_pm_lock_handle_t)lock);
+	}
+}
+
+void PowerPrintStats(void){
+	esp_pm_dump_locks(stdout);
+}
+
+/*==================[end of file]============================================*/
@@ -1,20 +1,24 @@
 /**
  * @file pwm_mcu.c
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
- * @brief 
+ * @brief
  * @version 0.1
  * @date 2024-01-23
- * 
+ *
  * @copyright Copyright (c) 2023
- * 
+ *
  */
 
 /*==================[inclusions]=============================================*/
 #include "pwm_mcu.h"
 #include "driver/ledc.h"
+#include "freertos/FreeRTOS.h"
 /*==================[macros and definitions]=================================*/
-#define DC_MAX  1023
-#define DC_100  100
+#define DC_100  		100
+#define PWM_QTY			4
+#define SRC_CLK_HZ		80000000	/*!< LEDC source clock (PLL_F80M) */
+#define MAX_BITS		(LEDC_TIMER_BIT_MAX - 2)	/*!< Max duty resolution (100% must fit: one bit below the timer width) */
+#define MIN_BITS		1
 /*==================[internal data declaration]==============================*/
 static ledc_timer_config_t pwm_timer_cfg = {
     .speed_mode       = LEDC_LOW_SPEED_MODE,
@@ -27,6 +31,12 @@ static ledc_channel_config_t ledc_channel_cfg = {
     .duty           = 0,       /*!< Starts in 0% */
     .hpoint         = 0
 };
+static const ledc_timer_t pwm_timer[PWM_QTY] = {LEDC_TIMER_0, LEDC_TIMER_1, LEDC_TIMER_2, LEDC_TIMER_3};
+static const ledc_channel_t pwm_channel[PWM_QTY] = {LEDC_CHANNEL_0, LEDC_CHANNEL_1, LEDC_CHANNEL_2, LEDC_CHANNEL_3};
+static uint8_t pwm_bits[PWM_QTY];		/*!< Duty resolution of each output */
+static uint32_t pwm_duty[PWM_QTY];		/*!< Last duty cycle of each output (in counts) */
+static bool fade_installed = false;		/*!< LEDC fade service installed */
+static portMUX_TYPE pwm_mux = portMUX_INITIALIZER_UNLOCKED;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -34,143 +44,196 @@ static ledc_channel_config_t ledc_channel_cfg = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Highest duty resolution for a PWM frequency (clock divider >= 1)
+ */
+static uint8_t pwm_resolution(uint32_t freq){
+    uint8_t bits = MAX_BITS;
+    while((bits > MIN_BITS) && ((SRC_CLK_HZ >> bits) < freq)){
+        bits--;
+    }
+    return bits;
+}
+
+/**
+ * @brief Configure the timer of an output, lowering the resolution until
+ * the LEDC accepts the frequency.
+ */
+static void pwm_timer_config(pwm_out_t out, uint32_t freq){
+    pwm_timer_cfg.freq_hz = freq;
+    pwm_timer_cfg.timer_num = pwm_timer[out];
+    pwm_timer_cfg.duty_resolution = pwm_resolution(freq);
+    while((ledc_timer_config(&pwm_timer_cfg) != ESP_OK) && (pwm_timer_cfg.duty_resolution > MIN_BITS)){
+        pwm_timer_cfg.duty_resolution--;
+    }
+    pwm_bits[out] = pwm_timer_cfg.duty_resolution;
+}
+
+static void pwm_write_duty(pwm_out_t out, uint32_t duty){
+    if(duty > PWMGetMaxDuty(out)){
+        duty = PWMGetMaxDuty(out);
+    }
+    pwm_duty[out] = duty;
+    if(fade_installed){
+#if SOC_LEDC_SUPPORT_FADE_STOP
+        ledc_fade_stop(LEDC_LOW_SPEED_MODE, pwm_channel[out]);
+#endif
+        ledc_set_duty_and_update(LEDC_LOW_SPEED_MODE, pwm_channel[out], duty, 0);
+    } else{
+        ledc_set_duty(LEDC_LOW_SPEED_MODE, pwm_channel[out], duty);
+        ledc_update_duty(LEDC_LOW_SPEED_MODE, pwm_channel[out]);
+    }
+}
 
 /*==================[external functions definition]==========================*/
 uint8_t PWMInit(pwm_out_t out, gpio_t gpio, uint16_t freq){
-    switch(out){
-        case PWM_0:
-            pwm_timer_cfg.freq_hz = freq;
-            pwm_timer_cfg.timer_num = LEDC_TIMER_0;
-            ledc_timer_config(&pwm_timer_cfg);
-            ledc_channel_cfg.channel = LEDC_CHANNEL_0;
-            ledc_channel_cfg.timer_sel = LEDC_TIMER_0;
-            ledc_channel_cfg.gpio_num = gpio;
-            ledc_channel_config(&ledc_channel_cfg);
-            break;
-        case PWM_1:
-            pwm_timer_cfg.freq_hz = freq;
-            pwm_timer_cfg.timer_num = LEDC_TIMER_1;
-            ledc_timer_config(&pwm_timer_cfg);
-            ledc_channel_cfg.channel = LEDC_CHANNEL_1;
-            ledc_channel_cfg.timer_sel = LEDC_TIMER_1;
-            ledc_channel_cfg.gpio_num = gpio;
-            ledc_channel_config(&ledc_channel_cfg);
-            break;
-        case PWM_2:
-            pwm_timer_cfg.freq_hz = freq;
-            pwm_timer_cfg.timer_num = LEDC_TIMER_2;
-            ledc_timer_config(&pwm_timer_cfg);
-            ledc_channel_cfg.channel = LEDC_CHANNEL_2;
-            ledc_channel_cfg.timer_sel = LEDC_TIMER_2;
-            ledc_channel_cfg.gpio_num = gpio;
-            ledc_channel_config(&ledc_channel_cfg);
-            break;
-        case PWM_3:
-            pwm_timer_cfg.freq_hz = freq;
-            pwm_timer_cfg.timer_num = LEDC_TIMER_3;
-            ledc_timer_config(&pwm_timer_cfg);
-            ledc_channel_cfg.channel = LEDC_CHANNEL_3;
-            ledc_channel_cfg.timer_sel = LEDC_TIMER_3;
-            ledc_channel_cfg.gpio_num = gpio;
-            ledc_channel_config(&ledc_channel_cfg);
-            break;
+    if(out >= PWM_QTY){
+        return 1;
     }
+    pwm_timer_config(out, freq);
+    ledc_channel_cfg.channel = pwm_channel[out];
+    ledc_channel_cfg.timer_sel = pwm_timer[out];
+    ledc_channel_cfg.gpio_num = gpio;
+    ledc_channel_config(&ledc_channel_cfg);
+    pwm_duty[out] = 0;
     return 0;
 }
 
 void PWMOn(pwm_out_t out){
-    switch(out){
-        case PWM_0:
-            ledc_timer_resume(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0);
-            break;
-        case PWM_1:
-            ledc_timer_resume(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1);
-            break;
-        case PWM_2:
-            ledc_timer_resume(LEDC_LOW_SPEED_MODE, LEDC_TIMER_2);
-            break;
-        case PWM_3:
-            ledc_timer_resume(LEDC_LOW_SPEED_MODE, LEDC_TIMER_3);
-            break;
+    if(out >= PWM_QTY){
+        return;
     }
+    ledc_timer_resume(LEDC_LOW_SPEED_MODE, pwm_timer[out]);
 }
 
 void PWMOff(pwm_out_t out){
-    switch(out){
-        case PWM_0:
-            ledc_timer_pause(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0);
-            break;
-        case PWM_1:
-            ledc_timer_pause(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1);
-            break;
-        case PWM_2:
-            ledc_timer_pause(LEDC_LOW_SPEED_MODE, LEDC_TIMER_2);
-            break;
-        case PWM_3:
-            ledc_timer_pause(LEDC_LOW_SPEED_MODE, LEDC_TIMER_3);
-            break;
+    if(out >= PWM_QTY){
+        return;
     }
+    ledc_timer_pause(LEDC_LOW_SPEED_MODE, pwm_timer[out]);
 }
 
 void PWMSetDutyCycle(pwm_out_t out, uint8_t duty_cycle){
     if(duty_cycle > DC_100){
         duty_cycle = DC_100;
     }
-    uint32_t dc = ((uint32_t)duty_cycle * DC_MAX) / DC_100;
-    switch(out){
-        case PWM_0:
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0, dc);
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0);
-            break;
-        case PWM_1:
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1, dc);
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1);
-            break;
-        case PWM_2:
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_2, dc);
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_2);
-            break;
-        case PWM_3:
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_3, dc);
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_3);
-            break;
+    PWMSetDutyRatio(out, duty_cycle, DC_100);
+}
+
+uint32_t PWMGetMaxDuty(pwm_out_t out){
+    if(out >= PWM_QTY){
+        return 0;
+    }
+    return (1UL << pwm_bits[out]);
+}
+
+void PWMSetDutyRaw(pwm_out_t out, uint32_t duty){
+    if(out >= PWM_QTY){
+        return;
+    }
+    pwm_write_duty(out, duty);
+}
+
+void PWMSetDutyRatio(pwm_out_t out, uint32_t num, uint32_t den){
+    if((out >= PWM_QTY) || (den == 0)){
+        return;
+    }
+    if(num > den){
+        num = den;
+    }
+    pwm_write_duty(out, ((uint64_t)num << pwm_bits[out]) / den);
+}
+
+void PWMSetDutyMulti(const pwm_duty_t *duties, uint8_t qty){
+    uint8_t i;
+    uint32_t duty;
+    /* A running hardware fade would overwrite the new duty */
+    if(fade_installed){
+#if SOC_LEDC_SUPPORT_FADE_STOP
+        for(i = 0; i < qty; i++){
+            if(duties[i].out < PWM_QTY){
+                ledc_fade_stop(LEDC_LOW_SPEED_MODE, pwm_channel[duties[i].out]);
+            }
+        }
+#endif
+    }
+    /* Write all duty registers first (invalid outputs are skipped)... */
+    for(i = 0; i < qty; i++){
+        if(duties[i].out >= PWM_QTY){
+            continue;
+        }
+        duty = duties[i].duty;
+        if(duty > PWMGetMaxDuty(duties[i].out)){
+            duty = PWMGetMaxDuty(duties[i].out);
+        }
+        pwm_duty[duties[i].out] = duty;
+        ledc_set_duty(LEDC_LOW_SPEED_MODE, pwm_channel[duties[i].out], duty);
+    }
+    /* ...then latch them together: each one takes effect at the end of the
+     * current period of its own timer */
+    portENTER_CRITICAL(&pwm_mux);
+    for(i = 0; i < qty; i++){
+        if(duties[i].out < PWM_QTY){
+            ledc_update_duty(LEDC_LOW_SPEED_MODE, pwm_channel[duties[i].out]);
+        }
     }
+    portEXIT_CRITICAL(&pwm_mux);
+}
+
+void PWMSync(const pwm_out_t *outs, uint8_t qty){
+    uint8_t i;
+    portENTER_CRITICAL(&pwm_mux);
+    for(i = 0; i < qty; i++){
+        if(outs[i] < PWM_QTY){
+            ledc_timer_rst(LEDC_LOW_SPEED_MODE, pwm_timer[outs[i]]);
+        }
+    }
+    portEXIT_CRITICAL(&pwm_mux);
+}
+
+uint8_t PWMFade(pwm_out_t out, uint32_t duty, uint32_t time_ms){
+    if(out >= PWM_QTY){
+        return 1;
+    }
+    if(!fade_installed){
+        if(ledc_fade_func_install(0) != ESP_OK){
+            return 1;
+        }
+        fade_installed = true;
+    }
+    if(duty > PWMGetMaxDuty(out)){
+        duty = PWMGetMaxDuty(out);
+    }
+    if(ledc_set_fade_time_and_start(LEDC_LOW_SPEED_MODE, pwm_channel[out], duty, time_ms, LEDC_FADE_NO_WAIT) != ESP_OK){
+        return 1;
+    }
+    pwm_duty[out] = duty;
+    return 0;
 }
 
 uint8_t PWMSetFreq(pwm_out_t out, uint32_t freq){
-    switch(out){
-        case PWM_0:
-            ledc_set_freq(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0, freq);
-            break;
-        case PWM_1:
-            ledc_set_freq(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1, freq);
-            break;
-        case PWM_2:
-            ledc_set_freq(LEDC_LOW_SPEED_MODE, LEDC_TIMER_2, freq);
-            break;
-        case PWM_3:
-            ledc_set_freq(LEDC_LOW_SPEED_MODE, LEDC_TIMER_3, freq);
-            break;
+    uint8_t bits;
+    if(out >= PWM_QTY){
+        return 1;
+    }
+    bits = pwm_bits[out];
+    if((SRC_CLK_HZ >> bits) >= freq){
+        /* Current resolution is still valid: only the divider changes */
+        ledc_set_freq(LEDC_LOW_SPEED_MODE, pwm_timer[out], freq);
+    } else{
+        /* Resolution must be lowered: keep the same duty cycle ratio */
+        pwm_timer_config(out, freq);
+        pwm_write_duty(out, pwm_duty[out] >> (bits - pwm_bits[out]));
     }
     return 0;
 }
 
 uint8_t PWMDeinit(pwm_out_t out){
-    switch(out){
-        case PWM_0:
-            ledc_stop(LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_0, 0);
-            break;
-        case PWM_1:
-            ledc_stop(LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_1, 0);
-            break;
-        case PWM_2:
-            ledc_stop(LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_2, 0);
-            break;
-        case PWM_3:
-            ledc_stop(LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_3, 0);
-            break;
+    if(out >= PWM_QTY){
+        return 1;
     }
+    ledc_stop(LEDC_LOW_SPEED_MODE, pwm_channel[out], 0);
     return 0;
 }
 
-/*==================[end of file]============================================*/
\ No newline at end of file
+/*==================[end of file]============================================*/
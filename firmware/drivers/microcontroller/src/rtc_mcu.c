@@ -12,7 +12,9 @@
 /*==================[inclusions]=============================================*/
 #include "rtc_mcu.h"
 #include <stdint.h>
+#include <time.h>
 #include "sys/time.h"
+#include "timestamp_mcu.h"
 /*==================[macros and definitions]=================================*/
 
 /*==================[internal data declaration]==============================*/
@@ -44,21 +46,13 @@ bool RtcConfig(rtc_t * rtc){
     time_t t = mktime(&tm);
     struct timeval now = { .tv_sec = t };
     settimeofday(&now, NULL);
+    TimestampSync();
 
     return true;
 }
 
 void RtcRead(rtc_t * rtc){
-    time_t now;
-    struct tm timeinfo;
-    time(&now);
-    localtime_r(&now, &timeinfo);
-    rtc->year = timeinfo.tm_year;
-    rtc->month = timeinfo.tm_mon;
-    rtc->mday = timeinfo.tm_mday;
-    rtc->wday = timeinfo.tm_wday;
-    rtc->hour = timeinfo.tm_hour;
-    rtc->min = timeinfo.tm_min;
-    rtc->sec = timeinfo.tm_sec;
+    /* Cached conversion: localtime_r() only once a minute */
+    TimestampToCalendar(TimestampGet(), rtc);
 }
 /*==================[end of file]============================================*/
@@ -15,6 +15,7 @@
 #include <string.h>
 #include "driver/spi_master.h"
 #include "gpio_mcu.h"
+#include "trace_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define PIN_NUM_MISO	GPIO_22	/*!<  */
 #define PIN_NUM_MOSI	GPIO_21	/*!<  */
@@ -104,6 +105,7 @@ uint8_t SpiInit(spi_mcu_config_t* spi){
 
 void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
     spi_transaction_t t;
+    TRACE_ENTER(TRACE_SPI);
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = rx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.rxlength = rx_buffer_size * 8;
@@ -140,10 +142,12 @@ void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
             }
             break;
     }
+    TRACE_EXIT(TRACE_SPI);
 }
 
 void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
     spi_transaction_t t;
+    TRACE_ENTER(TRACE_SPI);
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = tx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.tx_buffer = tx_buffer;        // Data
@@ -179,10 +183,12 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
             }
             break;
     }
+    TRACE_EXIT(TRACE_SPI);
 }
 
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size){
     spi_transaction_t t;
+    TRACE_ENTER(TRACE_SPI);
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = buffer_size * 8;     // tx_buffer_size is in bytes, transaction length is in bits.
     t.rxlength = buffer_size * 8;
@@ -220,6 +226,7 @@ void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, ui
             }
             break;
     }
+    TRACE_EXIT(TRACE_SPI);
 }
 
 uint8_t SpiDeInit(spi_dev_t device){
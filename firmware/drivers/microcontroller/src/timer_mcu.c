@@ -44,6 +44,16 @@ void *timer_c_user_data;	            /*!< User data for timer C */
 gptimer_alarm_config_t alarm_config_a;  /*!< Configuration for alarm A */
 gptimer_alarm_config_t alarm_config_b;	/*!< Configuration for alarm B */
 gptimer_alarm_config_t alarm_config_c;	/*!< Configuration for alarm C */
+
+/**
+ * @brief Timer state: enabled timers hold the power management lock of the 
+ * gptimer driver, so they are only enabled while running (or stopped from an ISR)
+ */
+static struct {
+	bool enabled;
+	bool running;
+} timer_state[TIMER_C + 1];
+static portMUX_TYPE timer_mux = portMUX_INITIALIZER_UNLOCKED;
 /*==================[internal functions declaration]=========================*/
 static bool IRAM_ATTR timer_a_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
 	timer_a_isr_p(timer_a_user_data);
@@ -62,9 +72,22 @@ static bool IRAM_ATTR timer_c_isr(gptimer_handle_t timer, const gptimer_alarm_ev
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static gptimer_handle_t timer_handle(timer_mcu_t timer){
+	switch(timer){
+	 	case TIMER_A:
+	 		return timer_a;
+	 	case TIMER_B:
+	 		return timer_b;
+	 	case TIMER_C:
+	 		return timer_c;
+	}
+	return NULL;
+}
 
 /*==================[external functions definition]==========================*/
 void TimerInit(timer_config_t *timer_ini){
+	timer_state[timer_ini->timer].enabled = false;
+	timer_state[timer_ini->timer].running = false;
 	switch(timer_ini->timer){
 	 	case TIMER_A:
 			timer_a_isr_p = timer_ini->func_p;
@@ -78,7 +101,6 @@ void TimerInit(timer_config_t *timer_ini){
 				.on_alarm = timer_a_isr,
 			};
 			gptimer_register_event_callbacks(timer_a, &alarm_a, NULL);
-			gptimer_enable(timer_a);
 	 	break;
 
 	 	case TIMER_B:
@@ -93,7 +115,6 @@ void TimerInit(timer_config_t *timer_ini){
 				.on_alarm = timer_b_isr,
 			};
 			gptimer_register_event_callbacks(timer_b, &alarm_b, NULL);
-			gptimer_enable(timer_b);
 	 	break;
 
 	 	case TIMER_C:
@@ -108,23 +129,26 @@ void TimerInit(timer_config_t *timer_ini){
 				.on_alarm = timer_c_isr,
 			};
 			gptimer_register_event_callbacks(timer_c, &alarm_c, NULL);
-			gptimer_enable(timer_c);
 	 	break;
 	}
 }
 
 void TimerStart(timer_mcu_t timer){
-	switch(timer){
-	 	case TIMER_A:
-	 		gptimer_start(timer_a);
-		break;
-	 	case TIMER_B:
-	 		gptimer_start(timer_b);
-		break;
-	 	case TIMER_C:
-	 		gptimer_start(timer_c);
-		break;
+	gptimer_handle_t handle = timer_handle(timer);
+	if(handle == NULL){
+		return;
+	}
+	// enabling takes the power management lock (not allowed from an ISR)
+	if(!xPortInIsrContext() && !timer_state[timer].enabled){
+		gptimer_enable(handle);
+		timer_state[timer].enabled = true;
 	}
+	portENTER_CRITICAL_SAFE(&timer_mux);
+	if(timer_state[timer].enabled && !timer_state[timer].running){
+		gptimer_start(handle);
+		timer_state[timer].running = true;
+	}
+	portEXIT_CRITICAL_SAFE(&timer_mux);
 }
 
 uint32_t TimerRead(timer_mcu_t timer){
@@ -144,16 +168,20 @@ uint32_t TimerRead(timer_mcu_t timer){
 }
 
 void TimerStop(timer_mcu_t timer){
-	switch(timer){
-	 	case TIMER_A:
-	 		gptimer_stop(timer_a);
-	 	break;
-	 	case TIMER_B:
-	 		gptimer_stop(timer_b);
-	 	break;
-	 	case TIMER_C:
-	 		gptimer_stop(timer_c);
-	 	break;
+	gptimer_handle_t handle = timer_handle(timer);
+	if(handle == NULL){
+		return;
+	}
+	portENTER_CRITICAL_SAFE(&timer_mux);
+	if(timer_state[timer].running){
+		gptimer_stop(handle);
+		timer_state[timer].running = false;
+	}
+	portEXIT_CRITICAL_SAFE(&timer_mux);
+	// release the power management lock (not allowed from an ISR)
+	if(!xPortInIsrContext() && timer_state[timer].enabled){
+		gptimer_disable(handle);
+		timer_state[timer].enabled = false;
 	}
 }
 
@@ -188,4 +216,24 @@ void TimerUpdatePeriod(timer_mcu_t timer, uint32_t period){
 	}
 }
 
+void TimerDeinit(timer_mcu_t timer){
+	gptimer_handle_t handle = timer_handle(timer);
+	if(handle == NULL){
+		return;
+	}
+	TimerStop(timer);
+	gptimer_del_timer(handle);
+	switch(timer){
+	 	case TIMER_A:
+			timer_a = NULL;
+	 	break;
+	 	case TIMER_B:
+			timer_b = NULL;
+	 	break;
+	 	case TIMER_C:
+			timer_c = NULL;
+	 	break;
+	}
+}
+
 /*==================[end of file]============================================*/
@@ -0,0 +1,132 @@
+/**
+ * @file timestamp_mcu.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "timestamp_mcu.h"
+#include <stdlib.h>
+#include <time.h>
+#include <sys/time.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+/*==================[macros and definitions]=================================*/
+#define US_PER_SEC		1000000
+#define SEC_PER_MIN		60
+#define CALENDAR_SYNC_US	100		/*!< Wall clock changes smaller than this are ignored (read jitter) */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static portMUX_TYPE calendar_mux = portMUX_INITIALIZER_UNLOCKED;
+static bool calendar_synced = false;
+static int64_t calendar_offset;		/*!< Unix time (us) - timestamp */
+static int64_t calendar_sec = -1;	/*!< Unix time (s) of the cached date */
+static rtc_t calendar_rtc;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Read the difference between the wall clock and the timebase.
+ */
+static int64_t calendar_read_offset(void){
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	return (int64_t)now.tv_sec * US_PER_SEC + now.tv_usec - esp_timer_get_time();
+}
+/*==================[external functions definition]==========================*/
+uint64_t IRAM_ATTR TimestampGet(void){
+	return (uint64_t)esp_timer_get_time();
+}
+
+uint32_t IRAM_ATTR TimestampCycles(void){
+	return esp_cpu_get_cycle_count();
+}
+
+uint32_t TimestampCyclesToNs(uint32_t cycles){
+	return (uint32_t)(((uint64_t)cycles * 1000) / esp_rom_get_cpu_ticks_per_us());
+}
+
+void IRAM_ATTR TimestampBlock(timestamp_block_t *block, uint64_t last, uint16_t qty, uint32_t period_us){
+	block->last = last;
+	block->qty = qty;
+	block->period_us = period_us;
+}
+
+uint64_t TimestampSample(const timestamp_block_t *block, uint16_t index){
+	return block->last - (uint64_t)(block->qty - 1 - index) * block->period_us;
+}
+
+int64_t TimestampToUnix(uint64_t time){
+	int64_t offset;
+	if(!calendar_synced){
+		TimestampSync();
+	}
+	portENTER_CRITICAL(&calendar_mux);
+	offset = calendar_offset;
+	portEXIT_CRITICAL(&calendar_mux);
+	return (int64_t)time + offset;
+}
+
+void TimestampToCalendar(uint64_t time, rtc_t *rtc){
+	int64_t sec = TimestampToUnix(time) / US_PER_SEC;
+	int64_t elapsed;
+	bool hit = false;
+
+	portENTER_CRITICAL(&calendar_mux);
+	elapsed = sec - calendar_sec;
+	/* Same minute as the cached date: only the seconds change */
+	if((calendar_sec >= 0) && (elapsed >= 0) && (calendar_rtc.sec + elapsed < SEC_PER_MIN)){
+		*rtc = calendar_rtc;
+		rtc->sec += elapsed;
+		hit = true;
+	}
+	portEXIT_CRITICAL(&calendar_mux);
+	if(hit){
+		return;
+	}
+
+	/* Once a minute: follow changes of the wall clock (SNTP) */
+	TimestampSync();
+	sec = TimestampToUnix(time) / US_PER_SEC;
+	time_t t = (time_t)sec;
+	struct tm timeinfo;
+	localtime_r(&t, &timeinfo);
+	rtc->year = timeinfo.tm_year;
+	rtc->month = timeinfo.tm_mon;
+	rtc->mday = timeinfo.tm_mday;
+	rtc->wday = timeinfo.tm_wday;
+	rtc->hour = timeinfo.tm_hour;
+	rtc->min = timeinfo.tm_min;
+	rtc->sec = timeinfo.tm_sec;
+
+	portENTER_CRITICAL(&calendar_mux);
+	if(sec > calendar_sec){
+		calendar_sec = sec;
+		calendar_rtc = *rtc;
+	}
+	portEXIT_CRITICAL(&calendar_mux);
+}
+
+void TimestampSync(void){
+	int64_t offset = calendar_read_offset();
+	portENTER_CRITICAL(&calendar_mux);
+	if(!calendar_synced || (llabs(offset - calendar_offset) > CALENDAR_SYNC_US)){
+		calendar_offset = offset;
+		calendar_sec = -1;
+	}
+	calendar_synced = true;
+	portEXIT_CRITICAL(&calendar_mux);
+}
+
+/*==================[end of file]============================================*/
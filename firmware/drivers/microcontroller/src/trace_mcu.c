@@ -0,0 +1,239 @@
+/**
+ * @file trace_mcu.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "trace_mcu.h"
+#ifdef CONFIG_TRACE_ENABLE
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_cpu.h"
+#include "esp_attr.h"
+#include "esp_rom_sys.h"
+#include "power_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define TRACE_EVENTS		CONFIG_TRACE_EVENTS		/*!< Events in the ring buffer of each core */
+#define TRACE_CORES			portNUM_PROCESSORS
+#define TRACE_SUB_BITS		2						/*!< Histogram: 4 bins per octave */
+#define TRACE_BINS			((32 - TRACE_SUB_BITS + 1) << TRACE_SUB_BITS)
+#define TRACE_LINE_SIZE		96
+/*==================[internal data declaration]==============================*/
+typedef struct {
+	uint32_t start;		/*!< Cycle count at TRACE_ENTER() */
+	uint32_t cycles;	/*!< Duration */
+	uint8_t id;
+} trace_event_t;
+
+typedef struct {
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+	uint32_t hist[TRACE_BINS];
+} trace_stats_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static trace_event_t trace_events[TRACE_CORES][TRACE_EVENTS];
+static uint32_t trace_head[TRACE_CORES];	/*!< Events written (the oldest are overwritten) */
+static trace_stats_t trace_stats[TRACE_CORES][TRACE_ID_QTY];
+static volatile bool trace_running = false;
+static power_lock_t trace_lock = NULL;
+static bool trace_locked = false;
+
+static const char *trace_names[TRACE_ID_QTY] = {
+	"iir", "fft", "imu", "ili9341", "spi", "i2c", "uart", "user_0", "user_1", "user_2", "user_3"
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Histogram bin: values 0 to 3 have their own bin, then 4 bins for each power of 2.
+ */
+static inline uint32_t trace_bin(uint32_t cycles){
+	if(cycles < (1 << TRACE_SUB_BITS)){
+		return cycles;
+	}
+	uint32_t msb = 31 - __builtin_clz(cycles);
+	return ((msb - TRACE_SUB_BITS + 1) << TRACE_SUB_BITS) | ((cycles >> (msb - TRACE_SUB_BITS)) & ((1 << TRACE_SUB_BITS) - 1));
+}
+
+/**
+ * @brief Center of a histogram bin (inverse of trace_bin()).
+ */
+static uint32_t trace_bin_value(uint32_t bin){
+	if(bin < (1 << TRACE_SUB_BITS)){
+		return bin;
+	}
+	uint32_t shift = (bin >> TRACE_SUB_BITS) - 1;
+	uint32_t low = ((1 << TRACE_SUB_BITS) | (bin & ((1 << TRACE_SUB_BITS) - 1))) << shift;
+	return low + ((1UL << shift) >> 1);
+}
+
+static uint32_t trace_percentile(const trace_stats_t *stats, uint32_t percent){
+	uint32_t target = (uint32_t)(((uint64_t)stats->count * percent + 99) / 100);
+	uint32_t acc = 0;
+	for(uint32_t bin = 0; bin < TRACE_BINS; bin++){
+		acc += stats->hist[bin];
+		if(acc >= target){
+			uint32_t value = trace_bin_value(bin);
+			/* The bin center can be outside the measured range */
+			if(value < stats->min){
+				return stats->min;
+			}
+			return (value > stats->max) ? stats->max : value;
+		}
+	}
+	return stats->max;
+}
+/*==================[external functions definition]==========================*/
+void TraceStart(void){
+	trace_running = false;
+	memset(trace_events, 0, sizeof(trace_events));
+	memset(trace_head, 0, sizeof(trace_head));
+	memset(trace_stats, 0, sizeof(trace_stats));
+	if(trace_lock == NULL){
+		PowerLockCreate(POWER_LOCK_CPU_MAX, "trace", &trace_lock);
+	}
+	if(!trace_locked){
+		PowerLockAcquire(trace_lock);
+		trace_locked = true;
+	}
+	trace_running = true;
+}
+
+void TraceStop(void){
+	trace_running = false;
+	if(trace_locked){
+		PowerLockRelease(trace_lock);
+		trace_locked = false;
+	}
+}
+
+void TraceSetName(trace_id_t id, const char *name){
+	if(id < TRACE_ID_QTY){
+		trace_names[id] = name;
+	}
+}
+
+uint32_t IRAM_ATTR TraceEnter(trace_id_t id){
+	(void)id;
+	return esp_cpu_get_cycle_count();
+}
+
+void IRAM_ATTR TraceExit(trace_id_t id, uint32_t start){
+	uint32_t cycles = esp_cpu_get_cycle_count() - start;
+	if(!trace_running || (id >= TRACE_ID_QTY)){
+		return;
+	}
+	/* Only this core writes its buffer: masking its interrupts is enough */
+	uint32_t core = esp_cpu_get_core_id();
+	UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+	trace_event_t *event = &trace_events[core][trace_head[core] % TRACE_EVENTS];
+	event->start = start;
+	event->cycles = cycles;
+	event->id = id;
+	trace_head[core]++;
+	trace_stats_t *stats = &trace_stats[core][id];
+	if((stats->count == 0) || (cycles < stats->min)){
+		stats->min = cycles;
+	}
+	if(cycles > stats->max){
+		stats->max = cycles;
+	}
+	stats->count++;
+	stats->sum += cycles;
+	stats->hist[trace_bin(cycles)]++;
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+void TraceExportStats(uart_mcu_port_t port){
+	char line[TRACE_LINE_SIZE];
+	trace_stats_t total;
+	uint32_t cycles_us = esp_rom_get_cpu_ticks_per_us();
+	bool running = trace_running;
+	/* The UART is instrumented too */
+	trace_running = false;
+	UartSendString(port, "name,count,min_us,mean_us,p50_us,p90_us,p99_us,max_us\r\n");
+	for(uint8_t id = 0; id < TRACE_ID_QTY; id++){
+		/* Merge the cores */
+		memset(&total, 0, sizeof(total));
+		for(uint8_t core = 0; core < TRACE_CORES; core++){
+			const trace_stats_t *stats = &trace_stats[core][id];
+			if(stats->count == 0){
+				continue;
+			}
+			if((total.count == 0) || (stats->min < total.min)){
+				total.min = stats->min;
+			}
+			if(stats->max > total.max){
+				total.max = stats->max;
+			}
+			total.count += stats->count;
+			total.sum += stats->sum;
+			for(uint32_t bin = 0; bin < TRACE_BINS; bin++){
+				total.hist[bin] += stats->hist[bin];
+			}
+		}
+		if(total.count == 0){
+			continue;
+		}
+		snprintf(line, sizeof(line), "%s,%lu,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f\r\n", trace_names[id], total.count,
+			(float)total.min / cycles_us, (float)total.sum / total.count / cycles_us,
+			(float)trace_percentile(&total, 50) / cycles_us, (float)trace_percentile(&total, 90) / cycles_us,
+			(float)trace_percentile(&total, 99) / cycles_us, (float)total.max / cycles_us);
+		UartSendString(port, line);
+	}
+	trace_running = running;
+}
+
+void TraceExportEvents(uart_mcu_port_t port){
+	char line[TRACE_LINE_SIZE];
+	uint32_t first;
+	bool running = trace_running;
+	trace_running = false;
+	snprintf(line, sizeof(line), "#TRACE,%lu\r\n", (uint32_t)esp_rom_get_cpu_ticks_per_us());
+	UartSendString(port, line);
+	for(uint8_t core = 0; core < TRACE_CORES; core++){
+		first = (trace_head[core] > TRACE_EVENTS) ? trace_head[core] - TRACE_EVENTS : 0;
+		for(uint32_t i = first; i < trace_head[core]; i++){
+			const trace_event_t *event = &trace_events[core][i % TRACE_EVENTS];
+			snprintf(line, sizeof(line), "%u,%s,%lu,%lu\r\n", (unsigned)core, trace_names[event->id], event->start, event->cycles);
+			UartSendString(port, line);
+		}
+	}
+	UartSendString(port, "#END\r\n");
+	trace_running = running;
+}
+#else
+/* Trace disabled in sdkconfig: the application can keep its calls */
+void TraceStart(void){}
+
+void TraceStop(void){}
+
+void TraceSetName(trace_id_t id, const char *name){}
+
+uint32_t TraceEnter(trace_id_t id){
+	return 0;
+}
+
+void TraceExit(trace_id_t id, uint32_t start){}
+
+void TraceExportStats(uart_mcu_port_t port){
+	UartSendString(port, "Trace disabled (CONFIG_TRACE_ENABLE)\r\n");
+}
+
+void TraceExportEvents(uart_mcu_port_t port){
+	UartSendString(port, "#TRACE,0\r\n#END\r\n");
+}
+#endif
+
+/*==================[end of file]============================================*/
@@ -16,6 +16,8 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 #include "esp_log.h"
+#include "trace_mcu.h"
+#include "timestamp_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define UART_CONN_TX        GPIO_18         /*!<  */
 #define UART_CONN_RX        GPIO_19         /*!<  */
@@ -23,6 +25,11 @@
 #define RX_BUFFER_SIZE      256             /*!<  */
 #define EVENT_QUEUE_SIZE    16              /*!<  */
 #define READ_TIMEOUT        100             /*!<  */
+#ifdef CONFIG_PM_ENABLE
+#define UART_CLK_SRC        UART_SCLK_XTAL  /*!< Baud rate unaffected by frequency scaling and light sleep */
+#else
+#define UART_CLK_SRC        UART_SCLK_DEFAULT
+#endif
 /*==================[internal data declaration]==============================*/
 void (*uart_pc_isr_p)(void*);	            /*!<  */
 void (*uart_conn_isr_p)(void*);	            /*!<  */
@@ -30,6 +37,8 @@ void *uart_pc_user_data;	                /*!<  */
 void *uart_conn_user_data;	                /*!<  */
 static QueueHandle_t uart_pc_queue;         /*!<  */
 static QueueHandle_t uart_conn_queue;       /*!<  */
+static uint64_t uart_pc_rx_time = 0;        /*!< Time of the last data event (us) */
+static uint64_t uart_conn_rx_time = 0;      /*!< Time of the last data event (us) */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -45,6 +54,7 @@ static void uart_pc_event_task(void *pvParameters){
         if (xQueueReceive(uart_pc_queue, (void *)&event, (TickType_t)portMAX_DELAY)){
             switch(event.type) {
                 case UART_DATA:
+                    uart_pc_rx_time = TimestampGet();
                     uart_pc_isr_p(uart_pc_user_data);
                     break;
                 case UART_BREAK:
@@ -78,6 +88,7 @@ static void uart_conn_event_task(void *pvParameters){
         if(xQueueReceive(uart_conn_queue, (void *)&event, (TickType_t)portMAX_DELAY)){
             switch(event.type) {
                 case UART_DATA:
+                    uart_conn_rx_time = TimestampGet();
                     uart_conn_isr_p(uart_conn_user_data);
                     break;
                 case UART_BREAK:
@@ -111,7 +122,7 @@ void UartInit(serial_config_t *port_config){
         .parity = UART_PARITY_DISABLE,
         .stop_bits = UART_STOP_BITS_1,
         .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
-        .source_clk = UART_SCLK_DEFAULT,
+        .source_clk = UART_CLK_SRC,
     };
     switch(port_config->port){
         case UART_PC:
@@ -177,6 +188,13 @@ uint8_t UartReadBuffer(uart_mcu_port_t port, uint8_t* data, uint16_t nbytes){
     }
 }
 
+uint64_t UartReadTimestamp(uart_mcu_port_t port){
+    if(port == UART_CONNECTOR){
+        return uart_conn_rx_time;
+    }
+    return uart_pc_rx_time;
+}
+
 void UartSendByte(uart_mcu_port_t port, const char *data){
     uart_port_t uart_num = UART_NUM_0;
     switch(port){
@@ -192,6 +210,7 @@ void UartSendByte(uart_mcu_port_t port, const char *data){
 
 void UartSendString(uart_mcu_port_t port, const char *msg){
     uart_port_t uart_num = UART_NUM_0;
+    TRACE_ENTER(TRACE_UART);
     switch(port){
         case UART_PC:
                 uart_num = UART_NUM_0;
@@ -204,10 +223,12 @@ void UartSendString(uart_mcu_port_t port, const char *msg){
         uart_tx_chars(uart_num, msg, 1);
 		msg++;
 	}
+    TRACE_EXIT(TRACE_UART);
 }
 
 void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes){
     uart_port_t uart_num = UART_NUM_0;
+    TRACE_ENTER(TRACE_UART);
     switch(port){
         case UART_PC:
                 uart_num = UART_NUM_0;
@@ -217,6 +238,23 @@ void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes){
             break;
     }
     uart_tx_chars(uart_num, data, nbytes);
+    TRACE_EXIT(TRACE_UART);
+}
+
+void UartSendBufferWait(uart_mcu_port_t port, const char *data, uint32_t nbytes){
+    uart_port_t uart_num = UART_NUM_0;
+    TRACE_ENTER(TRACE_UART);
+    switch(port){
+        case UART_PC:
+                uart_num = UART_NUM_0;
+            break;
+        case UART_CONNECTOR:
+                uart_num = UART_NUM_1;
+            break;
+    }
+    /* Copies to the driver TX ring buffer, blocking while it is full */
+    uart_write_bytes(uart_num, data, nbytes);
+    TRACE_EXIT(TRACE_UART);
 }
 
 uint8_t* UartItoa(uint32_t val, uint8_t base){
@@ -0,0 +1,53 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "dsps_dotprod.h"
+
+#if (dsps_dotprod_s16_rv32_enabled == 1)
+
+// Two int16 products add up to [-0x7FFF0000, 0x80000000]. Adding this offset makes
+// the sum of a pair fit in an uint32_t, so the 64 bit accumulator only needs an
+// unsigned add with carry (RV32 has no 64 bit add and no sign extension for free).
+#define DOTPROD_PAIR_BIAS   0x7FFF0000u
+
+esp_err_t dsps_dotprod_s16_rv32(const int16_t *src1, const int16_t *src2, int16_t *dest, int len, int8_t shift)
+{
+    uint64_t acc = 0;
+    int pairs = len >> 1;
+    int quads = len >> 2;
+    uint32_t t0, t1;
+
+    for (int i = 0 ; i < quads ; i++) {
+        t0 = (uint32_t)(src1[0] * src2[0]) + (uint32_t)(src1[1] * src2[1]) + DOTPROD_PAIR_BIAS;
+        t1 = (uint32_t)(src1[2] * src2[2]) + (uint32_t)(src1[3] * src2[3]) + DOTPROD_PAIR_BIAS;
+        acc += t0;
+        acc += t1;
+        src1 += 4;
+        src2 += 4;
+    }
+    if (len & 2) {
+        t0 = (uint32_t)(src1[0] * src2[0]) + (uint32_t)(src1[1] * src2[1]) + DOTPROD_PAIR_BIAS;
+        acc += t0;
+        src1 += 2;
+        src2 += 2;
+    }
+    // Remove the offset: the exact result always fits in 64 bits
+    int64_t sum = (int64_t)(acc - (uint64_t)pairs * DOTPROD_PAIR_BIAS);
+    if (len & 1) {
+        sum += src1[0] * src2[0];
+    }
+
+    // To make correct round operation we have to shift round value
+    sum += 0x7fff >> shift;
+
+    int final_shift = shift - 15;
+    if (final_shift > 0) {
+        *dest = (sum << final_shift);
+    } else {
+        *dest = (sum >> (-final_shift));
+    }
+    return ESP_OK;
+}
+
+#endif // dsps_dotprod_s16_rv32_enabled
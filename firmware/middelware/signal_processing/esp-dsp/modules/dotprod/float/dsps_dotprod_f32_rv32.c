@@ -0,0 +1,30 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "dsps_dotprod.h"
+
+#if (dsps_dotprod_f32_rv32_enabled == 1)
+
+// Unrolled by 4 with a single accumulator, so the result is bit exact with the ANSI version
+esp_err_t dsps_dotprod_f32_rv32(const float *src1, const float *src2, float *dest, int len)
+{
+    float acc = 0;
+    const float *end = src1 + (len & ~3);
+
+    while (src1 < end) {
+        acc += src1[0] * src2[0];
+        acc += src1[1] * src2[1];
+        acc += src1[2] * src2[2];
+        acc += src1[3] * src2[3];
+        src1 += 4;
+        src2 += 4;
+    }
+    for (int i = 0 ; i < (len & 3) ; i++) {
+        acc += src1[i] * src2[i];
+    }
+    *dest = acc;
+    return ESP_OK;
+}
+
+#endif // dsps_dotprod_f32_rv32_enabled
@@ -0,0 +1,127 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+#include <malloc.h>
+
+#include "dsps_dotprod.h"
+#include "dsp_common.h"
+#include "dsp_tests.h"
+
+#if (dsps_dotprod_s16_rv32_enabled == 1)
+
+static const char *TAG = "dsps_dotprod_rv32";
+static portMUX_TYPE testnlock = portMUX_INITIALIZER_UNLOCKED;
+
+// Test dsps_dotprod_s16_rv32 function against the ANSI version (bit exact)
+TEST_CASE("dsps_dotprod_s16_rv32 functionality", "[dsps]")
+{
+    int max_N = 1024;
+    int16_t *x = (int16_t *)memalign(16, max_N * sizeof(int16_t));
+    int16_t *y = (int16_t *)memalign(16, max_N * sizeof(int16_t));
+
+    for (int i = 0 ; i < max_N ; i++) {
+        x[i] = (i & 7) ? (int16_t)(rand() & 0xffff) : INT16_MIN;
+        y[i] = (i & 3) ? (int16_t)(rand() & 0xffff) : INT16_MIN;
+    }
+    for (int len = 0 ; len < max_N ; len++) {
+        for (int8_t shift = 0 ; shift < 16 ; shift += 5) {
+            int16_t z_ansi = 0;
+            int16_t z_rv32 = 0;
+            dsps_dotprod_s16_ansi(x, y, &z_ansi, len, shift);
+            esp_err_t status = dsps_dotprod_s16_rv32(x, y, &z_rv32, len, shift);
+            TEST_ASSERT_EQUAL(ESP_OK, status);
+            TEST_ASSERT_EQUAL(z_ansi, z_rv32);
+        }
+    }
+    free(x);
+    free(y);
+}
+
+TEST_CASE("dsps_dotprod_f32_rv32 functionality", "[dsps]")
+{
+    int max_N = 1024;
+    float *x = (float *)memalign(16, max_N * sizeof(float));
+    float *y = (float *)memalign(16, max_N * sizeof(float));
+
+    for (int i = 0 ; i < max_N ; i++) {
+        x[i] = (float)rand() / RAND_MAX - 0.5f;
+        y[i] = (float)rand() / RAND_MAX - 0.5f;
+    }
+    for (int len = 0 ; len < max_N ; len += 7) {
+        float z_ansi = 0;
+        float z_rv32 = 0;
+        dsps_dotprod_f32_ansi(x, y, &z_ansi, len);
+        dsps_dotprod_f32_rv32(x, y, &z_rv32, len);
+        TEST_ASSERT_EQUAL_FLOAT(z_ansi, z_rv32);
+    }
+    free(x);
+    free(y);
+}
+
+TEST_CASE("dsps_dotprod_rv32 benchmark", "[dsps]")
+{
+    int max_N = 1024;
+    int repeat_count = 64;
+    int16_t *x = (int16_t *)memalign(16, max_N * sizeof(int16_t));
+    int16_t *y = (int16_t *)memalign(16, max_N * sizeof(int16_t));
+    float *fx = (float *)memalign(16, max_N * sizeof(float));
+    float *fy = (float *)memalign(16, max_N * sizeof(float));
+    int16_t z;
+    float fz;
+
+    for (int i = 0 ; i < max_N ; i++) {
+        x[i] = 0x100;
+        y[i] = 0x200;
+        fx[i] = 1.5f;
+        fy[i] = 0.5f;
+    }
+    // Disable interrupt to get exect count
+    portENTER_CRITICAL(&testnlock);
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_dotprod_s16_ansi(x, y, &z, max_N, 0);
+    }
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    float cycles_ansi = (float)(end_b - start_b) / (max_N * repeat_count);
+
+    start_b = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_dotprod_s16_rv32(x, y, &z, max_N, 0);
+    }
+    end_b = dsp_get_cpu_cycle_count();
+    float cycles_rv32 = (float)(end_b - start_b) / (max_N * repeat_count);
+
+    start_b = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_dotprod_f32_ansi(fx, fy, &fz, max_N);
+    }
+    end_b = dsp_get_cpu_cycle_count();
+    float cycles_f32_ansi = (float)(end_b - start_b) / (max_N * repeat_count);
+
+    start_b = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_dotprod_f32_rv32(fx, fy, &fz, max_N);
+    }
+    end_b = dsp_get_cpu_cycle_count();
+    float cycles_f32_rv32 = (float)(end_b - start_b) / (max_N * repeat_count);
+    portEXIT_CRITICAL(&testnlock);
+
+    ESP_LOGI(TAG, "dsps_dotprod_s16_ansi - %f per sample", cycles_ansi);
+    ESP_LOGI(TAG, "dsps_dotprod_s16_rv32 - %f per sample", cycles_rv32);
+    ESP_LOGI(TAG, "dsps_dotprod_f32_ansi - %f per sample", cycles_f32_ansi);
+    ESP_LOGI(TAG, "dsps_dotprod_f32_rv32 - %f per sample", cycles_f32_rv32);
+    TEST_ASSERT_EXEC_IN_RANGE(1, cycles_ansi, cycles_rv32);
+    TEST_ASSERT_EXEC_IN_RANGE(1, cycles_f32_ansi * 1.05f, cycles_f32_rv32);
+
+    free(x);
+    free(y);
+    free(fx);
+    free(fy);
+}
+
+#endif // dsps_dotprod_s16_rv32_enabled
@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "dsps_fft2r.h"
+#include "dsp_common.h"
+#include "dsps_fft2r_platform.h"
+
+#if (dsps_fft2r_sc16_rv32_enabled == 1)
+
+// Same rounding and scaling (1/2 per stage) as dsps_fft2r_sc16_ansi, results are bit exact.
+// Arithmetic is done modulo 2^32 (as the ANSI version does in practice) to keep it defined.
+#define FFT_SC16_ROUND      0x7fff
+
+static inline void fft2r_sc16_bf(int16_t *a, int16_t *b, int32_t re_temp, int32_t im_temp)
+{
+    uint32_t a_re = (uint32_t)(a[0] * 0x7fff + FFT_SC16_ROUND);
+    uint32_t a_im = (uint32_t)(a[1] * 0x7fff + FFT_SC16_ROUND);
+    b[0] = (int16_t)((int32_t)(a_re - (uint32_t)re_temp) >> 16);
+    b[1] = (int16_t)((int32_t)(a_im - (uint32_t)im_temp) >> 16);
+    a[0] = (int16_t)((int32_t)(a_re + (uint32_t)re_temp) >> 16);
+    a[1] = (int16_t)((int32_t)(a_im + (uint32_t)im_temp) >> 16);
+}
+
+esp_err_t dsps_fft2r_sc16_rv32_(int16_t *data, int N, int16_t *w)
+{
+    if (!dsp_is_power_of_two(N)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if (!dsps_fft2r_sc16_initialized) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+
+    int32_t c, s;
+    int16_t *a, *b;
+    int ie = 1;
+    for (int N2 = N / 2; N2 > 0; N2 >>= 1) {
+        // First group: w[0] = (INT16_MAX, 0), half of the products are zero
+        c = w[0];
+        a = data;
+        b = data + 2 * N2;
+        for (int i = 0; i < N2; i++) {
+            fft2r_sc16_bf(a, b, c * b[0], c * b[1]);
+            a += 2;
+            b += 2;
+        }
+        for (int j = 1; j < ie; j++) {
+            c = w[2 * j];
+            s = w[2 * j + 1];
+            a = data + 4 * N2 * j;
+            b = a + 2 * N2;
+            for (int i = 0; i < N2; i++) {
+                fft2r_sc16_bf(a, b, c * b[0] + s * b[1], c * b[1] - s * b[0]);
+                a += 2;
+                b += 2;
+            }
+        }
+        ie <<= 1;
+    }
+    return ESP_OK;
+}
+
+#endif // dsps_fft2r_sc16_rv32_enabled
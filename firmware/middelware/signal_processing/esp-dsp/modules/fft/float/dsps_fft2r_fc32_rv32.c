@@ -0,0 +1,60 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "dsps_fft2r.h"
+#include "dsp_common.h"
+#include "dsps_fft2r_platform.h"
+
+#if (dsps_fft2r_fc32_rv32_enabled == 1)
+
+esp_err_t dsps_fft2r_fc32_rv32_(float *data, int N, float *w)
+{
+    if (!dsp_is_power_of_two(N)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if (!dsps_fft2r_initialized) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+
+    float re_temp, im_temp;
+    float c, s;
+    float *a, *b;
+    int ie = 1;
+    for (int N2 = N / 2; N2 > 0; N2 >>= 1) {
+        // First group: w[0] = (1, 0), the butterflies need no multiplications.
+        // Without FPU this skips N - 1 of the (N / 2) * log2(N) complex products.
+        a = data;
+        b = data + 2 * N2;
+        for (int i = 0; i < N2; i++) {
+            re_temp = b[0];
+            im_temp = b[1];
+            b[0] = a[0] - re_temp;
+            b[1] = a[1] - im_temp;
+            a[0] = a[0] + re_temp;
+            a[1] = a[1] + im_temp;
+            a += 2;
+            b += 2;
+        }
+        for (int j = 1; j < ie; j++) {
+            c = w[2 * j];
+            s = w[2 * j + 1];
+            a = data + 4 * N2 * j;
+            b = a + 2 * N2;
+            for (int i = 0; i < N2; i++) {
+                re_temp = c * b[0] + s * b[1];
+                im_temp = c * b[1] - s * b[0];
+                b[0] = a[0] - re_temp;
+                b[1] = a[1] - im_temp;
+                a[0] = a[0] + re_temp;
+                a[1] = a[1] + im_temp;
+                a += 2;
+                b += 2;
+            }
+        }
+        ie <<= 1;
+    }
+    return ESP_OK;
+}
+
+#endif // dsps_fft2r_fc32_rv32_enabled
@@ -81,6 +81,7 @@ void dsps_fft2r_deinit_sc16(void);
  * Complex FFT of radix 2
  * The extension (_ansi) use ANSI C and could be compiled and run on any platform.
  * The extension (_ae32) is optimized for ESP32 chip.
+ * The extension (_rv32) is optimized for RISC-V chips (ESP32-C6).
  *
  * @param[inout] data: input/output complex array. An elements located: Re[0], Im[0], ... Re[N-1], Im[N-1]
  *               result of FFT will be stored to this array.
@@ -97,6 +98,8 @@ esp_err_t dsps_fft2r_fc32_aes3_(float *data, int N, float *w);
 esp_err_t dsps_fft2r_sc16_ansi_(int16_t *data, int N, int16_t *w);
 esp_err_t dsps_fft2r_sc16_ae32_(int16_t *data, int N, int16_t *w);
 esp_err_t dsps_fft2r_sc16_aes3_(int16_t *data, int N, int16_t *w);
+esp_err_t dsps_fft2r_fc32_rv32_(float *data, int N, float *w);
+esp_err_t dsps_fft2r_sc16_rv32_(int16_t *data, int N, int16_t *w);
 /**@}*/
 // This is workaround because linker generates permanent error when assembler uses
 // direct access to the table pointer
@@ -106,6 +109,8 @@ esp_err_t dsps_fft2r_sc16_aes3_(int16_t *data, int N, int16_t *w);
 #define dsps_fft2r_sc16_aes3(data, N) dsps_fft2r_sc16_aes3_(data, N, dsps_fft_w_table_sc16)
 #define dsps_fft2r_fc32_ansi(data, N) dsps_fft2r_fc32_ansi_(data, N, dsps_fft_w_table_fc32)
 #define dsps_fft2r_sc16_ansi(data, N) dsps_fft2r_sc16_ansi_(data, N, dsps_fft_w_table_sc16)
+#define dsps_fft2r_fc32_rv32(data, N) dsps_fft2r_fc32_rv32_(data, N, dsps_fft_w_table_fc32)
+#define dsps_fft2r_sc16_rv32(data, N) dsps_fft2r_sc16_rv32_(data, N, dsps_fft_w_table_sc16)
 
 
 /**@{*/
@@ -205,11 +210,14 @@ esp_err_t dsps_gen_bitrev2r_table(int N, int step, char *name_ext);
 #if CONFIG_DSP_OPTIMIZED
 #define dsps_bit_rev_fc32 dsps_bit_rev_fc32_ansi
 #define dsps_cplx2reC_fc32 dsps_cplx2reC_fc32_ansi
+#define dsps_bit_rev_sc16 dsps_bit_rev_sc16_ansi
 
 #if (dsps_fft2r_fc32_aes3_enabled == 1)
 #define dsps_fft2r_fc32 dsps_fft2r_fc32_aes3
 #elif (dsps_fft2r_fc32_ae32_enabled == 1)
 #define dsps_fft2r_fc32 dsps_fft2r_fc32_ae32
+#elif (dsps_fft2r_fc32_rv32_enabled == 1)
+#define dsps_fft2r_fc32 dsps_fft2r_fc32_rv32
 #else
 #define dsps_fft2r_fc32 dsps_fft2r_fc32_ansi
 #endif
@@ -218,6 +226,8 @@ esp_err_t dsps_gen_bitrev2r_table(int N, int step, char *name_ext);
 #define dsps_fft2r_sc16 dsps_fft2r_sc16_aes3
 #elif (dsps_fft2r_sc16_ae32_enabled == 1)
 #define dsps_fft2r_sc16 dsps_fft2r_sc16_ae32
+#elif (dsps_fft2r_sc16_rv32_enabled == 1)
+#define dsps_fft2r_sc16 dsps_fft2r_sc16_rv32
 #else
 #define dsps_fft2r_sc16 dsps_fft2r_sc16_ansi
 #endif
@@ -235,6 +245,7 @@ esp_err_t dsps_gen_bitrev2r_table(int N, int step, char *name_ext);
 #else // CONFIG_DSP_OPTIMIZED
 
 #define dsps_fft2r_fc32 dsps_fft2r_fc32_ansi
+#define dsps_fft2r_sc16 dsps_fft2r_sc16_ansi
 #define dsps_bit_rev_fc32 dsps_bit_rev_fc32_ansi
 #define dsps_cplx2reC_fc32 dsps_cplx2reC_fc32_ansi
 #define dsps_bit_rev_sc16 dsps_bit_rev_sc16_ansi
@@ -158,8 +158,9 @@ esp_err_t dsps_gen_bitrev4r_table(int N, int step, char *name_ext);
 #define dsps_fft4r_fc32 dsps_fft4r_fc32_ansi
 #endif // dsps_fft4r_fc32_ae32_enabled
 
-#define dsps_fft4r_sc16 dsps_fft4r_sc16_ae32
-#define dsps_bit_rev4r_fc32 dsps_bit_rev4r_fc32_ae32
+// There are no optimized radix-4 bit reverse or sc16 implementations: keep the
+// generic ones (dsps_bit_rev4r_fc32 already uses the optimized lookup when available)
+#define dsps_fft4r_sc16 dsps_fft4r_sc16_ansi
 
 #if (dsps_cplx2real_fc32_ae32_enabled == 1)
 #define dsps_cplx2real_fc32 dsps_cplx2real_fc32_ae32
@@ -170,7 +171,6 @@ esp_err_t dsps_gen_bitrev4r_table(int N, int step, char *name_ext);
 #else
 #define dsps_fft4r_fc32 dsps_fft4r_fc32_ansi
 #define dsps_fft4r_sc16 dsps_fft4r_sc16_ansi
-#define dsps_bit_rev4r_fc32 dsps_bit_rev4r_fc32
 #define dsps_cplx2real_fc32 dsps_cplx2real_fc32_ansi
 #endif
 
@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_fft2r.h"
+#include "dsp_common.h"
+#include "dsp_tests.h"
+
+#if (dsps_fft2r_fc32_rv32_enabled == 1)
+
+static const char *TAG = "dsps_fft2r_rv32";
+
+#define FFT_MAX_N       1024
+
+__attribute__((aligned(16)))
+static float data_fc32[FFT_MAX_N * 2];
+__attribute__((aligned(16)))
+static float check_fc32[FFT_MAX_N * 2];
+__attribute__((aligned(16)))
+static int16_t data_sc16[FFT_MAX_N * 2];
+__attribute__((aligned(16)))
+static int16_t check_sc16[FFT_MAX_N * 2];
+
+TEST_CASE("dsps_fft2r_rv32 functionality", "[dsps]")
+{
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+    TEST_ESP_OK(dsps_fft2r_init_sc16(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+
+    for (int N = 4 ; N <= FFT_MAX_N ; N <<= 1) {
+        for (int i = 0 ; i < N * 2 ; i++) {
+            data_fc32[i] = (float)rand() / RAND_MAX - 0.5f;
+            data_sc16[i] = (int16_t)(rand() & 0xffff);
+        }
+        memcpy(check_fc32, data_fc32, N * 2 * sizeof(float));
+        memcpy(check_sc16, data_sc16, N * 2 * sizeof(int16_t));
+
+        TEST_ESP_OK(dsps_fft2r_fc32_rv32(data_fc32, N));
+        TEST_ESP_OK(dsps_fft2r_fc32_ansi(check_fc32, N));
+        for (int i = 0 ; i < N * 2 ; i++) {
+            TEST_ASSERT_EQUAL_FLOAT(check_fc32[i], data_fc32[i]);
+        }
+
+        // Fixed point version must be bit exact
+        TEST_ESP_OK(dsps_fft2r_sc16_rv32(data_sc16, N));
+        TEST_ESP_OK(dsps_fft2r_sc16_ansi(check_sc16, N));
+        TEST_ASSERT_EQUAL_INT16_ARRAY(check_sc16, data_sc16, N * 2);
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_fft2r_fc32_rv32(data_fc32, 100));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_fft2r_sc16_rv32(data_sc16, 100));
+
+    dsps_fft2r_deinit_fc32();
+    dsps_fft2r_deinit_sc16();
+}
+
+TEST_CASE("dsps_fft2r_rv32 benchmark", "[dsps]")
+{
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+    TEST_ESP_OK(dsps_fft2r_init_sc16(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+
+    for (int i = 5 ; i < 10 ; i++) {
+        int N_check = 2 << i;
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        dsps_fft2r_fc32_ansi(data_fc32, N_check);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        int cycles_ansi = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        dsps_fft2r_fc32_rv32(data_fc32, N_check);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_rv32 = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        dsps_fft2r_sc16_ansi(data_sc16, N_check);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_sc16_ansi = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        dsps_fft2r_sc16_rv32(data_sc16, N_check);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_sc16_rv32 = end_b - start_b;
+
+        ESP_LOGI(TAG, "%4i points FFT: fc32 ansi %8i, rv32 %8i cycles | sc16 ansi %8i, rv32 %8i cycles",
+                 N_check, cycles_ansi, cycles_rv32, cycles_sc16_ansi, cycles_sc16_rv32);
+        TEST_ASSERT_EXEC_IN_RANGE(1, cycles_ansi, cycles_rv32);
+        TEST_ASSERT_EXEC_IN_RANGE(1, cycles_sc16_ansi, cycles_sc16_rv32);
+    }
+    dsps_fft2r_deinit_fc32();
+    dsps_fft2r_deinit_sc16();
+}
+
+#endif // dsps_fft2r_fc32_rv32_enabled
@@ -0,0 +1,80 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "dsps_fir.h"
+
+#if (dsps_fird_s16_rv32_enabled == 1)
+
+// Two int16 products add up to [-0x7FFF0000, 0x80000000]. Adding this offset makes
+// the sum of a pair fit in an uint32_t, so the 64 bit accumulator only needs an
+// unsigned add with carry (see dsps_dotprod_s16_rv32).
+#define FIRD_PAIR_BIAS      0x7FFF0000u
+
+// Exact sum of coeffs[coeff_pos - k] * delay[k], k = [0..len): coefficients are walked backwards
+static inline int64_t fird_s16_mac(const int16_t *coeffs, int coeff_pos, const int16_t *delay, int len)
+{
+    uint64_t acc = 0;
+    uint32_t t;
+    int pairs = len >> 1;
+
+    for (int i = 0 ; i < pairs ; i++) {
+        t = (uint32_t)(coeffs[coeff_pos] * delay[0]) + (uint32_t)(coeffs[coeff_pos - 1] * delay[1]) + FIRD_PAIR_BIAS;
+        acc += t;
+        coeff_pos -= 2;
+        delay += 2;
+    }
+    int64_t sum = (int64_t)(acc - (uint64_t)pairs * FIRD_PAIR_BIAS);
+    if (len & 1) {
+        sum += coeffs[coeff_pos] * delay[0];
+    }
+    return sum;
+}
+
+int32_t dsps_fird_s16_rv32(fir_s16_t *fir, const int16_t *input, int16_t *output, int32_t len)
+{
+    int32_t result = 0;
+    int32_t input_pos = 0;
+    long long rounding = 0;
+    const int32_t final_shift = fir->shift - 15;
+    const int16_t *coeffs = fir->coeffs;
+    int16_t *delay = fir->delay;
+    const int32_t coeffs_len = fir->coeffs_len;
+    int32_t pos = fir->pos;
+
+    rounding = (long long)(fir->rounding_val);
+
+    if (fir->shift >= 0) {
+        rounding = (rounding >> fir->shift) & 0xFFFFFFFFFF;         // 40-bit mask
+    } else {
+        rounding = (rounding << (-fir->shift)) & 0xFFFFFFFFFF;      // 40-bit mask
+    }
+
+    // len is already a length of the *output array, calculated as (length of the input array / decimation)
+    for (int i = 0; i < len; i++) {
+
+        for (int j = 0; j < fir->decim - fir->d_pos; j++) {
+
+            if (pos >= coeffs_len) {
+                pos = 0;
+            }
+            delay[pos++] = input[input_pos++];
+        }
+        fir->d_pos = 0;
+
+        long long acc = rounding;
+        acc += fird_s16_mac(coeffs, coeffs_len - 1, &delay[pos], coeffs_len - pos);
+        acc += fird_s16_mac(coeffs, pos - 1, delay, pos);
+
+        if (final_shift > 0) {
+            output[result++] = (int16_t)(acc << final_shift);
+        } else {
+            output[result++] = (int16_t)(acc >> (-final_shift));
+        }
+
+    }
+    fir->pos = pos;
+    return result;
+}
+
+#endif // dsps_fird_s16_rv32_enabled
@@ -0,0 +1,50 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "dsps_fir.h"
+
+#if (dsps_fir_f32_rv32_enabled == 1)
+
+static inline float fir_f32_mac(float acc, const float *coeffs, const float *delay, int len)
+{
+    const float *end = delay + (len & ~3);
+
+    while (delay < end) {
+        acc += coeffs[0] * delay[0];
+        acc += coeffs[1] * delay[1];
+        acc += coeffs[2] * delay[2];
+        acc += coeffs[3] * delay[3];
+        coeffs += 4;
+        delay += 4;
+    }
+    for (int n = 0 ; n < (len & 3) ; n++) {
+        acc += coeffs[n] * delay[n];
+    }
+    return acc;
+}
+
+// Filter state is kept in registers during the whole call (the ANSI version reloads
+// it for every sample, since output may alias the structure). The sum order is the
+// same as in the ANSI version, so results are bit exact.
+esp_err_t dsps_fir_f32_rv32(fir_f32_t *fir, const float *input, float *output, int len)
+{
+    const float *coeffs = fir->coeffs;
+    float *delay = fir->delay;
+    const int N = fir->N;
+    int pos = fir->pos;
+
+    for (int i = 0 ; i < len ; i++) {
+        delay[pos] = input[i];
+        pos++;
+        if (pos >= N) {
+            pos = 0;
+        }
+        float acc = fir_f32_mac(0, coeffs, &delay[pos], N - pos);
+        output[i] = fir_f32_mac(acc, &coeffs[N - pos], delay, pos);
+    }
+    fir->pos = pos;
+    return ESP_OK;
+}
+
+#endif // dsps_fir_f32_rv32_enabled
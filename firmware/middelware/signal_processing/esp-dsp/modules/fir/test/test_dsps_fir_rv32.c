@@ -0,0 +1,140 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+#include <malloc.h>
+
+#include "dsps_fir.h"
+#include "dsp_common.h"
+#include "dsp_tests.h"
+
+#if (dsps_fir_f32_rv32_enabled == 1)
+
+static const char *TAG = "dsps_fir_rv32";
+
+#define FIR_LEN         1024
+#define FIR_COEFFS      64
+#define FIR_DECIM       4
+
+TEST_CASE("dsps_fir_f32_rv32 functionality", "[dsps]")
+{
+    float *x = (float *)malloc(FIR_LEN * sizeof(float));
+    float *y = (float *)malloc(FIR_LEN * sizeof(float));
+    float *z = (float *)malloc(FIR_LEN * sizeof(float));
+    float coeffs[FIR_COEFFS];
+    float delay_ansi[FIR_COEFFS + 4];
+    float delay_rv32[FIR_COEFFS + 4];
+    fir_f32_t fir_ansi, fir_rv32;
+
+    for (int i = 0 ; i < FIR_LEN ; i++) {
+        x[i] = (float)rand() / RAND_MAX - 0.5f;
+    }
+    for (int n = 1 ; n <= FIR_COEFFS ; n += 7) {
+        for (int i = 0 ; i < n ; i++) {
+            coeffs[i] = (float)rand() / RAND_MAX;
+        }
+        dsps_fir_init_f32(&fir_ansi, coeffs, delay_ansi, n);
+        dsps_fir_init_f32(&fir_rv32, coeffs, delay_rv32, n);
+        // Two calls, to check the delay line position is kept between blocks
+        for (int k = 0 ; k < 2 ; k++) {
+            dsps_fir_f32_ansi(&fir_ansi, x, y, FIR_LEN - 3 * k);
+            dsps_fir_f32_rv32(&fir_rv32, x, z, FIR_LEN - 3 * k);
+            TEST_ASSERT_EQUAL(fir_ansi.pos, fir_rv32.pos);
+            TEST_ASSERT_EQUAL_MEMORY(y, z, (FIR_LEN - 3 * k) * sizeof(float));
+        }
+    }
+    free(x);
+    free(y);
+    free(z);
+}
+
+TEST_CASE("dsps_fird_s16_rv32 functionality", "[dsps]")
+{
+    int16_t *x = (int16_t *)malloc(FIR_LEN * sizeof(int16_t));
+    int16_t *y = (int16_t *)malloc(FIR_LEN * sizeof(int16_t));
+    int16_t *z = (int16_t *)malloc(FIR_LEN * sizeof(int16_t));
+    int16_t coeffs[FIR_COEFFS];
+    int16_t delay_ansi[FIR_COEFFS];
+    int16_t delay_rv32[FIR_COEFFS];
+    fir_s16_t fir_ansi, fir_rv32;
+
+    for (int i = 0 ; i < FIR_LEN ; i++) {
+        x[i] = (i & 7) ? (int16_t)(rand() & 0xffff) : INT16_MIN;
+    }
+    for (int n = 2 ; n <= FIR_COEFFS ; n += 5) {
+        for (int i = 0 ; i < n ; i++) {
+            coeffs[i] = (i & 3) ? (int16_t)(rand() & 0xffff) : INT16_MIN;
+        }
+        for (int16_t shift = -5 ; shift <= 15 ; shift += 10) {
+            memset(delay_ansi, 0, sizeof(delay_ansi));
+            memset(delay_rv32, 0, sizeof(delay_rv32));
+            dsps_fird_init_s16(&fir_ansi, coeffs, delay_ansi, n, FIR_DECIM, 0, shift);
+            dsps_fird_init_s16(&fir_rv32, coeffs, delay_rv32, n, FIR_DECIM, 0, shift);
+            int32_t len_ansi = dsps_fird_s16_ansi(&fir_ansi, x, y, FIR_LEN / FIR_DECIM);
+            int32_t len_rv32 = dsps_fird_s16_rv32(&fir_rv32, x, z, FIR_LEN / FIR_DECIM);
+            TEST_ASSERT_EQUAL(len_ansi, len_rv32);
+            TEST_ASSERT_EQUAL(fir_ansi.pos, fir_rv32.pos);
+            TEST_ASSERT_EQUAL_INT16_ARRAY(y, z, len_ansi);
+            dsps_fird_s16_aexx_free(&fir_ansi);
+            dsps_fird_s16_aexx_free(&fir_rv32);
+        }
+    }
+    free(x);
+    free(y);
+    free(z);
+}
+
+TEST_CASE("dsps_fir_rv32 benchmark", "[dsps]")
+{
+    float *x = (float *)calloc(FIR_LEN, sizeof(float));
+    float *y = (float *)calloc(FIR_LEN, sizeof(float));
+    int16_t *sx = (int16_t *)calloc(FIR_LEN, sizeof(int16_t));
+    int16_t *sy = (int16_t *)calloc(FIR_LEN, sizeof(int16_t));
+    float coeffs[FIR_COEFFS] = {0};
+    float delay[FIR_COEFFS + 4];
+    int16_t scoeffs[FIR_COEFFS] = {0};
+    int16_t sdelay[FIR_COEFFS];
+    fir_f32_t fir;
+    fir_s16_t sfir;
+
+    dsps_fir_init_f32(&fir, coeffs, delay, FIR_COEFFS);
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    dsps_fir_f32_ansi(&fir, x, y, FIR_LEN);
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    float cycles_ansi = (float)(end_b - start_b) / FIR_LEN;
+
+    start_b = dsp_get_cpu_cycle_count();
+    dsps_fir_f32_rv32(&fir, x, y, FIR_LEN);
+    end_b = dsp_get_cpu_cycle_count();
+    float cycles_rv32 = (float)(end_b - start_b) / FIR_LEN;
+
+    dsps_fird_init_s16(&sfir, scoeffs, sdelay, FIR_COEFFS, FIR_DECIM, 0, 0);
+    start_b = dsp_get_cpu_cycle_count();
+    dsps_fird_s16_ansi(&sfir, sx, sy, FIR_LEN / FIR_DECIM);
+    end_b = dsp_get_cpu_cycle_count();
+    float cycles_s16_ansi = (float)(end_b - start_b) / (FIR_LEN / FIR_DECIM);
+
+    start_b = dsp_get_cpu_cycle_count();
+    dsps_fird_s16_rv32(&sfir, sx, sy, FIR_LEN / FIR_DECIM);
+    end_b = dsp_get_cpu_cycle_count();
+    float cycles_s16_rv32 = (float)(end_b - start_b) / (FIR_LEN / FIR_DECIM);
+    dsps_fird_s16_aexx_free(&sfir);
+
+    ESP_LOGI(TAG, "dsps_fir_f32_ansi  - %f per output sample (%i coeffs)", cycles_ansi, FIR_COEFFS);
+    ESP_LOGI(TAG, "dsps_fir_f32_rv32  - %f per output sample (%i coeffs)", cycles_rv32, FIR_COEFFS);
+    ESP_LOGI(TAG, "dsps_fird_s16_ansi - %f per output sample (%i coeffs)", cycles_s16_ansi, FIR_COEFFS);
+    ESP_LOGI(TAG, "dsps_fird_s16_rv32 - %f per output sample (%i coeffs)", cycles_s16_rv32, FIR_COEFFS);
+    TEST_ASSERT_EXEC_IN_RANGE(1, cycles_ansi, cycles_rv32);
+    TEST_ASSERT_EXEC_IN_RANGE(1, cycles_s16_ansi, cycles_s16_rv32);
+
+    free(x);
+    free(y);
+    free(sx);
+    free(sy);
+}
+
+#endif // dsps_fir_f32_rv32_enabled
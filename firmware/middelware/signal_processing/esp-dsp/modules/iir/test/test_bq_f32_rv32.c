@@ -0,0 +1,83 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_d_gen.h"
+#include "dsps_biquad_gen.h"
+#include "dsps_biquad.h"
+#include "dsp_common.h"
+#include "dsp_tests.h"
+
+#if (dsps_biquad_f32_rv32_enabled == 1)
+
+static const char *TAG = "dsps_biquad_f32_rv32";
+static const int bq_len = 1024;
+
+TEST_CASE("dsps_biquad_f32_rv32 functionality", "[dsps]")
+{
+    float *x = calloc(bq_len, sizeof(float));
+    float *y = calloc(bq_len, sizeof(float));
+    float *z = calloc(bq_len, sizeof(float));
+
+    int len = bq_len;
+    dsps_d_gen_f32(x, len, 0);
+    float coeffs[5];
+    float w1[2] = {0};
+    float w2[2] = {0};
+    dsps_biquad_gen_lpf_f32(coeffs, 0.1, 1);
+    dsps_biquad_f32_rv32(x, y, len, coeffs, w1);
+    dsps_biquad_f32_ansi(x, z, len, coeffs, w2);
+
+    // Same operations in the same order: results must be bit exact
+    for (int i = 0 ; i < len ; i++) {
+        if (y[i] != z[i]) {
+            ESP_LOGE(TAG, "[%i]calc = %f, expected=%f", i, y[i], z[i]);
+            TEST_ASSERT_EQUAL_FLOAT(z[i], y[i]);
+        }
+    }
+    TEST_ASSERT_EQUAL_FLOAT(w2[0], w1[0]);
+    TEST_ASSERT_EQUAL_FLOAT(w2[1], w1[1]);
+    free(x);
+    free(y);
+    free(z);
+}
+
+TEST_CASE("dsps_biquad_f32_rv32 benchmark", "[dsps]")
+{
+    float *x = calloc(bq_len, sizeof(float));
+    float *y = calloc(bq_len, sizeof(float));
+
+    float w1[2] = {0};
+    int len = bq_len;
+    int repeat_count = 16;
+    dsps_d_gen_f32(x, len, 0);
+    float coeffs[5];
+    dsps_biquad_gen_lpf_f32(coeffs, 0.1, 1);
+
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_biquad_f32_rv32(x, y, len, coeffs, w1);
+    }
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    float cycles = (float)(end_b - start_b) / (len * repeat_count);
+
+    start_b = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_biquad_f32_ansi(x, y, len, coeffs, w1);
+    }
+    end_b = dsp_get_cpu_cycle_count();
+    float cycles_ansi = (float)(end_b - start_b) / (len * repeat_count);
+
+    ESP_LOGI(TAG, "dsps_biquad_f32_rv32 - %f per sample", cycles);
+    ESP_LOGI(TAG, "dsps_biquad_f32_ansi - %f per sample", cycles_ansi);
+    TEST_ASSERT_EXEC_IN_RANGE(1, cycles_ansi, cycles);
+    free(x);
+    free(y);
+}
+
+#endif // dsps_biquad_f32_rv32_enabled
@@ -0,0 +1,145 @@
+#ifndef CONVOLUTION_H_
+#define CONVOLUTION_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Convolution Convolution
+ */
+
+/** \brief Convolution and correlation with automatic direct / FFT selection
+ *
+ * Short kernels are computed with the esp-dsp direct routines (dsps_conv_f32,
+ * dsps_corr_f32, O(N * M)). From a crossover kernel lenght on, overlap-add
+ * FFT convolution is used instead (O(N * log M)): each FFT carries two signal
+ * blocks (one in the real part and one in the imaginary part, the kernel is
+ * real), so real signals do not waste half of every transform.
+ *
+ * For continuous filtering with long kernels, FastFIR keeps the kernel
+ * spectrum and filters fixed size blocks with overlap-save.
+ *
+ * The crossover defaults to CONV_DEFAULT_CROSSOVER and can be measured on the
+ * target with ConvBenchmark(), which logs direct and FFT times per kernel lenght.
+ *
+ * @note The FFT work buffer is shared: these functions must be called from a single task.
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define CONV_MAX_FFT            1024    /*!< Max FFT size (kernels up to CONV_MAX_FFT / 2) */
+#define CONV_DEFAULT_CROSSOVER  64      /*!< Kernel lenght from which FFT convolution is used */
+/*==================[typedef]================================================*/
+/**
+ * @brief Overlap-save FIR filter (fixed block size)
+ */
+typedef struct {
+    float spectrum[2 * CONV_MAX_FFT];       /*!< Kernel spectrum (interleaved complex) */
+    float history[CONV_MAX_FFT / 2];        /*!< Last kernel_lenght - 1 input samples */
+    uint16_t fft_lenght;                    /*!< FFT size */
+    uint16_t kernel_lenght;                 /*!< Number of coefficients */
+    uint16_t block;                         /*!< Samples per call (2 FFT frames) */
+} fast_fir_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize the convolution module (FFT tables)
+ *
+ * @return true     Initialized
+ * @return false    Not possible to initialize FFT
+ */
+bool ConvInit(void);
+
+/**
+ * @brief Linear convolution (same result as dsps_conv_f32)
+ *
+ * @param signal            Input signal array
+ * @param signal_lenght     Lenght of signal array
+ * @param kernel            Kernel array
+ * @param kernel_lenght     Lenght of kernel array
+ * @param output            Output array (of lenght = signal_lenght + kernel_lenght - 1)
+ * @return true             Convolution computed
+ * @return false            Invalid parameters
+ */
+bool ConvolveF32(const float * signal, uint16_t signal_lenght, const float * kernel, uint16_t kernel_lenght, float * output);
+
+/**
+ * @brief Cross-correlation (same result as dsps_corr_f32):
+ * output[n] = sum(signal[n + m] * pattern[m])
+ *
+ * @param signal            Input signal array
+ * @param signal_lenght     Lenght of signal array
+ * @param pattern           Pattern (template) array
+ * @param pattern_lenght    Lenght of pattern array (up to signal_lenght)
+ * @param output            Output array (of lenght = signal_lenght - pattern_lenght + 1)
+ * @return true             Correlation computed
+ * @return false            Invalid parameters
+ */
+bool CorrelateF32(const float * signal, uint16_t signal_lenght, const float * pattern, uint16_t pattern_lenght, float * output);
+
+/**
+ * @brief Set the kernel lenght from which the FFT method is used
+ *
+ * @param kernel_lenght     Crossover kernel lenght (0: always direct)
+ */
+void ConvSetCrossover(uint16_t kernel_lenght);
+
+/**
+ * @brief Measure direct and FFT convolution times for kernel lenghts from 8 to
+ * CONV_MAX_FFT / 2, log them and set the crossover to the shortest kernel for
+ * which FFT was faster.
+ *
+ * @note Allocates its test buffers from the heap while running.
+ *
+ * @param signal_lenght     Signal lenght used in the measurements
+ * @return uint16_t         Crossover kernel lenght (0 if not possible to allocate buffers)
+ */
+uint16_t ConvBenchmark(uint16_t signal_lenght);
+
+/**
+ * @brief Initialize an overlap-save FIR filter
+ *
+ * @param filter            Filter to initialize
+ * @param kernel            Coefficients
+ * @param kernel_lenght     Number of coefficients (2 to CONV_MAX_FFT / 2)
+ * @return true             Filter initialized
+ * @return false            Invalid parameters
+ */
+bool FastFIRInit(fast_fir_t * filter, const float * kernel, uint16_t kernel_lenght);
+
+/**
+ * @brief Samples per FastFIRProcess() call
+ *
+ * @param filter    Initialized filter
+ * @return uint16_t Block size
+ */
+uint16_t FastFIRBlock(const fast_fir_t * filter);
+
+/**
+ * @brief Filter one block of samples
+ *
+ * @note Input and output can be the same array.
+ *
+ * @param filter    Initialized filter
+ * @param input     Input samples (of lenght = FastFIRBlock())
+ * @param output    Filtered samples (of lenght = FastFIRBlock())
+ */
+void FastFIRProcess(fast_fir_t * filter, const float * input, float * output);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* CONVOLUTION_H_ */
+
+/*==================[end of file]============================================*/
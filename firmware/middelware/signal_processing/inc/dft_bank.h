@@ -0,0 +1,236 @@
+#ifndef DFT_BANK_H_
+#define DFT_BANK_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup DFT_Bank DFT bank
+ */
+
+/** \brief Single bin DFT banks (Goertzel and sliding DFT) for tone tracking
+ *
+ * A few known frequencies (mains hum, motor harmonics, alarm tones) are tracked
+ * sample by sample in O(bins), without FFT buffers:
+ * - Goertzel: block based, any frequency (not restricted to bins). The magnitude
+ * is updated once every block.
+ * - Sliding DFT: magnitude of the last lenght samples, updated every sample.
+ * Frequencies are rounded to the nearest bin (sample_freq / lenght). The
+ * window is kept in a non rotating form (the twiddle of each sample is added
+ * when it enters and removed when it leaves), so it does not drift: the fixed
+ * point version is exact, the floating point one restarts from a fresh sum
+ * every lenght samples.
+ *
+ * Magnitudes are amplitudes: a sine of amplitude A at a bin frequency gives A.
+ * Fixed point variants take Q15 samples and do only integer operations per sample.
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define DFT_BANK_MAX_BINS   8       /*!< Max frequencies tracked by a bank */
+#define SDFT_MAX_LENGHT     512     /*!< Max sliding DFT window lenght */
+/*==================[typedef]================================================*/
+/**
+ * @brief Floating point Goertzel bank
+ */
+typedef struct {
+    float coeff[DFT_BANK_MAX_BINS];     /*!< 2 * cos(w) */
+    float s1[DFT_BANK_MAX_BINS];        /*!< Resonator states */
+    float s2[DFT_BANK_MAX_BINS];
+    float mag[DFT_BANK_MAX_BINS];       /*!< Magnitudes of the last block */
+    uint16_t block;                     /*!< Samples per block */
+    uint16_t count;                     /*!< Samples in the current block */
+    uint8_t bins;                       /*!< Number of frequencies */
+} goertzel_f32_t;
+
+/**
+ * @brief Fixed point Goertzel bank
+ */
+typedef struct {
+    int32_t coeff[DFT_BANK_MAX_BINS];   /*!< 2 * cos(w) (Q29) */
+    int32_t s1[DFT_BANK_MAX_BINS];      /*!< Resonator states */
+    int32_t s2[DFT_BANK_MAX_BINS];
+    int16_t mag[DFT_BANK_MAX_BINS];     /*!< Magnitudes of the last block (Q15) */
+    uint16_t block;                     /*!< Samples per block */
+    uint16_t count;                     /*!< Samples in the current block */
+    uint8_t bins;                       /*!< Number of frequencies */
+    uint8_t shift;                      /*!< Input right shift (state headroom) */
+} goertzel_q15_t;
+
+/**
+ * @brief Floating point sliding DFT bank
+ */
+typedef struct {
+    float cos_t[SDFT_MAX_LENGHT];       /*!< Twiddle table */
+    float sin_t[SDFT_MAX_LENGHT];
+    float history[SDFT_MAX_LENGHT];     /*!< Last lenght samples (circular) */
+    float re[DFT_BANK_MAX_BINS];        /*!< Bins of the window */
+    float im[DFT_BANK_MAX_BINS];
+    float fresh_re[DFT_BANK_MAX_BINS];  /*!< Bins of the samples since the last wrap */
+    float fresh_im[DFT_BANK_MAX_BINS];
+    uint16_t k[DFT_BANK_MAX_BINS];      /*!< Bin index of each frequency */
+    uint16_t idx[DFT_BANK_MAX_BINS];    /*!< Twiddle index of the current sample */
+    uint16_t lenght;                    /*!< Window lenght */
+    uint16_t pos;                       /*!< Next write position in the history */
+    uint8_t bins;                       /*!< Number of frequencies */
+} sdft_f32_t;
+
+/**
+ * @brief Fixed point sliding DFT bank
+ */
+typedef struct {
+    int16_t cos_t[SDFT_MAX_LENGHT];     /*!< Twiddle table (Q15) */
+    int16_t sin_t[SDFT_MAX_LENGHT];
+    int16_t history[SDFT_MAX_LENGHT];   /*!< Last lenght samples (circular) */
+    int64_t re[DFT_BANK_MAX_BINS];      /*!< Bins of the window (Q30, exact) */
+    int64_t im[DFT_BANK_MAX_BINS];
+    uint16_t k[DFT_BANK_MAX_BINS];      /*!< Bin index of each frequency */
+    uint16_t idx[DFT_BANK_MAX_BINS];    /*!< Twiddle index of the current sample */
+    uint16_t lenght;                    /*!< Window lenght */
+    uint16_t pos;                       /*!< Next write position in the history */
+    uint8_t bins;                       /*!< Number of frequencies */
+} sdft_q15_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a floating point Goertzel bank
+ *
+ * @param bank          Bank to initialize
+ * @param sample_freq   Signal's sample frequency
+ * @param freqs         Frequencies to track (0 to sample_freq / 2)
+ * @param bins          Number of frequencies (1 to DFT_BANK_MAX_BINS)
+ * @param block         Samples per block (frequency resolution = sample_freq / block)
+ * @return true         Bank initialized
+ * @return false        Invalid parameters
+ */
+bool GoertzelInitF32(goertzel_f32_t * bank, float sample_freq, const float * freqs, uint8_t bins, uint16_t block);
+
+/**
+ * @brief Process new samples
+ *
+ * @param bank      Goertzel bank
+ * @param samples   Array of new samples
+ * @param lenght    Number of samples
+ * @return uint16_t Number of blocks completed (magnitudes updated if > 0)
+ */
+uint16_t GoertzelProcessF32(goertzel_f32_t * bank, const float * samples, uint16_t lenght);
+
+/**
+ * @brief Copy the magnitudes of the last completed block
+ *
+ * @param bank  Goertzel bank
+ * @param mag   Array to store the magnitudes (of lenght = bins)
+ */
+void GoertzelGetMagnitudeF32(const goertzel_f32_t * bank, float * mag);
+
+/**
+ * @brief Initialize a fixed point Goertzel bank
+ *
+ * @note The input is scaled down when needed so the states never overflow
+ * (only for long blocks or frequencies close to 0 or sample_freq / 2).
+ *
+ * @param bank          Bank to initialize
+ * @param sample_freq   Signal's sample frequency
+ * @param freqs         Frequencies to track (0 to sample_freq / 2)
+ * @param bins          Number of frequencies (1 to DFT_BANK_MAX_BINS)
+ * @param block         Samples per block (frequency resolution = sample_freq / block)
+ * @return true         Bank initialized
+ * @return false        Invalid parameters
+ */
+bool GoertzelInitQ15(goertzel_q15_t * bank, float sample_freq, const float * freqs, uint8_t bins, uint16_t block);
+
+/**
+ * @brief Process new samples
+ *
+ * @param bank      Goertzel bank
+ * @param samples   Array of new samples (Q15)
+ * @param lenght    Number of samples
+ * @return uint16_t Number of blocks completed (magnitudes updated if > 0)
+ */
+uint16_t GoertzelProcessQ15(goertzel_q15_t * bank, const int16_t * samples, uint16_t lenght);
+
+/**
+ * @brief Copy the magnitudes of the last completed block
+ *
+ * @param bank  Goertzel bank
+ * @param mag   Array to store the magnitudes (Q15, of lenght = bins)
+ */
+void GoertzelGetMagnitudeQ15(const goertzel_q15_t * bank, int16_t * mag);
+
+/**
+ * @brief Initialize a floating point sliding DFT bank
+ *
+ * @param bank          Bank to initialize
+ * @param sample_freq   Signal's sample frequency
+ * @param freqs         Frequencies to track (rounded to the nearest bin)
+ * @param bins          Number of frequencies (1 to DFT_BANK_MAX_BINS)
+ * @param lenght        Window lenght (2 to SDFT_MAX_LENGHT)
+ * @return true         Bank initialized
+ * @return false        Invalid parameters
+ */
+bool SDFTInitF32(sdft_f32_t * bank, float sample_freq, const float * freqs, uint8_t bins, uint16_t lenght);
+
+/**
+ * @brief Process new samples
+ *
+ * @param bank      Sliding DFT bank
+ * @param samples   Array of new samples
+ * @param lenght    Number of samples
+ */
+void SDFTProcessF32(sdft_f32_t * bank, const float * samples, uint16_t lenght);
+
+/**
+ * @brief Magnitudes of the last lenght samples
+ *
+ * @param bank  Sliding DFT bank
+ * @param mag   Array to store the magnitudes (of lenght = bins)
+ */
+void SDFTGetMagnitudeF32(const sdft_f32_t * bank, float * mag);
+
+/**
+ * @brief Initialize a fixed point sliding DFT bank
+ *
+ * @param bank          Bank to initialize
+ * @param sample_freq   Signal's sample frequency
+ * @param freqs         Frequencies to track (rounded to the nearest bin)
+ * @param bins          Number of frequencies (1 to DFT_BANK_MAX_BINS)
+ * @param lenght        Window lenght (2 to SDFT_MAX_LENGHT)
+ * @return true         Bank initialized
+ * @return false        Invalid parameters
+ */
+bool SDFTInitQ15(sdft_q15_t * bank, float sample_freq, const float * freqs, uint8_t bins, uint16_t lenght);
+
+/**
+ * @brief Process new samples
+ *
+ * @param bank      Sliding DFT bank
+ * @param samples   Array of new samples (Q15)
+ * @param lenght    Number of samples
+ */
+void SDFTProcessQ15(sdft_q15_t * bank, const int16_t * samples, uint16_t lenght);
+
+/**
+ * @brief Magnitudes of the last lenght samples
+ *
+ * @param bank  Sliding DFT bank
+ * @param mag   Array to store the magnitudes (Q15, of lenght = bins)
+ */
+void SDFTGetMagnitudeQ15(const sdft_q15_t * bank, int16_t * mag);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* DFT_BANK_H_ */
+
+/*==================[end of file]============================================*/
@@ -8,6 +8,16 @@
  */
 
 /** \brief Functionalities to calculate FFT
+ * 
+ * Real signals are transformed as a complex FFT of half the lenght (even and odd
+ * samples packed as real and imaginary parts), split afterwards:
+ * - Power of two lenghts use the esp-dsp radix-4 kernel when the half lenght is
+ * a power of 4, radix-2 otherwise. Twiddle tables are const (in flash), so
+ * FFTInit() does not allocate nor generate anything.
+ * - Other even lenghts whose half has only 2, 3 and 5 as factors (e.g. 1000, 1500)
+ * use a mixed radix FFT, so bins can match round frequencies at the actual sample
+ * rate. Its twiddles (signal_lenght complex values) are allocated from the heap
+ * when the lenght changes.
  * 
  * @author Peñalva Albano
  *
@@ -16,6 +26,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 18/10/2026 | Radix-4, mixed radix lenghts and flash twiddle tables					|
  * 
  **/
 
@@ -37,10 +48,19 @@
  */
 bool FFTInit(void);
 
+/**
+ * @brief Check if a signal lenght is supported by FFTMagnitude()
+ * 
+ * @param signal_lenght     Lenght of signal array
+ * @return true             Power of two, or even with only 2, 3 and 5 as factors (8 to MAX_SIGNAL_LENGHT)
+ * @return false            Not supported
+ */
+bool FFTCheckLenght(uint16_t signal_lenght);
+
 /**
  * @brief Calculates the Fast Fourier Transform of a given signal
  * 
- * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ * @note  Lenght of signal array must be supported (see FFTCheckLenght()), otherwise fft is not modified
  * 
  * @param signal            Array with signal values (of lenght = signal_lenght)
  * @param fft               Array to store FFT magnitude values (of lenght = signal_lenght / 2)
@@ -0,0 +1,44 @@
+#ifndef FFT_TABLES_H_
+#define FFT_TABLES_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup FFT Fast Fourier Transform
+ ** @{ */
+
+/** \brief Precomputed esp-dsp twiddle tables (const, placed in flash)
+ *
+ * Same contents dsps_fft2r_init_fc32() and dsps_fft4r_init_fc32() would
+ * generate in RAM, for complex FFTs up to FFT_MAX_COMPLEX_LENGHT points
+ * (real signals up to MAX_SIGNAL_LENGHT samples).
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define FFT_MAX_COMPLEX_LENGHT  1024                            /*!< Max complex FFT size covered by the tables */
+#define FFT_W2R_TABLE_SIZE      FFT_MAX_COMPLEX_LENGHT          /*!< Radix-2 table: N / 2 bit reversed twiddles */
+#define FFT_W4R_TABLE_SIZE      (4 * FFT_MAX_COMPLEX_LENGHT)    /*!< Radix-4 table: 2 * N (cos, sin) pairs */
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+extern const float fft_w2r_table[FFT_W2R_TABLE_SIZE];
+extern const float fft_w4r_table[FFT_W4R_TABLE_SIZE];
+/*==================[external functions declaration]=========================*/
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FFT_TABLES_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,125 @@
+#ifndef FIR_FILTER_H_
+#define FIR_FILTER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup FIR_Filter FIR Filter
+ */
+
+/** \brief Fixed point (Q15) FIR filters
+ * 
+ * FIR filters on int16_t samples, computed with esp-dsp dsps_fird_s16 (integer
+ * multiply-accumulate with 64 bit accumulation, no floating point per sample).
+ * Coefficients can be given by the user (Q15) or designed at init with the
+ * windowed-sinc method (Hamming window).
+ * 
+ * Each fir_q15_t is an independent filter, so one can be declared per channel.
+ * 
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ * | 18/10/2026 | FIRDesignLowPass() made public (used by multirate)					|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "dsps_fir.h"
+/*==================[macros]=================================================*/
+#define FIR_MAX_TAPS    128     /*!< Max number of coefficients of a filter */
+/*==================[typedef]================================================*/
+/**
+ * @brief Fixed point FIR filter
+ */
+typedef struct {
+    fir_s16_t fir;                      /*!< esp-dsp filter structure */
+    int16_t coeffs[FIR_MAX_TAPS];       /*!< Coefficients (Q15) */
+    int16_t delay[FIR_MAX_TAPS];        /*!< Delay line */
+} fir_q15_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Windowed-sinc (Hamming) low pass design with unity DC gain
+ * 
+ * @param h         Array to store the coefficients (of lenght = taps)
+ * @param norm_cut  Cut-off frequency (-6 dB) normalized to the sample frequency (0 to 0.5)
+ * @param taps      Number of coefficients
+ */
+void FIRDesignLowPass(float * h, float norm_cut, uint16_t taps);
+
+/**
+ * @brief Initialize a FIR filter with the given coefficients
+ * 
+ * @param filter    Filter to initialize
+ * @param coeffs    Coefficients (Q15), coeffs[0] is applied to the newest sample
+ * @param taps      Number of coefficients (2 to FIR_MAX_TAPS)
+ * @return true     Filter initialized
+ * @return false    Invalid number of coefficients
+ */
+bool FIRInitQ15(fir_q15_t * filter, const int16_t * coeffs, uint16_t taps);
+
+/**
+ * @brief Design and initialize a linear phase FIR Low Pass Filter (unity DC gain)
+ * 
+ * @param filter        Filter to initialize
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency (-6 dB)
+ * @param taps          Number of coefficients (2 to FIR_MAX_TAPS)
+ * @return true         Filter initialized
+ * @return false        Invalid parameters
+ */
+bool FIRLowPassInitQ15(fir_q15_t * filter, float sample_frec, float cut_frec, uint16_t taps);
+
+/**
+ * @brief Design and initialize a linear phase FIR Hi Pass Filter
+ * 
+ * @param filter        Filter to initialize
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency (-6 dB)
+ * @param taps          Number of coefficients (odd, 3 to FIR_MAX_TAPS - 1)
+ * @return true         Filter initialized
+ * @return false        Invalid parameters
+ */
+bool FIRHiPassInitQ15(fir_q15_t * filter, float sample_frec, float cut_frec, uint16_t taps);
+
+/**
+ * @brief Apply a FIR filter to a signal array
+ * 
+ * @note Input and output can be the same array.
+ * 
+ * @param filter            Filter (initialized with one of the init functions)
+ * @param input_signal      Input signal array (Q15)
+ * @param output_signal     Filtered signal array (Q15)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void FIRFilterQ15(fir_q15_t * filter, const int16_t * input_signal, int16_t * output_signal, uint16_t signal_lenght);
+
+/**
+ * @brief Clear the delay line of a FIR filter (coefficients are kept)
+ * 
+ * @param filter    Filter to reset
+ */
+void FIRResetQ15(fir_q15_t * filter);
+
+/**
+ * @brief Free the resources allocated by esp-dsp at init
+ * 
+ * @note Must be called before initializing the same filter again.
+ * 
+ * @param filter    Filter to de-initialize
+ */
+void FIRDeinitQ15(fir_q15_t * filter);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FIR_FILTER_H_ */
+
+/*==================[end of file]============================================*/
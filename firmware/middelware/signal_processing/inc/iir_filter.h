@@ -8,6 +8,16 @@
  */
 
 /** \brief Functionalities to design and use filters
+ * 
+ * Float filters (LowPassInit(), LowPassFilter(), ...) use the esp-dsp biquad
+ * functions and keep one low pass and one hi pass filter.
+ * 
+ * Fixed point filters (LowPassInitQ15(), IIRFilterQ15(), ...) are intended for
+ * the ESP32-C6, which has no FPU: floats are only used at init to design the
+ * filter. Each iir_q15_t is an independent filter, so one can be declared per
+ * channel. Samples are Q15 (int16_t), coefficients are quantized to Q29 and
+ * each section keeps its state in Q29 (2 bits of headroom over Q31) with 64 bit
+ * accumulation, so low cut-off frequencies (e.g. 0.5 Hz at 1 kHz) are stable.
  * 
  * @author Peñalva Albano
  *
@@ -16,12 +26,15 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 18/10/2026 | Fixed point (Q15) Butterworth cascades         						|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 /*==================[macros]=================================================*/
+#define IIR_MAX_SECTIONS    4       /*!< 2nd order sections of an 8th order filter */
 
 /*==================[typedef]================================================*/
 typedef enum filter_order {
@@ -30,6 +43,15 @@ typedef enum filter_order {
     ORDER_6 = 6,        /*!< 6th order filter */
     ORDER_8 = 8         /*!< 8th order filter */
 } filter_order_t;
+
+/**
+ * @brief Fixed point IIR filter (cascade of 2nd order sections, direct form I)
+ */
+typedef struct {
+    int32_t coeff[IIR_MAX_SECTIONS][5];     /*!< b0, b1, b2, a1, a2 of each section (Q29) */
+    int32_t state[IIR_MAX_SECTIONS][4];     /*!< x[n-1], x[n-2], y[n-1], y[n-2] of each section (Q29) */
+    uint8_t sections;                       /*!< Number of sections in use */
+} iir_q15_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -69,6 +91,55 @@ void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_l
  */
 void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght);
 
+/**
+ * @brief Initialize a fixed point Butterworth Low Pass Filter
+ * 
+ * @note Coefficients are quantized and checked: the filter is not initialized
+ * if a quantized section is unstable or its gain is lost (cut-off too low).
+ * 
+ * @param filter        Filter to initialize (its state is cleared)
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ * @return true         Filter initialized
+ * @return false        Invalid parameters or quantized filter not usable
+ */
+bool LowPassInitQ15(iir_q15_t * filter, float sample_frec, float cut_frec, filter_order_t order);
+
+/**
+ * @brief Initialize a fixed point Butterworth Hi Pass Filter
+ * 
+ * @note Coefficients are quantized and checked: the filter is not initialized
+ * if a quantized section is unstable.
+ * 
+ * @param filter        Filter to initialize (its state is cleared)
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ * @return true         Filter initialized
+ * @return false        Invalid parameters or quantized filter not usable
+ */
+bool HiPassInitQ15(iir_q15_t * filter, float sample_frec, float cut_frec, filter_order_t order);
+
+/**
+ * @brief Apply a fixed point filter to a signal array
+ * 
+ * @note Input and output can be the same array. Output is saturated to int16_t.
+ * 
+ * @param filter            Filter (initialized with LowPassInitQ15() or HiPassInitQ15())
+ * @param input_signal      Input signal array (Q15)
+ * @param output_signal     Filtered signal array (Q15)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IIRFilterQ15(iir_q15_t * filter, const int16_t * input_signal, int16_t * output_signal, uint16_t signal_lenght);
+
+/**
+ * @brief Clear the state of a fixed point filter (coefficients are kept)
+ * 
+ * @param filter        Filter to reset
+ */
+void IIRResetQ15(iir_q15_t * filter);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
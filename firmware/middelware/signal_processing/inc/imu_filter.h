@@ -0,0 +1,135 @@
+#ifndef IMU_FILTER_H_
+#define IMU_FILTER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup IMU_Filter IMU orientation filter
+ */
+
+/** \brief Fixed point orientation (attitude) estimation from an accelerometer
+ * and a gyroscope (MPU6050)
+ *
+ * Intended for the ESP32-C6, which has no FPU: floats are only used at init
+ * (the esp-dsp ekf_imu13states is too slow for it at hundreds of Hz).
+ * The orientation is a Q30 quaternion (sensor to earth frame) integrated with
+ * the gyroscope and corrected with the direction of gravity measured by the
+ * accelerometer:
+ * - IMU_FILTER_MAHONY: PI correction of the rotation rate (kp: 1/s, ki: 1/s²).
+ * - IMU_FILTER_MADGWICK: gradient descent step (kp: beta in rad/s, ki: zeta in rad/s²).
+ * - IMU_FILTER_COMPLEMENTARY: the estimate is rotated directly towards the
+ *   measured gravity, a fraction kp * dt per sample (kp: 1/s).
+ *
+ * Samples are the raw MPU6050 values (ax, ay, az, gx, gy, gz, as given by
+ * MPU6050_getMotion6() or MPU6050_getFIFOMotion6()), processed in blocks of
+ * any lenght. The gyroscope bias is averaged during the first samples (sensor
+ * at rest) and then tracked with the ki gain (0: fixed bias). Samples with an
+ * acceleration norm far from 1 g (linear acceleration) only use the gyroscope.
+ *
+ * Roll and pitch are absolute; yaw drifts slowly, since there is no magnetometer.
+ *
+ * @note The cycles of each ImuFilterUpdate() call can be measured on the board
+ * with trace_mcu (TRACE_IMU), sp_benchmark gives the time per sample on a PC.
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define IMU_SAMPLE_VALUES       6           /*!< ax, ay, az, gx, gy, gz */
+#define IMU_FILTER_Q30_ONE      (1 << 30)   /*!< 1.0 in Q30 */
+/*==================[typedef]================================================*/
+typedef enum imu_filter_type {
+    IMU_FILTER_MAHONY,
+    IMU_FILTER_MADGWICK,
+    IMU_FILTER_COMPLEMENTARY
+} imu_filter_type_t;
+
+/**
+ * @brief Filter configuration (only used by ImuFilterInit())
+ */
+typedef struct {
+    imu_filter_type_t type;
+    uint16_t sample_freq;       /*!< Sample rate (Hz) */
+    uint16_t gyro_range;        /*!< Gyroscope full scale (250, 500, 1000 or 2000 deg/s) */
+    uint8_t accel_range;        /*!< Accelerometer full scale (2, 4, 8 or 16 g) */
+    float kp;                   /*!< Accelerometer correction gain (see the filter types) */
+    float ki;                   /*!< Bias tracking gain (see the filter types), 0: fixed bias */
+    float accel_gate;           /*!< Max relative deviation of the acceleration norm from 1 g to use it (0: always) */
+    uint16_t bias_samples;      /*!< Samples averaged for the initial gyroscope bias (sensor at rest), 0: none */
+} imu_filter_config_t;
+
+/**
+ * @brief Fixed point orientation filter
+ */
+typedef struct {
+    int32_t q[4];               /*!< Orientation quaternion w, x, y, z (Q30) */
+    int32_t bias[3];            /*!< Gyroscope bias (raw LSB, Q16) */
+    int32_t gyro_scale;         /*!< Raw LSB to half rotation angle per sample (Q46) */
+    int32_t kp;                 /*!< Correction per sample (Q30) */
+    int32_t kb;                 /*!< Bias change per unit error (raw LSB, Q24) */
+    uint32_t accel_min2;        /*!< Squared acceleration norm range used for the correction (raw LSB²) */
+    uint32_t accel_max2;
+    int64_t sum[IMU_SAMPLE_VALUES];     /*!< Sums of the samples during the bias estimation */
+    uint16_t bias_samples;      /*!< Samples of the bias estimation */
+    uint16_t count;             /*!< Samples summed so far */
+    imu_filter_type_t type;
+    bool started;               /*!< false until the quaternion is initialized from the accelerometer */
+} imu_filter_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize an orientation filter
+ *
+ * @note Typical gains at 500 Hz: Mahony kp = 1, ki = 0.02; Madgwick kp = 0.05,
+ * ki = 0.005; complementary kp = 1, ki = 0.02.
+ *
+ * @param filter    Filter to initialize
+ * @param config    Filter configuration
+ * @return true     Filter initialized
+ * @return false    Invalid configuration
+ */
+bool ImuFilterInit(imu_filter_t * filter, const imu_filter_config_t * config);
+
+/**
+ * @brief Process a block of samples
+ *
+ * @param filter    Orientation filter
+ * @param samples   Raw samples, IMU_SAMPLE_VALUES per sample (ax, ay, az, gx, gy, gz)
+ * @param lenght    Number of samples
+ * @return true     Orientation available
+ * @return false    Still estimating the bias
+ */
+bool ImuFilterUpdate(imu_filter_t * filter, const int16_t * samples, uint16_t lenght);
+
+/**
+ * @brief Set the gyroscope bias (e.g. saved from a previous run) and skip the initial estimation
+ *
+ * @param filter    Orientation filter
+ * @param bias      Bias of each axis (raw LSB, Q16)
+ */
+void ImuFilterSetBias(imu_filter_t * filter, const int32_t * bias);
+
+/**
+ * @brief Orientation as roll, pitch and yaw angles (Z-Y-X)
+ *
+ * @param filter    Orientation filter
+ * @param angles    Array to store roll, pitch and yaw (millidegrees)
+ */
+void ImuFilterEuler(const imu_filter_t * filter, int32_t * angles);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* IMU_FILTER_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,222 @@
+#ifndef MULTIRATE_H_
+#define MULTIRATE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Multirate Multirate
+ */
+
+/** \brief Sample rate conversion stages (decimators, interpolators and CIC)
+ *
+ * - Decimators: anti-alias low pass (windowed-sinc) + downsampling by M, computed
+ * with esp-dsp dsps_fird_s16 / dsps_fird_f32, so only the kept outputs are calculated.
+ * - Interpolator: polyphase upsampling by L, each output uses only taps / L
+ * coefficients (the zeros inserted by the upsampler are never multiplied).
+ * - CIC decimator: multiplier-less integrator/comb cascade for large ratios
+ * (e.g. oversampled ADC data). Its passband droop and limited alias rejection are
+ * usually corrected by a short FIR decimator after it:
+ *
+ * @code
+ * CICInitQ15(&cic, 16, 3);                 // 16 kHz -> 1 kHz
+ * DecimatorInitQ15(&dec, 4, 48);           //  1 kHz -> 250 Hz, sharp anti-alias
+ * n = CICDecimateQ15(&cic, adc, buf, 512);
+ * n = DecimateQ15(&dec, buf, out, n);
+ * @endcode
+ *
+ * Anti-alias and anti-image filters have their cut-off (-6 dB) at
+ * MULTIRATE_CUT_RATIO of the lower Nyquist frequency. Each struct is an
+ * independent stage, so one can be declared per channel.
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "dsps_fir.h"
+#include "fir_filter.h"
+/*==================[macros]=================================================*/
+#define MULTIRATE_CUT_RATIO     0.8f    /*!< Filters cut-off, relative to the lower Nyquist frequency */
+#define CIC_MAX_STAGES          5       /*!< Max number of CIC integrator/comb pairs */
+/*==================[typedef]================================================*/
+/**
+ * @brief Fixed point FIR decimator
+ */
+typedef struct {
+    fir_s16_t fir;                      /*!< esp-dsp filter structure */
+    int16_t coeffs[FIR_MAX_TAPS];       /*!< Anti-alias filter coefficients (Q15) */
+    int16_t delay[FIR_MAX_TAPS];        /*!< Delay line */
+    uint8_t factor;                     /*!< Decimation factor */
+} decimator_q15_t;
+
+/**
+ * @brief Floating point FIR decimator
+ */
+typedef struct {
+    fir_f32_t fir;                      /*!< esp-dsp filter structure */
+    float coeffs[FIR_MAX_TAPS];         /*!< Anti-alias filter coefficients */
+    float delay[FIR_MAX_TAPS];          /*!< Delay line */
+    uint8_t factor;                     /*!< Decimation factor */
+} decimator_f32_t;
+
+/**
+ * @brief Fixed point polyphase interpolator
+ */
+typedef struct {
+    int16_t coeffs[FIR_MAX_TAPS];       /*!< Anti-image filter (Q14, gain = factor), ordered by phase */
+    int16_t delay[2 * FIR_MAX_TAPS];    /*!< Input history, stored twice so each window is contiguous */
+    uint16_t phase_taps;                /*!< Coefficients per phase */
+    uint16_t pos;                       /*!< Next write position in the history */
+    uint8_t factor;                     /*!< Interpolation factor */
+} interpolator_q15_t;
+
+/**
+ * @brief Fixed point CIC decimator (differential delay 1)
+ */
+typedef struct {
+    uint32_t integ[CIC_MAX_STAGES];     /*!< Integrators (wrap-around arithmetic) */
+    uint32_t comb[CIC_MAX_STAGES];      /*!< Previous input of each comb */
+    int32_t norm;                       /*!< Gain correction, Q31 / ratio^stages */
+    uint16_t ratio;                     /*!< Decimation factor */
+    uint16_t count;                     /*!< Input samples since the last output */
+    uint8_t stages;                     /*!< Number of integrator/comb pairs */
+} cic_q15_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Design and initialize a fixed point decimator
+ *
+ * @param dec       Decimator to initialize
+ * @param factor    Decimation factor (2 or more)
+ * @param taps      Anti-alias filter length (2 to FIR_MAX_TAPS, around 8 * factor or more recommended)
+ * @return true     Decimator initialized
+ * @return false    Invalid parameters
+ */
+bool DecimatorInitQ15(decimator_q15_t * dec, uint8_t factor, uint16_t taps);
+
+/**
+ * @brief Filter and downsample a signal array
+ *
+ * @note Input and output can be the same array.
+ *
+ * @param dec           Decimator (initialized with DecimatorInitQ15())
+ * @param input_signal  Input signal array (Q15)
+ * @param output_signal Output signal array (Q15, of lenght input_lenght / factor)
+ * @param input_lenght  Number of input samples (multiple of the decimation factor)
+ * @return uint16_t     Number of output samples (0 if input_lenght is not a multiple of the factor)
+ */
+uint16_t DecimateQ15(decimator_q15_t * dec, const int16_t * input_signal, int16_t * output_signal, uint16_t input_lenght);
+
+/**
+ * @brief Free the resources allocated by esp-dsp at init
+ *
+ * @note Must be called before initializing the same decimator again.
+ *
+ * @param dec   Decimator to de-initialize
+ */
+void DecimatorDeinitQ15(decimator_q15_t * dec);
+
+/**
+ * @brief Design and initialize a floating point decimator
+ *
+ * @param dec       Decimator to initialize
+ * @param factor    Decimation factor (2 or more)
+ * @param taps      Anti-alias filter length (2 to FIR_MAX_TAPS)
+ * @return true     Decimator initialized
+ * @return false    Invalid parameters
+ */
+bool DecimatorInitF32(decimator_f32_t * dec, uint8_t factor, uint16_t taps);
+
+/**
+ * @brief Filter and downsample a signal array
+ *
+ * @note Input and output can be the same array.
+ *
+ * @param dec           Decimator (initialized with DecimatorInitF32())
+ * @param input_signal  Input signal array
+ * @param output_signal Output signal array (of lenght input_lenght / factor)
+ * @param input_lenght  Number of input samples (multiple of the decimation factor)
+ * @return uint16_t     Number of output samples (0 if input_lenght is not a multiple of the factor)
+ */
+uint16_t DecimateF32(decimator_f32_t * dec, const float * input_signal, float * output_signal, uint16_t input_lenght);
+
+/**
+ * @brief Design and initialize a fixed point polyphase interpolator
+ *
+ * @param interp    Interpolator to initialize
+ * @param factor    Interpolation factor (2 or more)
+ * @param taps      Anti-image filter length, rounded up to a multiple of factor (factor to FIR_MAX_TAPS)
+ * @return true     Interpolator initialized
+ * @return false    Invalid parameters
+ */
+bool InterpolatorInitQ15(interpolator_q15_t * interp, uint8_t factor, uint16_t taps);
+
+/**
+ * @brief Upsample and filter a signal array
+ *
+ * @note Input and output must be different arrays.
+ *
+ * @param interp        Interpolator (initialized with InterpolatorInitQ15())
+ * @param input_signal  Input signal array (Q15)
+ * @param output_signal Output signal array (Q15, of lenght input_lenght * factor)
+ * @param input_lenght  Number of input samples
+ * @return uint16_t     Number of output samples
+ */
+uint16_t InterpolateQ15(interpolator_q15_t * interp, const int16_t * input_signal, int16_t * output_signal, uint16_t input_lenght);
+
+/**
+ * @brief Clear the history of an interpolator (coefficients are kept)
+ *
+ * @param interp    Interpolator to reset
+ */
+void InterpolatorResetQ15(interpolator_q15_t * interp);
+
+/**
+ * @brief Initialize a CIC decimator
+ *
+ * @note The output is normalized to unity DC gain.
+ *
+ * @param cic       CIC decimator to initialize
+ * @param ratio     Decimation factor (2 or more)
+ * @param stages    Number of integrator/comb pairs (1 to CIC_MAX_STAGES), ratio^stages must not exceed 65536
+ * @return true     CIC initialized
+ * @return false    Invalid parameters
+ */
+bool CICInitQ15(cic_q15_t * cic, uint16_t ratio, uint8_t stages);
+
+/**
+ * @brief Integrate and decimate a signal array
+ *
+ * @note Any input lenght is accepted, the decimation phase is kept between calls.
+ * Input and output can be the same array.
+ *
+ * @param cic           CIC decimator (initialized with CICInitQ15())
+ * @param input_signal  Input signal array (Q15)
+ * @param output_signal Output signal array (Q15)
+ * @param input_lenght  Number of input samples
+ * @return uint16_t     Number of output samples
+ */
+uint16_t CICDecimateQ15(cic_q15_t * cic, const int16_t * input_signal, int16_t * output_signal, uint16_t input_lenght);
+
+/**
+ * @brief Clear the integrators and combs of a CIC decimator
+ *
+ * @param cic   CIC decimator to reset
+ */
+void CICResetQ15(cic_q15_t * cic);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MULTIRATE_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,295 @@
+#ifndef ONLINE_STATS_H_
+#define ONLINE_STATS_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Online_Stats Online statistics
+ */
+
+/** \brief Streaming statistics and features for sensor readings
+ *
+ * Every estimator is updated with blocks of samples of any lenght (a single
+ * reading is a block of 1) at O(1) cost per sample, without keeping the
+ * signal history (except the sliding windows, bounded by ONLINE_STATS_MAX_WINDOW):
+ * - Running statistics: count, mean, variance (Welford / Chan block merge), min and max.
+ * - Exponential moving average (EMA).
+ * - Min / max over a sliding window (monotonic deques).
+ * - RMS over a sliding window, or of a block.
+ * - Zero (or level) crossings, with hysteresis.
+ * - Percentiles with the P² estimator (5 markers, no sample storage).
+ *
+ * Thresholds on these values (instead of raw single readings) make decisions
+ * robust to noise and outliers.
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define ONLINE_STATS_MAX_WINDOW     256     /*!< Max sliding window lenght */
+#define P2_MARKERS                  5       /*!< Markers of the P² estimator */
+/*==================[typedef]================================================*/
+/**
+ * @brief Running statistics of all the samples since the last reset
+ */
+typedef struct {
+    uint32_t count;         /*!< Number of samples */
+    float mean;
+    float m2;               /*!< Sum of squared deviations from the mean */
+    float min;
+    float max;
+} running_stats_t;
+
+/**
+ * @brief Exponential moving average: y = y + alpha * (x - y)
+ */
+typedef struct {
+    float alpha;            /*!< Smoothing factor (0 to 1] */
+    float value;            /*!< Last output */
+    bool started;           /*!< false until the first sample (used as initial value) */
+} ema_f32_t;
+
+/**
+ * @brief Monotonic deque of (value, sample index), used for sliding min / max
+ */
+typedef struct {
+    float value[ONLINE_STATS_MAX_WINDOW];
+    uint32_t index[ONLINE_STATS_MAX_WINDOW];
+    uint16_t head;          /*!< Position of the oldest element */
+    uint16_t count;         /*!< Number of elements */
+} stats_deque_t;
+
+/**
+ * @brief Min and max of the last window samples
+ */
+typedef struct {
+    stats_deque_t min;      /*!< Increasing values: front is the minimum */
+    stats_deque_t max;      /*!< Decreasing values: front is the maximum */
+    uint32_t samples;       /*!< Samples processed */
+    uint16_t window;        /*!< Window lenght */
+} minmax_f32_t;
+
+/**
+ * @brief RMS of the last window samples
+ */
+typedef struct {
+    float squares[ONLINE_STATS_MAX_WINDOW];     /*!< Last window squared samples (circular) */
+    float sum;              /*!< Sum of the window */
+    float fresh;            /*!< Sum of the samples since the last wrap */
+    uint16_t window;        /*!< Window lenght */
+    uint16_t pos;           /*!< Next write position */
+    uint16_t fill;          /*!< Samples in the window (up to window) */
+} rms_f32_t;
+
+/**
+ * @brief Level crossing counter with hysteresis
+ */
+typedef struct {
+    float level;            /*!< Crossing level (0: zero crossings) */
+    float hysteresis;       /*!< The signal must move this much past level to change side */
+    int8_t side;            /*!< 1 above, -1 below, 0 not known yet */
+} zcr_f32_t;
+
+/**
+ * @brief P² (Jain & Chlamtac) percentile estimator
+ */
+typedef struct {
+    float q[P2_MARKERS];        /*!< Marker heights (q[2] is the estimate) */
+    int32_t n[P2_MARKERS];      /*!< Marker positions */
+    float np[P2_MARKERS];       /*!< Desired positions */
+    float dn[P2_MARKERS];       /*!< Desired positions increments */
+    float p;                    /*!< Percentile (0 to 1) */
+    uint32_t count;             /*!< Samples processed */
+} p2_f32_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Reset running statistics
+ *
+ * @param stats     Statistics to reset
+ */
+void RunningStatsInit(running_stats_t * stats);
+
+/**
+ * @brief Add a block of samples
+ *
+ * @param stats     Running statistics
+ * @param samples   Array of new samples
+ * @param lenght    Number of samples
+ */
+void RunningStatsUpdateF32(running_stats_t * stats, const float * samples, uint16_t lenght);
+
+/**
+ * @brief Combine the statistics of another set of samples (e.g. from another task)
+ *
+ * @param stats     Running statistics (updated)
+ * @param other     Statistics to add
+ */
+void RunningStatsMerge(running_stats_t * stats, const running_stats_t * other);
+
+/**
+ * @brief Sample variance (0 with less than 2 samples)
+ *
+ * @param stats     Running statistics
+ * @return float    Variance
+ */
+float RunningStatsVariance(const running_stats_t * stats);
+
+/**
+ * @brief Sample standard deviation
+ *
+ * @param stats     Running statistics
+ * @return float    Standard deviation
+ */
+float RunningStatsStd(const running_stats_t * stats);
+
+/**
+ * @brief Initialize an exponential moving average
+ *
+ * @note For a time constant tau (s) at sample_freq: alpha = 1 - exp(-1 / (tau * sample_freq)).
+ *
+ * @param ema       EMA to initialize
+ * @param alpha     Smoothing factor (0 to 1], smaller is smoother
+ * @return true     EMA initialized
+ * @return false    Invalid alpha
+ */
+bool EMAInitF32(ema_f32_t * ema, float alpha);
+
+/**
+ * @brief Filter a block of samples
+ *
+ * @param ema       EMA
+ * @param input     Array of new samples
+ * @param output    Array to store the averages (of lenght = lenght), can be the
+ *                  input array or NULL (only the last value is kept)
+ * @param lenght    Number of samples
+ * @return float    Last average
+ */
+float EMAProcessF32(ema_f32_t * ema, const float * input, float * output, uint16_t lenght);
+
+/**
+ * @brief Initialize a sliding window min / max
+ *
+ * @param mm        Min / max to initialize
+ * @param window    Window lenght (1 to ONLINE_STATS_MAX_WINDOW)
+ * @return true     Initialized
+ * @return false    Invalid window
+ */
+bool MinMaxInitF32(minmax_f32_t * mm, uint16_t window);
+
+/**
+ * @brief Process a block of samples
+ *
+ * @param mm        Sliding min / max
+ * @param input     Array of new samples
+ * @param min       Array to store the min of the window ending at each sample (NULL: not needed)
+ * @param max       Array to store the max of the window ending at each sample (NULL: not needed)
+ * @param lenght    Number of samples
+ */
+void MinMaxProcessF32(minmax_f32_t * mm, const float * input, float * min, float * max, uint16_t lenght);
+
+/**
+ * @brief Min and max of the last window samples (of the samples so far while
+ * the window is not full)
+ *
+ * @param mm        Sliding min / max
+ * @param min       Minimum
+ * @param max       Maximum
+ * @return true     Values returned
+ * @return false    No samples processed yet
+ */
+bool MinMaxGetF32(const minmax_f32_t * mm, float * min, float * max);
+
+/**
+ * @brief Initialize a sliding window RMS
+ *
+ * @param rms       RMS to initialize
+ * @param window    Window lenght (1 to ONLINE_STATS_MAX_WINDOW)
+ * @return true     Initialized
+ * @return false    Invalid window
+ */
+bool RMSInitF32(rms_f32_t * rms, uint16_t window);
+
+/**
+ * @brief Process a block of samples
+ *
+ * @param rms       Sliding RMS
+ * @param input     Array of new samples
+ * @param lenght    Number of samples
+ * @return float    RMS of the last window samples
+ */
+float RMSProcessF32(rms_f32_t * rms, const float * input, uint16_t lenght);
+
+/**
+ * @brief RMS of a block of samples
+ *
+ * @param input     Array of samples
+ * @param lenght    Number of samples
+ * @return float    RMS
+ */
+float BlockRMSF32(const float * input, uint16_t lenght);
+
+/**
+ * @brief Initialize a level crossing counter
+ *
+ * @param zcr           Counter to initialize
+ * @param level         Crossing level
+ * @param hysteresis    Dead band around level (>= 0)
+ */
+void ZCRInitF32(zcr_f32_t * zcr, float level, float hysteresis);
+
+/**
+ * @brief Count the crossings in a block of samples (the rate is crossings / lenght
+ * per sample, or crossings * sample_freq / lenght per second)
+ *
+ * @param zcr       Level crossing counter
+ * @param input     Array of new samples
+ * @param lenght    Number of samples
+ * @return uint16_t Number of crossings (both directions)
+ */
+uint16_t ZCRProcessF32(zcr_f32_t * zcr, const float * input, uint16_t lenght);
+
+/**
+ * @brief Initialize a P² percentile estimator
+ *
+ * @param p2        Estimator to initialize
+ * @param p         Percentile (0 to 1, e.g. 0.5 for the median)
+ * @return true     Initialized
+ * @return false    Invalid percentile
+ */
+bool P2InitF32(p2_f32_t * p2, float p);
+
+/**
+ * @brief Process a block of samples
+ *
+ * @param p2        P² estimator
+ * @param input     Array of new samples
+ * @param lenght    Number of samples
+ */
+void P2ProcessF32(p2_f32_t * p2, const float * input, uint16_t lenght);
+
+/**
+ * @brief Current percentile estimate (exact while less than 5 samples were processed)
+ *
+ * @param p2        P² estimator
+ * @return float    Estimate (0 if no samples)
+ */
+float P2GetF32(const p2_f32_t * p2);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ONLINE_STATS_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,146 @@
+#ifndef QRS_DETECTOR_H_
+#define QRS_DETECTOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup QRS_Detector QRS detector
+ */
+
+/** \brief Real time ECG QRS detection and heart rate (Pan-Tompkins)
+ *
+ * Samples are processed in blocks of any lenght, with integer arithmetic only:
+ * - Band pass 5 to 15 Hz (Q15 Butterworth cascades, see IIR filter module).
+ * - 5 point derivative, squaring and 150 ms moving window integration.
+ * - Peaks of the integrated signal are classified as QRS or noise with adaptive
+ * thresholds (signal and noise levels), a 200 ms refractory period, T wave
+ * discrimination (slope) up to 360 ms and search back for missed beats
+ * (no beat in 166 % of the mean RR interval).
+ *
+ * The first 2 seconds are used to learn the initial thresholds (no beats are
+ * reported). The R peak is located as the largest band passed sample (absolute
+ * value) inside the integration window, corrected by the band pass group delay.
+ * Beats are reported at most 2 integration windows after the R peak (plus the
+ * filter delay), except the ones found by search back.
+ *
+ * Input samples are Q15: e.g. (mV - offset) * 16 for a 12 bit ADC reading in mV.
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "iir_filter.h"
+/*==================[macros]=================================================*/
+#define QRS_MIN_SAMPLE_FREQ     50      /*!< Min sample frequency (Hz) */
+#define QRS_MAX_SAMPLE_FREQ     1000    /*!< Max sample frequency (Hz) */
+#define QRS_MAX_WINDOW          150     /*!< Max integration window (150 ms at QRS_MAX_SAMPLE_FREQ) */
+#define QRS_HISTORY             (2 * QRS_MAX_WINDOW + 8)    /*!< Band passed samples kept to locate R peaks */
+#define QRS_RR_AVERAGE          8       /*!< RR intervals averaged for the heart rate */
+/*==================[typedef]================================================*/
+/**
+ * @brief Detected beat
+ */
+typedef struct {
+    uint32_t sample;        /*!< R peak sample number (since init or reset) */
+    uint32_t time_ms;       /*!< R peak time (ms since init or reset) */
+    uint16_t rr_ms;         /*!< Interval from the previous beat (0 for the first one) */
+    uint16_t bpm;           /*!< Heart rate, mean of the last QRS_RR_AVERAGE intervals (0 until 2 beats) */
+    bool search_back;       /*!< Found by search back (below the main threshold) */
+} qrs_beat_t;
+
+/**
+ * @brief QRS detector instance
+ */
+typedef struct {
+    iir_q15_t hi_pass;                      /*!< Band pass filter */
+    iir_q15_t low_pass;
+    int16_t history[QRS_HISTORY];           /*!< Last band passed samples (circular) */
+    int32_t squares[QRS_MAX_WINDOW];        /*!< Squared derivatives in the integration window (circular) */
+    int32_t mwi_sum;                        /*!< Sum of squares */
+    uint32_t n;                             /*!< Samples processed */
+    uint16_t sample_freq;                   /*!< Sample frequency (Hz) */
+    uint16_t window;                        /*!< Integration window (samples) */
+    uint16_t refractory;                    /*!< 200 ms (samples) */
+    uint16_t t_wave;                        /*!< 360 ms (samples) */
+    uint32_t learn;                         /*!< Learning period (samples) */
+    uint16_t delay;                         /*!< Band pass group delay (samples) */
+    int32_t learn_max;                      /*!< Learning: max and sum of the integrated signal */
+    int64_t learn_sum;
+    int32_t peak;                           /*!< Peak search in the integrated signal */
+    uint32_t peak_n;
+    int32_t peak_slope;
+    int32_t slope;                          /*!< Max |derivative| since the signal started rising */
+    int32_t valley;
+    bool falling;
+    int32_t spki;                           /*!< Signal and noise peak levels */
+    int32_t npki;
+    int32_t threshold1;                     /*!< Main threshold */
+    int32_t threshold2;                     /*!< Search back threshold */
+    bool have_qrs;                          /*!< At least one QRS detected */
+    uint32_t qrs_n;                         /*!< Integrated peak of the last QRS */
+    int32_t qrs_slope;                      /*!< Max slope of the last QRS */
+    uint32_t r_n;                           /*!< R peak of the last QRS */
+    int32_t sb_peak;                        /*!< Search back candidate (0: none) */
+    uint32_t sb_n;
+    uint32_t sb_r;
+    int32_t sb_slope;
+    uint32_t rr[QRS_RR_AVERAGE];            /*!< Last RR intervals (samples, circular) */
+    uint32_t rr_sum;
+    uint8_t rr_count;
+    uint8_t rr_pos;
+} qrs_detector_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a QRS detector
+ *
+ * @param qrs           Detector to initialize
+ * @param sample_freq   Sample frequency (QRS_MIN_SAMPLE_FREQ to QRS_MAX_SAMPLE_FREQ Hz)
+ * @return true         Detector initialized
+ * @return false        Invalid sample frequency
+ */
+bool QRSInit(qrs_detector_t * qrs, uint16_t sample_freq);
+
+/**
+ * @brief Process a block of samples
+ *
+ * @param qrs       QRS detector
+ * @param samples   Array of new ECG samples (Q15)
+ * @param lenght    Number of samples
+ * @param beats     Array to store the beats detected in this block
+ * @param max_beats Lenght of beats array (further beats are counted for the heart rate, not stored)
+ * @return uint8_t  Number of beats stored
+ */
+uint8_t QRSProcess(qrs_detector_t * qrs, const int16_t * samples, uint16_t lenght, qrs_beat_t * beats, uint8_t max_beats);
+
+/**
+ * @brief Heart rate from the last QRS_RR_AVERAGE intervals
+ *
+ * @param qrs       QRS detector
+ * @return uint16_t Beats per minute (0 until 2 beats)
+ */
+uint16_t QRSGetHeartRate(const qrs_detector_t * qrs);
+
+/**
+ * @brief Restart detection (thresholds are learned again, sample count restarts)
+ *
+ * @param qrs       QRS detector
+ */
+void QRSReset(qrs_detector_t * qrs);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* QRS_DETECTOR_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,189 @@
+#ifndef STFT_H_
+#define STFT_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup STFT Short-Time Fourier Transform
+ */
+
+/** \brief Streaming spectral analysis (overlapped FFT)
+ *
+ * Samples are pushed in blocks of any lenght and stored in a ring buffer holding
+ * the last frame. Every hop (frame lenght, 1/2 or 1/4 of it, depending on the
+ * overlap) the frame is windowed (Hann) straight from the ring buffer into the
+ * FFT buffer, and the following results are updated:
+ * - Magnitude spectrum (amplitude corrected: a sine of amplitude A centered
+ * in a bin gives a peak of A).
+ * - Peak frequency (parabolic interpolation between bins) and magnitude.
+ * - Spectral centroid.
+ * - Power in up to STFT_MAX_BANDS user defined bands (corrected by the
+ * Hann equivalent noise bandwidth, so a sine of amplitude A gives A^2/2).
+ * - Welch average: mean power of a given number of consecutive frames.
+ *
+ * Results can be read with the getters or received in a callback per hop.
+ *
+ * @note The FFT work buffer is shared by all instances: STFTPush() must be called
+ * from a single task.
+ *
+ * @author Jean Pierre Arotcharen
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 18/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define STFT_MAX_LENGHT     1024    /*!< Max frame lenght (FFT size) */
+#define STFT_MAX_BANDS      4       /*!< Max number of band power features */
+/*==================[typedef]================================================*/
+/**
+ * @brief Overlap between consecutive frames
+ */
+typedef enum {
+    STFT_OVERLAP_0,         /*!< hop = lenght */
+    STFT_OVERLAP_50,        /*!< hop = lenght / 2 */
+    STFT_OVERLAP_75         /*!< hop = lenght / 4 */
+} stft_overlap_t;
+
+/**
+ * @brief Frequency band (for band power features)
+ */
+typedef struct {
+    float f_low;            /*!< Lower limit (Hz, included) */
+    float f_high;           /*!< Upper limit (Hz, included) */
+} stft_band_t;
+
+/**
+ * @brief Features computed from each frame
+ */
+typedef struct {
+    float peak_freq;                    /*!< Frequency of the highest bin, DC excluded (Hz) */
+    float peak_mag;                     /*!< Magnitude of the highest bin */
+    float centroid;                     /*!< Spectral centroid, DC excluded (Hz) */
+    float band_power[STFT_MAX_BANDS];   /*!< Power in each configured band */
+} stft_features_t;
+
+/**
+ * @brief Results of one frame
+ */
+typedef struct {
+    const float * spectrum;     /*!< Magnitude spectrum (bins values) */
+    const float * average;      /*!< Welch average magnitude, NULL if not completed with this frame */
+    uint16_t bins;              /*!< Number of bins (lenght / 2) */
+    uint32_t frame;             /*!< Frame counter */
+    stft_features_t features;   /*!< Frame features */
+} stft_result_t;
+
+/**
+ * @brief Prototype of callback function called after every frame
+ *
+ * @param result    pointer to the frame results (valid only during the call)
+ * @param param     pointer to callback function parameter
+ */
+typedef void (*stft_func)(const stft_result_t * result, void * param);
+
+/**
+ * @brief STFT configuration struct
+ */
+typedef struct {
+    float sample_freq;                  /*!< Signal's sample frequency */
+    uint16_t lenght;                    /*!< Frame lenght (power of two, 8 to STFT_MAX_LENGHT) */
+    stft_overlap_t overlap;             /*!< Overlap between frames */
+    uint16_t averages;                  /*!< Frames per Welch average (0: disabled) */
+    stft_band_t bands[STFT_MAX_BANDS];  /*!< Bands for the band power features */
+    uint8_t n_bands;                    /*!< Number of bands used */
+    stft_func func_p;                   /*!< Pointer to callback function (NULL if not required) */
+    void * param_p;                     /*!< Pointer to callback function parameter */
+} stft_config_t;
+
+/**
+ * @brief STFT instance
+ */
+typedef struct {
+    stft_config_t cfg;                      /*!< Configuration */
+    float ring[STFT_MAX_LENGHT];            /*!< Last lenght samples (circular) */
+    float window[STFT_MAX_LENGHT];          /*!< Hann window, scaled for amplitude correct magnitudes */
+    float spectrum[STFT_MAX_LENGHT / 2];    /*!< Magnitude of the last frame */
+    float power_acc[STFT_MAX_LENGHT / 2];   /*!< Welch accumulator (squared magnitudes) */
+    float average[STFT_MAX_LENGHT / 2];     /*!< Last completed Welch average */
+    stft_features_t features;               /*!< Features of the last frame */
+    uint16_t hop;                           /*!< Samples between frames */
+    uint16_t pos;                           /*!< Next write position in the ring buffer */
+    uint16_t pending;                       /*!< Samples needed to compute the next frame */
+    uint16_t acc_count;                     /*!< Frames in the Welch accumulator */
+    uint32_t frames;                        /*!< Frames computed since init/reset */
+    bool average_ready;                     /*!< At least one Welch average completed */
+} stft_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a STFT instance
+ *
+ * @note Calls FFTInit(), which registers the esp-dsp FFT tables if needed.
+ *
+ * @param stft      Instance to initialize
+ * @param config    Pointer to configuration (copied)
+ * @return true     STFT initialized
+ * @return false    Invalid parameters (bands out of 0 <= f_low <= f_high <= fs / 2
+ *                  included) or not possible to initialize FFT
+ */
+bool STFTInit(stft_t * stft, const stft_config_t * config);
+
+/**
+ * @brief Push new samples. A frame is computed every hop samples (after the first
+ * lenght samples), calling the callback function if configured.
+ *
+ * @param stft      STFT instance
+ * @param samples   Array of new samples
+ * @param lenght    Number of samples
+ * @return uint16_t Number of frames computed
+ */
+uint16_t STFTPush(stft_t * stft, const float * samples, uint16_t lenght);
+
+/**
+ * @brief Copy the magnitude spectrum of the last frame
+ *
+ * @param stft      STFT instance
+ * @param spectrum  Array to store magnitude values (of lenght = config lenght / 2)
+ */
+void STFTGetSpectrum(const stft_t * stft, float * spectrum);
+
+/**
+ * @brief Copy the last completed Welch average
+ *
+ * @param stft      STFT instance
+ * @param average   Array to store magnitude values (of lenght = config lenght / 2)
+ * @return true     Average copied
+ * @return false    Averaging disabled or no average completed yet
+ */
+bool STFTGetAverage(const stft_t * stft, float * average);
+
+/**
+ * @brief Copy the features of the last frame
+ *
+ * @param stft      STFT instance
+ * @param features  Pointer to where the features will be copied
+ */
+void STFTGetFeatures(const stft_t * stft, stft_features_t * features);
+
+/**
+ * @brief Discard buffered samples, results and Welch accumulation (configuration is kept)
+ *
+ * @param stft      STFT instance
+ */
+void STFTReset(stft_t * stft);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* STFT_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,282 @@
+/**
+ * @file convolution.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <stdlib.h>
+#include "convolution.h"
+#include "fft.h"
+#include "esp_dsp.h"
+#include "esp_log.h"
+/*==================[macros and definitions]=================================*/
+#define TAG "Convolution"
+#define MIN_KERNEL      2
+#define BENCH_MIN_KERNEL    8
+/*==================[internal data declaration]==============================*/
+static float conv_work[2 * CONV_MAX_FFT];       /*!< FFT buffer (interleaved complex) */
+static float conv_kernel[2 * CONV_MAX_FFT];     /*!< Kernel spectrum of the current operation */
+static uint16_t conv_crossover = CONV_DEFAULT_CROSSOVER;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint16_t conv_next_pow2(uint32_t n){
+    uint32_t p = 1;
+    while(p < n){
+        p <<= 1;
+    }
+    return (p > CONV_MAX_FFT) ? CONV_MAX_FFT : p;
+}
+
+/**
+ * @brief FFT size for a kernel: about 4 times the kernel (good block/overhead
+ * balance), but no longer than needed to do the whole signal at once.
+ */
+static uint16_t conv_fft_lenght(uint16_t signal_lenght, uint16_t kernel_lenght){
+    uint16_t l = conv_next_pow2(4 * (uint32_t)kernel_lenght);
+    uint16_t l_full = conv_next_pow2((uint32_t)signal_lenght + kernel_lenght - 1);
+    if(l_full < l){
+        l = l_full;
+    }
+    if(l > dsps_fft_w_table_size){
+        l = dsps_fft_w_table_size;
+    }
+    return l;
+}
+
+static bool conv_use_fft(uint16_t kernel_lenght){
+    return dsps_fft2r_initialized && (conv_crossover > 0) && (kernel_lenght >= conv_crossover) &&
+        (2 * (uint32_t)kernel_lenght <= CONV_MAX_FFT) && (2 * (uint32_t)kernel_lenght <= dsps_fft_w_table_size);
+}
+
+static void conv_fft(float * data, uint16_t n){
+    dsps_fft2r_fc32(data, n);
+    dsps_bit_rev_fc32(data, n);
+}
+
+/**
+ * @brief Spectrum of a zero padded real kernel (optionally time reversed)
+ */
+static void conv_spectrum(float * dst, const float * kernel, uint16_t kernel_lenght, uint16_t n, bool reversed){
+    memset(dst, 0, 2 * n * sizeof(float));
+    for(uint16_t i = 0; i < kernel_lenght; i++){
+        dst[2 * i] = reversed ? kernel[kernel_lenght - 1 - i] : kernel[i];
+    }
+    conv_fft(dst, n);
+}
+
+/**
+ * @brief Multiply conv_work by a spectrum and transform back. The inverse
+ * FFT is done as conj(FFT(conj(X))), so the conjugate is stored with the
+ * product: afterwards re / n and -im / n are the two filtered frames.
+ */
+static void conv_filter_work(const float * spectrum, uint16_t n){
+    float re, im;
+    for(uint16_t k = 0; k < n; k++){
+        re = conv_work[2 * k] * spectrum[2 * k] - conv_work[2 * k + 1] * spectrum[2 * k + 1];
+        im = conv_work[2 * k] * spectrum[2 * k + 1] + conv_work[2 * k + 1] * spectrum[2 * k];
+        conv_work[2 * k] = re;
+        conv_work[2 * k + 1] = -im;
+    }
+    conv_fft(conv_work, n);
+}
+
+/**
+ * @brief Overlap-add with the kernel spectrum in conv_kernel. Two blocks per FFT
+ * (real and imaginary parts). Full convolution index c is written to output[c - skip]
+ * when inside the output array.
+ */
+static void conv_overlap_add(const float * signal, uint16_t signal_lenght, uint16_t kernel_lenght, uint16_t n,
+                             float * output, int32_t skip, int32_t output_lenght){
+    uint16_t block = n - kernel_lenght + 1;
+    float scale = 1.0f / n;
+    int32_t c;
+    uint16_t i;
+
+    memset(output, 0, output_lenght * sizeof(float));
+    for(uint32_t s = 0; s < signal_lenght; s += 2 * block){
+        memset(conv_work, 0, 2 * n * sizeof(float));
+        for(i = 0; (i < block) && (s + i < signal_lenght); i++){
+            conv_work[2 * i] = signal[s + i];
+        }
+        for(i = 0; (i < block) && (s + block + i < signal_lenght); i++){
+            conv_work[2 * i + 1] = signal[s + block + i];
+        }
+        conv_fft(conv_work, n);
+        conv_filter_work(conv_kernel, n);
+        for(i = 0; i < n; i++){
+            c = s + i - skip;
+            if((c >= 0) && (c < output_lenght)){
+                output[c] += conv_work[2 * i] * scale;
+            }
+            c += block;
+            if((c >= 0) && (c < output_lenght)){
+                output[c] -= conv_work[2 * i + 1] * scale;
+            }
+        }
+    }
+}
+
+static void conv_fft_convolve(const float * signal, uint16_t signal_lenght, const float * kernel, uint16_t kernel_lenght, float * output){
+    uint16_t n = conv_fft_lenght(signal_lenght, kernel_lenght);
+    conv_spectrum(conv_kernel, kernel, kernel_lenght, n, false);
+    conv_overlap_add(signal, signal_lenght, kernel_lenght, n, output, 0, (int32_t)signal_lenght + kernel_lenght - 1);
+}
+
+/*==================[external functions definition]==========================*/
+bool ConvInit(void){
+    return FFTInit();
+}
+
+bool ConvolveF32(const float * signal, uint16_t signal_lenght, const float * kernel, uint16_t kernel_lenght, float * output){
+    const float * tmp;
+    uint16_t tmp_lenght;
+    if((signal == NULL) || (kernel == NULL) || (output == NULL) || (signal_lenght == 0) || (kernel_lenght == 0)){
+        return false;
+    }
+    /* Convolution is commutative: the shorter array is the kernel */
+    if(kernel_lenght > signal_lenght){
+        tmp = signal;
+        signal = kernel;
+        kernel = tmp;
+        tmp_lenght = signal_lenght;
+        signal_lenght = kernel_lenght;
+        kernel_lenght = tmp_lenght;
+    }
+    if(!conv_use_fft(kernel_lenght)){
+        return dsps_conv_f32(signal, signal_lenght, kernel, kernel_lenght, output) == ESP_OK;
+    }
+    conv_fft_convolve(signal, signal_lenght, kernel, kernel_lenght, output);
+    return true;
+}
+
+bool CorrelateF32(const float * signal, uint16_t signal_lenght, const float * pattern, uint16_t pattern_lenght, float * output){
+    uint16_t n;
+    if((signal == NULL) || (pattern == NULL) || (output == NULL) || (pattern_lenght == 0) || (pattern_lenght > signal_lenght)){
+        return false;
+    }
+    if(!conv_use_fft(pattern_lenght)){
+        return dsps_corr_f32(signal, signal_lenght, pattern, pattern_lenght, output) == ESP_OK;
+    }
+    /* Correlation = convolution with the reversed pattern, only the fully overlapped part */
+    n = conv_fft_lenght(signal_lenght, pattern_lenght);
+    conv_spectrum(conv_kernel, pattern, pattern_lenght, n, true);
+    conv_overlap_add(signal, signal_lenght, pattern_lenght, n, output, pattern_lenght - 1, signal_lenght - pattern_lenght + 1);
+    return true;
+}
+
+void ConvSetCrossover(uint16_t kernel_lenght){
+    conv_crossover = kernel_lenght;
+}
+
+uint16_t ConvBenchmark(uint16_t signal_lenght){
+    uint16_t max_kernel = CONV_MAX_FFT / 2;
+    uint16_t crossover = 0;
+    uint32_t start, direct, fft;
+    if(max_kernel > signal_lenght){
+        max_kernel = signal_lenght;
+    }
+    if(!dsps_fft2r_initialized && !ConvInit()){
+        return 0;
+    }
+    float * signal = malloc(signal_lenght * sizeof(float));
+    float * kernel = malloc(max_kernel * sizeof(float));
+    float * output = malloc((signal_lenght + max_kernel - 1) * sizeof(float));
+    if((signal == NULL) || (kernel == NULL) || (output == NULL)){
+        free(signal);
+        free(kernel);
+        free(output);
+        return 0;
+    }
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        signal[i] = (float)(i % 17) - 8;
+    }
+    for(uint16_t i = 0; i < max_kernel; i++){
+        kernel[i] = 1.0f / (i + 1);
+    }
+
+    ESP_LOGI(TAG, "Signal lenght %u (CPU cycles)", signal_lenght);
+    for(uint16_t m = BENCH_MIN_KERNEL; m <= max_kernel; m <<= 1){
+        start = dsp_get_cpu_cycle_count();
+        dsps_conv_f32(signal, signal_lenght, kernel, m, output);
+        direct = dsp_get_cpu_cycle_count() - start;
+        start = dsp_get_cpu_cycle_count();
+        conv_fft_convolve(signal, signal_lenght, kernel, m, output);
+        fft = dsp_get_cpu_cycle_count() - start;
+        ESP_LOGI(TAG, "kernel %4u: direct %10lu, fft %10lu", m, (unsigned long)direct, (unsigned long)fft);
+        if((crossover == 0) && (fft < direct)){
+            crossover = m;
+        }
+    }
+    free(signal);
+    free(kernel);
+    free(output);
+
+    ESP_LOGI(TAG, "Crossover kernel lenght: %u", crossover);
+    conv_crossover = crossover;
+    return crossover;
+}
+
+bool FastFIRInit(fast_fir_t * filter, const float * kernel, uint16_t kernel_lenght){
+    uint16_t n;
+    if((kernel == NULL) || (kernel_lenght < MIN_KERNEL) || (2 * (uint32_t)kernel_lenght > CONV_MAX_FFT)){
+        return false;
+    }
+    if(!dsps_fft2r_initialized && !ConvInit()){
+        return false;
+    }
+    n = conv_next_pow2(4 * (uint32_t)kernel_lenght);
+    if(n > dsps_fft_w_table_size){
+        n = dsps_fft_w_table_size;
+    }
+    if(n < 2 * kernel_lenght){
+        return false;
+    }
+    conv_spectrum(filter->spectrum, kernel, kernel_lenght, n, false);
+    memset(filter->history, 0, sizeof(filter->history));
+    filter->fft_lenght = n;
+    filter->kernel_lenght = kernel_lenght;
+    filter->block = 2 * (n - kernel_lenght + 1);
+    return true;
+}
+
+uint16_t FastFIRBlock(const fast_fir_t * filter){
+    return filter->block;
+}
+
+void FastFIRProcess(fast_fir_t * filter, const float * input, float * output){
+    uint16_t n = filter->fft_lenght;
+    uint16_t hist = filter->kernel_lenght - 1;
+    uint16_t frame = filter->block / 2;
+    float scale = 1.0f / n;
+    uint16_t i;
+
+    /* Frames are [history, input] and the same shifted by one frame, both n long */
+    for(i = 0; i < n; i++){
+        conv_work[2 * i] = (i < hist) ? filter->history[i] : input[i - hist];
+        conv_work[2 * i + 1] = input[frame + i - hist];
+    }
+    /* frame >= kernel_lenght + 1: the new history is always inside the input block */
+    memcpy(filter->history, &input[filter->block - hist], hist * sizeof(float));
+
+    conv_fft(conv_work, n);
+    conv_filter_work(filter->spectrum, n);
+    /* Overlap-save: the first kernel_lenght - 1 results of each frame are discarded */
+    for(i = 0; i < frame; i++){
+        output[i] = conv_work[2 * (hist + i)] * scale;
+        output[frame + i] = -conv_work[2 * (hist + i) + 1] * scale;
+    }
+}
+
+/*==================[end of file]============================================*/
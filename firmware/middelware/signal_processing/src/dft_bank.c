@@ -0,0 +1,290 @@
+/**
+ * @file dft_bank.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "dft_bank.h"
+/*==================[macros and definitions]=================================*/
+#define Q29_SHIFT       29          /*!< Goertzel coefficient format (2cos(w) up to 2) */
+#define Q29_ONE         536870912.0
+#define Q15_MAX         32767.0f
+#define STATE_MAX       536870912.0f    /*!< 2^29: Goertzel state bound (room for 2cos(w) * s1 - s2) */
+#define MIN_LENGHT      2
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint32_t dft_isqrt(uint64_t x){
+    uint64_t res = 0;
+    uint64_t bit = 1ULL << 62;
+    while(bit > x){
+        bit >>= 2;
+    }
+    while(bit != 0){
+        if(x >= res + bit){
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else{
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)res;
+}
+
+static int16_t dft_sat16(uint64_t x){
+    return (x > INT16_MAX) ? INT16_MAX : (int16_t)x;
+}
+
+static bool dft_check(float sample_freq, const float * freqs, uint8_t bins){
+    if((sample_freq <= 0) || (bins == 0) || (bins > DFT_BANK_MAX_BINS)){
+        return false;
+    }
+    for(uint8_t b = 0; b < bins; b++){
+        if((freqs[b] < 0) || (freqs[b] > sample_freq / 2)){
+            return false;
+        }
+    }
+    return true;
+}
+
+/*==================[external functions definition]==========================*/
+bool GoertzelInitF32(goertzel_f32_t * bank, float sample_freq, const float * freqs, uint8_t bins, uint16_t block){
+    if(!dft_check(sample_freq, freqs, bins) || (block < MIN_LENGHT)){
+        return false;
+    }
+    for(uint8_t b = 0; b < bins; b++){
+        bank->coeff[b] = 2 * cosf(2 * M_PI * freqs[b] / sample_freq);
+    }
+    memset(bank->s1, 0, sizeof(bank->s1));
+    memset(bank->s2, 0, sizeof(bank->s2));
+    memset(bank->mag, 0, sizeof(bank->mag));
+    bank->block = block;
+    bank->count = 0;
+    bank->bins = bins;
+    return true;
+}
+
+uint16_t GoertzelProcessF32(goertzel_f32_t * bank, const float * samples, uint16_t lenght){
+    uint16_t blocks = 0;
+    uint8_t b;
+    float s0, power;
+    for(uint16_t i = 0; i < lenght; i++){
+        for(b = 0; b < bank->bins; b++){
+            s0 = samples[i] + bank->coeff[b] * bank->s1[b] - bank->s2[b];
+            bank->s2[b] = bank->s1[b];
+            bank->s1[b] = s0;
+        }
+        if(++bank->count < bank->block){
+            continue;
+        }
+        for(b = 0; b < bank->bins; b++){
+            power = bank->s1[b] * bank->s1[b] + bank->s2[b] * bank->s2[b] - bank->coeff[b] * bank->s1[b] * bank->s2[b];
+            bank->mag[b] = (power > 0) ? 2 * sqrtf(power) / bank->block : 0;
+            bank->s1[b] = 0;
+            bank->s2[b] = 0;
+        }
+        bank->count = 0;
+        blocks++;
+    }
+    return blocks;
+}
+
+void GoertzelGetMagnitudeF32(const goertzel_f32_t * bank, float * mag){
+    memcpy(mag, bank->mag, bank->bins * sizeof(float));
+}
+
+bool GoertzelInitQ15(goertzel_q15_t * bank, float sample_freq, const float * freqs, uint8_t bins, uint16_t block){
+    float w, gain, bound = 0;
+    if(!dft_check(sample_freq, freqs, bins) || (block < MIN_LENGHT)){
+        return false;
+    }
+    for(uint8_t b = 0; b < bins; b++){
+        w = 2 * M_PI * freqs[b] / sample_freq;
+        bank->coeff[b] = lround(2 * cos(w) * Q29_ONE);
+        /* Resonator gain over a block: min(block, 1 / |sin(w)|) */
+        gain = block;
+        if(fabsf(sinf(w)) * block > 1){
+            gain = 1 / fabsf(sinf(w));
+        }
+        if(gain * block * (Q15_MAX + 1) > bound){
+            bound = gain * block * (Q15_MAX + 1);
+        }
+    }
+    bank->shift = 0;
+    while(bound > STATE_MAX){
+        bound /= 2;
+        bank->shift++;
+    }
+    memset(bank->s1, 0, sizeof(bank->s1));
+    memset(bank->s2, 0, sizeof(bank->s2));
+    memset(bank->mag, 0, sizeof(bank->mag));
+    bank->block = block;
+    bank->count = 0;
+    bank->bins = bins;
+    return true;
+}
+
+uint16_t GoertzelProcessQ15(goertzel_q15_t * bank, const int16_t * samples, uint16_t lenght){
+    uint16_t blocks = 0;
+    uint8_t b;
+    int32_t x, s0;
+    int64_t t, power;
+    for(uint16_t i = 0; i < lenght; i++){
+        x = samples[i] >> bank->shift;
+        for(b = 0; b < bank->bins; b++){
+            s0 = x + (int32_t)(((int64_t)bank->coeff[b] * bank->s1[b] + (1LL << (Q29_SHIFT - 1))) >> Q29_SHIFT) - bank->s2[b];
+            bank->s2[b] = bank->s1[b];
+            bank->s1[b] = s0;
+        }
+        if(++bank->count < bank->block){
+            continue;
+        }
+        for(b = 0; b < bank->bins; b++){
+            t = ((int64_t)bank->coeff[b] * bank->s1[b]) >> Q29_SHIFT;
+            power = (int64_t)bank->s1[b] * bank->s1[b] + (int64_t)bank->s2[b] * bank->s2[b] - t * bank->s2[b];
+            bank->mag[b] = (power > 0) ? dft_sat16(((uint64_t)dft_isqrt(power) << (bank->shift + 1)) / bank->block) : 0;
+            bank->s1[b] = 0;
+            bank->s2[b] = 0;
+        }
+        bank->count = 0;
+        blocks++;
+    }
+    return blocks;
+}
+
+void GoertzelGetMagnitudeQ15(const goertzel_q15_t * bank, int16_t * mag){
+    memcpy(mag, bank->mag, bank->bins * sizeof(int16_t));
+}
+
+bool SDFTInitF32(sdft_f32_t * bank, float sample_freq, const float * freqs, uint8_t bins, uint16_t lenght){
+    if(!dft_check(sample_freq, freqs, bins) || (lenght < MIN_LENGHT) || (lenght > SDFT_MAX_LENGHT)){
+        return false;
+    }
+    for(uint16_t n = 0; n < lenght; n++){
+        bank->cos_t[n] = cosf(2 * M_PI * n / lenght);
+        bank->sin_t[n] = sinf(2 * M_PI * n / lenght);
+    }
+    for(uint8_t b = 0; b < bins; b++){
+        bank->k[b] = lroundf(freqs[b] * lenght / sample_freq);
+        bank->idx[b] = 0;
+    }
+    memset(bank->history, 0, sizeof(bank->history));
+    memset(bank->re, 0, sizeof(bank->re));
+    memset(bank->im, 0, sizeof(bank->im));
+    memset(bank->fresh_re, 0, sizeof(bank->fresh_re));
+    memset(bank->fresh_im, 0, sizeof(bank->fresh_im));
+    bank->lenght = lenght;
+    bank->pos = 0;
+    bank->bins = bins;
+    return true;
+}
+
+void SDFTProcessF32(sdft_f32_t * bank, const float * samples, uint16_t lenght){
+    uint8_t b;
+    float x, d, c, s;
+    uint16_t idx;
+    for(uint16_t i = 0; i < lenght; i++){
+        x = samples[i];
+        /* The leaving sample had the same twiddle (lenght samples ago) */
+        d = x - bank->history[bank->pos];
+        bank->history[bank->pos] = x;
+        for(b = 0; b < bank->bins; b++){
+            idx = bank->idx[b];
+            c = bank->cos_t[idx];
+            s = bank->sin_t[idx];
+            bank->re[b] += d * c;
+            bank->im[b] -= d * s;
+            bank->fresh_re[b] += x * c;
+            bank->fresh_im[b] -= x * s;
+            idx += bank->k[b];
+            bank->idx[b] = (idx >= bank->lenght) ? idx - bank->lenght : idx;
+        }
+        if(++bank->pos >= bank->lenght){
+            /* The fresh sums now cover exactly the window: drop accumulated rounding */
+            bank->pos = 0;
+            memcpy(bank->re, bank->fresh_re, sizeof(bank->re));
+            memcpy(bank->im, bank->fresh_im, sizeof(bank->im));
+            memset(bank->fresh_re, 0, sizeof(bank->fresh_re));
+            memset(bank->fresh_im, 0, sizeof(bank->fresh_im));
+        }
+    }
+}
+
+void SDFTGetMagnitudeF32(const sdft_f32_t * bank, float * mag){
+    for(uint8_t b = 0; b < bank->bins; b++){
+        mag[b] = 2 * sqrtf(bank->re[b] * bank->re[b] + bank->im[b] * bank->im[b]) / bank->lenght;
+    }
+}
+
+bool SDFTInitQ15(sdft_q15_t * bank, float sample_freq, const float * freqs, uint8_t bins, uint16_t lenght){
+    if(!dft_check(sample_freq, freqs, bins) || (lenght < MIN_LENGHT) || (lenght > SDFT_MAX_LENGHT)){
+        return false;
+    }
+    for(uint16_t n = 0; n < lenght; n++){
+        bank->cos_t[n] = lroundf(cosf(2 * M_PI * n / lenght) * Q15_MAX);
+        bank->sin_t[n] = lroundf(sinf(2 * M_PI * n / lenght) * Q15_MAX);
+    }
+    for(uint8_t b = 0; b < bins; b++){
+        bank->k[b] = lroundf(freqs[b] * lenght / sample_freq);
+        bank->idx[b] = 0;
+    }
+    memset(bank->history, 0, sizeof(bank->history));
+    memset(bank->re, 0, sizeof(bank->re));
+    memset(bank->im, 0, sizeof(bank->im));
+    bank->lenght = lenght;
+    bank->pos = 0;
+    bank->bins = bins;
+    return true;
+}
+
+void SDFTProcessQ15(sdft_q15_t * bank, const int16_t * samples, uint16_t lenght){
+    uint8_t b;
+    int32_t d;
+    uint16_t idx;
+    for(uint16_t i = 0; i < lenght; i++){
+        /* 17 bit difference x 16 bit twiddle fits in 32 bits: no rounding, no drift */
+        d = (int32_t)samples[i] - bank->history[bank->pos];
+        bank->history[bank->pos] = samples[i];
+        for(b = 0; b < bank->bins; b++){
+            idx = bank->idx[b];
+            bank->re[b] += d * bank->cos_t[idx];
+            bank->im[b] -= d * bank->sin_t[idx];
+            idx += bank->k[b];
+            bank->idx[b] = (idx >= bank->lenght) ? idx - bank->lenght : idx;
+        }
+        if(++bank->pos >= bank->lenght){
+            bank->pos = 0;
+        }
+    }
+}
+
+void SDFTGetMagnitudeQ15(const sdft_q15_t * bank, int16_t * mag){
+    /* |re|, |im| <= lenght * 2^30: drop 8 bits so the squares fit in 64 bits */
+    const uint8_t pre_shift = 8;
+    int64_t re, im;
+    uint64_t m;
+    for(uint8_t b = 0; b < bank->bins; b++){
+        re = bank->re[b] >> pre_shift;
+        im = bank->im[b] >> pre_shift;
+        m = dft_isqrt((uint64_t)(re * re) + (uint64_t)(im * im));
+        /* Twiddles are scaled by Q15_MAX: amplitude = 2 * |X| / (lenght * Q15_MAX) */
+        mag[b] = dft_sat16((m << (pre_shift + 1)) / ((uint32_t)bank->lenght * (uint32_t)Q15_MAX));
+    }
+}
+
+/*==================[end of file]============================================*/
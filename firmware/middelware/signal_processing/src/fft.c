@@ -11,15 +11,28 @@
 
 /*==================[inclusions]=============================================*/
 #include <string.h>
+#include <stdlib.h>
 #include <math.h>
 #include "fft.h"
+#include "fft_tables.h"
 #include "esp_dsp.h"
 #include "esp_log.h"
+#include "trace_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define TAG "FFT Module"
+#define MIN_LENGHT      8
+#define MAX_RADIX       5
+#define SIN_2PI_3       0.866025404f
+#define COS_2PI_5       0.309016994f
+#define COS_4PI_5       (-0.809016994f)
+#define SIN_2PI_5       0.951056516f
+#define SIN_4PI_5       0.587785252f
 /*==================[internal data declaration]==============================*/
 static float fft_complex[2 * MAX_SIGNAL_LENGHT];
 static float wind[MAX_SIGNAL_LENGHT];
+static uint16_t wind_lenght = 0;            /*!< Lenght of the window stored in wind */
+static fc32_t * mixed_twiddle = NULL;       /*!< W_N^k = (cos, sin)(2 * pi * k / N) for the last mixed radix lenght */
+static uint16_t mixed_lenght = 0;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -27,36 +40,275 @@ static float wind[MAX_SIGNAL_LENGHT];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Next radix of a mixed radix lenght (4 first, then 2, 3 and 5)
+ *
+ * @return uint8_t Radix, 0 if the lenght has other prime factors
+ */
+static uint8_t fft_radix(uint16_t n){
+    if(n % 4 == 0){
+        return 4;
+    }
+    if(n % 2 == 0){
+        return 2;
+    }
+    if(n % 3 == 0){
+        return 3;
+    }
+    if(n % 5 == 0){
+        return 5;
+    }
+    return 0;
+}
+
+static bool fft_is_mixed(uint16_t n){
+    uint8_t p;
+    while(n > 1){
+        p = fft_radix(n);
+        if(p == 0){
+            return false;
+        }
+        n /= p;
+    }
+    return true;
+}
+
+/**
+ * @brief Forward DFT of p (2 to 5) points
+ */
+static void fft_butterfly(const fc32_t * a, fc32_t * b, uint8_t p){
+    fc32_t t1, t2, t3, t4, u1, u2, v1, v2;
+    switch(p){
+        case 2:
+            b[0].re = a[0].re + a[1].re;
+            b[0].im = a[0].im + a[1].im;
+            b[1].re = a[0].re - a[1].re;
+            b[1].im = a[0].im - a[1].im;
+        break;
+        case 3:
+            t1.re = a[1].re + a[2].re;
+            t1.im = a[1].im + a[2].im;
+            t2.re = a[0].re - 0.5f * t1.re;
+            t2.im = a[0].im - 0.5f * t1.im;
+            /* -j * sin(2pi/3) * (a1 - a2) */
+            t3.re = SIN_2PI_3 * (a[1].im - a[2].im);
+            t3.im = -SIN_2PI_3 * (a[1].re - a[2].re);
+            b[0].re = a[0].re + t1.re;
+            b[0].im = a[0].im + t1.im;
+            b[1].re = t2.re + t3.re;
+            b[1].im = t2.im + t3.im;
+            b[2].re = t2.re - t3.re;
+            b[2].im = t2.im - t3.im;
+        break;
+        case 4:
+            t1.re = a[0].re + a[2].re;
+            t1.im = a[0].im + a[2].im;
+            t2.re = a[0].re - a[2].re;
+            t2.im = a[0].im - a[2].im;
+            t3.re = a[1].re + a[3].re;
+            t3.im = a[1].im + a[3].im;
+            /* -j * (a1 - a3) */
+            t4.re = a[1].im - a[3].im;
+            t4.im = a[3].re - a[1].re;
+            b[0].re = t1.re + t3.re;
+            b[0].im = t1.im + t3.im;
+            b[1].re = t2.re + t4.re;
+            b[1].im = t2.im + t4.im;
+            b[2].re = t1.re - t3.re;
+            b[2].im = t1.im - t3.im;
+            b[3].re = t2.re - t4.re;
+            b[3].im = t2.im - t4.im;
+        break;
+        case 5:
+            t1.re = a[1].re + a[4].re;
+            t1.im = a[1].im + a[4].im;
+            t2.re = a[2].re + a[3].re;
+            t2.im = a[2].im + a[3].im;
+            t3.re = a[1].re - a[4].re;
+            t3.im = a[1].im - a[4].im;
+            t4.re = a[2].re - a[3].re;
+            t4.im = a[2].im - a[3].im;
+            u1.re = a[0].re + COS_2PI_5 * t1.re + COS_4PI_5 * t2.re;
+            u1.im = a[0].im + COS_2PI_5 * t1.im + COS_4PI_5 * t2.im;
+            u2.re = a[0].re + COS_4PI_5 * t1.re + COS_2PI_5 * t2.re;
+            u2.im = a[0].im + COS_4PI_5 * t1.im + COS_2PI_5 * t2.im;
+            /* -j * (s1 * t3 + s2 * t4) and -j * (s2 * t3 - s1 * t4) */
+            v1.re = SIN_2PI_5 * t3.im + SIN_4PI_5 * t4.im;
+            v1.im = -(SIN_2PI_5 * t3.re + SIN_4PI_5 * t4.re);
+            v2.re = SIN_4PI_5 * t3.im - SIN_2PI_5 * t4.im;
+            v2.im = -(SIN_4PI_5 * t3.re - SIN_2PI_5 * t4.re);
+            b[0].re = a[0].re + t1.re + t2.re;
+            b[0].im = a[0].im + t1.im + t2.im;
+            b[1].re = u1.re + v1.re;
+            b[1].im = u1.im + v1.im;
+            b[4].re = u1.re - v1.re;
+            b[4].im = u1.im - v1.im;
+            b[2].re = u2.re + v2.re;
+            b[2].im = u2.im + v2.im;
+            b[3].re = u2.re - v2.re;
+            b[3].im = u2.im - v2.im;
+        break;
+    }
+}
+
+/**
+ * @brief One Stockham (self sorting) decimation in frequency stage:
+ * y[(q * p + k) * s + j] = W_n^(q * k) * DFT_p(x[q * s + r * m * s + j])[k], with n = m * p.
+ * The twiddle table is for the real signal lenght (twice the complex lenght): W_n^(q * k) = W_N^(2 * q * k * s).
+ */
+static void fft_mixed_stage(const fc32_t * x, fc32_t * y, uint16_t m, uint16_t s, uint8_t p){
+    fc32_t a[MAX_RADIX], b[MAX_RADIX], w[MAX_RADIX];
+    uint32_t idx;
+    uint16_t q, j;
+    uint8_t k, r;
+    for(q = 0; q < m; q++){
+        for(k = 1; k < p; k++){
+            idx = 2 * (uint32_t)q * k * s;
+            w[k] = mixed_twiddle[idx];
+        }
+        for(j = 0; j < s; j++){
+            for(r = 0; r < p; r++){
+                a[r] = x[j + s * (q + r * m)];
+            }
+            fft_butterfly(a, b, p);
+            y[j + s * q * p] = b[0];
+            for(k = 1; k < p; k++){
+                /* b * conj(w): forward transform */
+                y[j + s * (q * p + k)].re = b[k].re * w[k].re + b[k].im * w[k].im;
+                y[j + s * (q * p + k)].im = b[k].im * w[k].re - b[k].re * w[k].im;
+            }
+        }
+    }
+}
+
+static bool fft_mixed_twiddle(uint16_t signal_lenght){
+    if(mixed_lenght == signal_lenght){
+        return true;
+    }
+    free(mixed_twiddle);
+    mixed_lenght = 0;
+    mixed_twiddle = malloc(signal_lenght * sizeof(fc32_t));
+    if(mixed_twiddle == NULL){
+        return false;
+    }
+    for(uint16_t k = 0; k < signal_lenght; k++){
+        mixed_twiddle[k].re = cosf(2 * M_PI * k / signal_lenght);
+        mixed_twiddle[k].im = sinf(2 * M_PI * k / signal_lenght);
+    }
+    mixed_lenght = signal_lenght;
+    return true;
+}
+
+/**
+ * @brief Complex FFT of the n = signal_lenght / 2 points in fft_complex, using the
+ * second half of fft_complex as scratch. Returns the array holding the result.
+ */
+static fc32_t * fft_mixed(uint16_t n){
+    fc32_t * x = (fc32_t *)fft_complex;
+    fc32_t * y = (fc32_t *)&fft_complex[MAX_SIGNAL_LENGHT];
+    fc32_t * tmp;
+    uint16_t s = 1;
+    uint8_t p;
+    while(n > 1){
+        p = fft_radix(n);
+        n /= p;
+        fft_mixed_stage(x, y, n, s, p);
+        s *= p;
+        tmp = x;
+        x = y;
+        y = tmp;
+    }
+    return x;
+}
+
+/**
+ * @brief Complex FFT of the n points in fft_complex with the esp-dsp radix-4 (n power
+ * of 4) or radix-2 kernels, then split into the spectrum of the 2 * n real samples.
+ */
+static void fft_pow2(uint16_t n){
+    if(dsp_power_of_two(n) % 2 == 0){
+        dsps_fft4r_fc32(fft_complex, n);
+        dsps_bit_rev4r_fc32(fft_complex, n);
+    } else{
+        dsps_fft2r_fc32(fft_complex, n);
+        dsps_bit_rev_fc32(fft_complex, n);
+    }
+    dsps_cplx2real_fc32(fft_complex, n);
+}
 
 /*==================[external functions definition]==========================*/
 bool FFTInit(void){
-    esp_err_t ret = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
-    if (ret != ESP_OK){
-        return false;
+    /* esp-dsp reads the twiddles through these pointers: the const tables in
+     * flash replace the ones dsps_fftXr_init_fc32() would generate in RAM */
+    if(!dsps_fft2r_initialized){
+        dsps_fft_w_table_fc32 = (float *)fft_w2r_table;
+        dsps_fft_w_table_size = FFT_W2R_TABLE_SIZE;
+        dsps_fft2r_initialized = 1;
+    }
+    if(!dsps_fft4r_initialized){
+        dsps_fft4r_w_table_fc32 = (float *)fft_w4r_table;
+        dsps_fft4r_w_table_size = FFT_W4R_TABLE_SIZE / 2;
+        dsps_fft4r_initialized = 1;
     }
     return true;
 }
 
+bool FFTCheckLenght(uint16_t signal_lenght){
+    if((signal_lenght < MIN_LENGHT) || (signal_lenght > MAX_SIGNAL_LENGHT) || (signal_lenght % 2 != 0)){
+        return false;
+    }
+    return dsp_is_power_of_two(signal_lenght) || fft_is_mixed(signal_lenght / 2);
+}
+
 void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
-    // Generate Hann window
-    dsps_wind_hann_f32(wind, signal_lenght);
-    // Clear fft array
-    memset(fft_complex, 0, 2 * MAX_SIGNAL_LENGHT * sizeof(float));
-    // Multiply input array with window and store as real part
-    dsps_mul_f32(signal, wind, fft_complex, signal_lenght, 1, 1, 2);    
-    // Calculate FFT  
-    dsps_fft2r_fc32(fft_complex, signal_lenght);
-    // Bit reverse
-    dsps_bit_rev_fc32(fft_complex, signal_lenght);
-    // Convert one complex vector to two complex vectors
-    dsps_cplx2reC_fc32(fft_complex, signal_lenght);
-    // Calculate FFT magnitude 
-    for (int j = 0; j < signal_lenght; j++){
-            fft_complex[j] = 2*(sqrt(fft_complex[j*2+0]*fft_complex[j*2+0] + fft_complex[j*2+1]*fft_complex[j*2+1])) / (signal_lenght/2);
-    }
-    fft_complex[0] = fft_complex[0] / 2;
-    // Copy result in fft array
-    memcpy(fft, fft_complex, (signal_lenght / 2) * sizeof(float));
+    uint16_t n = signal_lenght / 2;
+    fc32_t * z, zk, zc, fo;
+    float x_re, x_im, c, s;
+    if(!FFTCheckLenght(signal_lenght)){
+        ESP_LOGE(TAG, "Invalid signal lenght %u", signal_lenght);
+        return;
+    }
+    TRACE_ENTER(TRACE_FFT);
+    // Generate Hann window (only when the lenght changes)
+    if(wind_lenght != signal_lenght){
+        dsps_wind_hann_f32(wind, signal_lenght);
+        wind_lenght = signal_lenght;
+    }
+    // Multiply input array with window: even samples as real part, odd samples as imaginary part
+    dsps_mul_f32(signal, wind, fft_complex, signal_lenght, 1, 1, 1);
+    if(dsp_is_power_of_two(signal_lenght)){
+        fft_pow2(n);
+        // Bins 1 to n - 1 in place, bin 0 real (the imaginary part holds bin n)
+        fft_complex[1] = 0;
+        z = (fc32_t *)fft_complex;
+        for(uint16_t k = 0; k < n; k++){
+            fft[k] = sqrtf(z[k].re * z[k].re + z[k].im * z[k].im);
+        }
+    } else{
+        if(!fft_mixed_twiddle(signal_lenght)){
+            ESP_LOGE(TAG, "Not possible to allocate twiddles for lenght %u", signal_lenght);
+            TRACE_EXIT(TRACE_FFT);
+            return;
+        }
+        z = fft_mixed(n);
+        // Split the spectrum of the packed signal: X[k] = Fe[k] + W_N^k * Fo[k]
+        for(uint16_t k = 0; k < n; k++){
+            zk = z[k];
+            zc = z[(k == 0) ? 0 : n - k];
+            // Fo = -j * (Z[k] - conj(Z[n - k])) / 2
+            fo.re = (zk.im + zc.im) / 2;
+            fo.im = (zc.re - zk.re) / 2;
+            c = mixed_twiddle[k].re;
+            s = mixed_twiddle[k].im;
+            x_re = (zk.re + zc.re) / 2 + fo.re * c + fo.im * s;
+            x_im = (zk.im - zc.im) / 2 + fo.im * c - fo.re * s;
+            fft[k] = sqrtf(x_re * x_re + x_im * x_im);
+        }
+    }
+    // Same scaling as the complex radix-2 version of this function
+    dsps_mulc_f32(fft, fft, n, 8.0f / signal_lenght, 1, 1);
+    fft[0] = fft[0] / 4;
+    TRACE_EXIT(TRACE_FFT);
 }
 
 void FFTFrequency(float sample_freq, uint16_t signal_lenght, float * f){
@@ -66,4 +318,4 @@ void FFTFrequency(float sample_freq, uint16_t signal_lenght, float * f){
     }
 }
 
-/*==================[end of file]============================================*/
\ No newline at end of file
+/*==================[end of file]============================================*/
@@ -0,0 +1,1313 @@
+/**
+ * @file fft_tables.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief Twiddle tables generated with dsps_gen_w_r2_fc32() + dsps_bit_rev_fc32()
+ * (radix-2, N = 1024) and the dsps_fft4r_init_fc32() cos/sin loop (radix-4, N = 1024)
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "fft_tables.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+const float fft_w2r_table[FFT_W2R_TABLE_SIZE] = {
+     1.00000000e+00f,  0.00000000e+00f, -4.37113883e-08f,  1.00000000e+00f,
+     7.07106769e-01f,  7.07106769e-01f, -7.07106769e-01f,  7.07106769e-01f,
+     9.23879504e-01f,  3.82683456e-01f, -3.82683516e-01f,  9.23879504e-01f,
+     3.82683426e-01f,  9.23879504e-01f, -9.23879623e-01f,  3.82683277e-01f,
+     9.80785251e-01f,  1.95090324e-01f, -1.95090324e-01f,  9.80785251e-01f,
+     5.55570185e-01f,  8.31469655e-01f, -8.31469655e-01f,  5.55570185e-01f,
+     8.31469595e-01f,  5.55570245e-01f, -5.55570364e-01f,  8.31469536e-01f,
+     1.95090234e-01f,  9.80785310e-01f, -9.80785310e-01f,  1.95090309e-01f,
+     9.95184720e-01f,  9.80171412e-02f, -9.80172232e-02f,  9.95184720e-01f,
+     6.34393275e-01f,  7.73010433e-01f, -7.73010492e-01f,  6.34393275e-01f,
+     8.81921232e-01f,  4.71396744e-01f, -4.71396834e-01f,  8.81921232e-01f,
+     2.90284634e-01f,  9.56940353e-01f, -9.56940353e-01f,  2.90284723e-01f,
+     9.56940353e-01f,  2.90284693e-01f, -2.90284723e-01f,  9.56940293e-01f,
+     4.71396655e-01f,  8.81921291e-01f, -8.81921351e-01f,  4.71396625e-01f,
+     7.73010433e-01f,  6.34393334e-01f, -6.34393275e-01f,  7.73010492e-01f,
+     9.80171338e-02f,  9.95184720e-01f, -9.95184720e-01f,  9.80170965e-02f,
+     9.98795450e-01f,  4.90676761e-02f, -4.90677394e-02f,  9.98795450e-01f,
+     6.71558917e-01f,  7.40951180e-01f, -7.40951240e-01f,  6.71558857e-01f,
+     9.03989315e-01f,  4.27555084e-01f, -4.27555084e-01f,  9.03989315e-01f,
+     3.36889833e-01f,  9.41544056e-01f, -9.41544116e-01f,  3.36889803e-01f,
+     9.70031261e-01f,  2.42980197e-01f, -2.42980197e-01f,  9.70031261e-01f,
+     5.14102697e-01f,  8.57728660e-01f, -8.57728601e-01f,  5.14102757e-01f,
+     8.03207517e-01f,  5.95699310e-01f, -5.95699370e-01f,  8.03207517e-01f,
+     1.46730497e-01f,  9.89176512e-01f, -9.89176512e-01f,  1.46730334e-01f,
+     9.89176512e-01f,  1.46730468e-01f, -1.46730572e-01f,  9.89176512e-01f,
+     5.95699310e-01f,  8.03207517e-01f, -8.03207636e-01f,  5.95699131e-01f,
+     8.57728601e-01f,  5.14102757e-01f, -5.14102757e-01f,  8.57728601e-01f,
+     2.42980123e-01f,  9.70031261e-01f, -9.70031261e-01f,  2.42980078e-01f,
+     9.41544056e-01f,  3.36889863e-01f, -3.36889923e-01f,  9.41544056e-01f,
+     4.27555114e-01f,  9.03989315e-01f, -9.03989315e-01f,  4.27555054e-01f,
+     7.40951121e-01f,  6.71558976e-01f, -6.71559036e-01f,  7.40951061e-01f,
+     4.90676500e-02f,  9.98795450e-01f, -9.98795450e-01f,  4.90674861e-02f,
+     9.99698818e-01f,  2.45412290e-02f, -2.45412234e-02f,  9.99698818e-01f,
+     6.89540505e-01f,  7.24247098e-01f, -7.24247158e-01f,  6.89540505e-01f,
+     9.14209723e-01f,  4.05241340e-01f, -4.05241340e-01f,  9.14209723e-01f,
+     3.59894961e-01f,  9.32992816e-01f, -9.32992816e-01f,  3.59895051e-01f,
+     9.75702107e-01f,  2.19101235e-01f, -2.19101310e-01f,  9.75702107e-01f,
+     5.34997642e-01f,  8.44853580e-01f, -8.44853640e-01f,  5.34997463e-01f,
+     8.17584813e-01f,  5.75808227e-01f, -5.75808167e-01f,  8.17584813e-01f,
+     1.70961857e-01f,  9.85277653e-01f, -9.85277653e-01f,  1.70961812e-01f,
+     9.92479563e-01f,  1.22410677e-01f, -1.22410707e-01f,  9.92479503e-01f,
+     6.15231574e-01f,  7.88346410e-01f, -7.88346469e-01f,  6.15231514e-01f,
+     8.70086968e-01f,  4.92898226e-01f, -4.92898166e-01f,  8.70087028e-01f,
+     2.66712755e-01f,  9.63776052e-01f, -9.63776052e-01f,  2.66712725e-01f,
+     9.49528158e-01f,  3.13681751e-01f, -3.13681722e-01f,  9.49528158e-01f,
+     4.49611306e-01f,  8.93224299e-01f, -8.93224299e-01f,  4.49611366e-01f,
+     7.57208824e-01f,  6.53172851e-01f, -6.53172851e-01f,  7.57208824e-01f,
+     7.35644922e-02f,  9.97290432e-01f, -9.97290492e-01f,  7.35644475e-02f,
+     9.97290432e-01f,  7.35645667e-02f, -7.35645741e-02f,  9.97290432e-01f,
+     6.53172791e-01f,  7.57208884e-01f, -7.57208824e-01f,  6.53172851e-01f,
+     8.93224299e-01f,  4.49611336e-01f, -4.49611366e-01f,  8.93224299e-01f,
+     3.13681662e-01f,  9.49528217e-01f, -9.49528217e-01f,  3.13681602e-01f,
+     9.63776052e-01f,  2.66712785e-01f, -2.66712844e-01f,  9.63776052e-01f,
+     4.92898166e-01f,  8.70086968e-01f, -8.70087028e-01f,  4.92898136e-01f,
+     7.88346410e-01f,  6.15231633e-01f, -6.15231693e-01f,  7.88346350e-01f,
+     1.22410625e-01f,  9.92479563e-01f, -9.92479503e-01f,  1.22410700e-01f,
+     9.85277653e-01f,  1.70961902e-01f, -1.70961946e-01f,  9.85277653e-01f,
+     5.75808167e-01f,  8.17584813e-01f, -8.17584813e-01f,  5.75808167e-01f,
+     8.44853580e-01f,  5.34997582e-01f, -5.34997702e-01f,  8.44853520e-01f,
+     2.19101235e-01f,  9.75702107e-01f, -9.75702167e-01f,  2.19101071e-01f,
+     9.32992816e-01f,  3.59895051e-01f, -3.59895051e-01f,  9.32992816e-01f,
+     4.05241281e-01f,  9.14209783e-01f, -9.14209783e-01f,  4.05241221e-01f,
+     7.24247098e-01f,  6.89540565e-01f, -6.89540684e-01f,  7.24246979e-01f,
+     2.45411359e-02f,  9.99698818e-01f, -9.99698818e-01f,  2.45412104e-02f,
+     9.99924719e-01f,  1.22715384e-02f, -1.22716166e-02f,  9.99924719e-01f,
+     6.98376238e-01f,  7.15730846e-01f, -7.15730846e-01f,  6.98376238e-01f,
+     9.19113874e-01f,  3.93992066e-01f, -3.93992037e-01f,  9.19113874e-01f,
+     3.71317148e-01f,  9.28506076e-01f, -9.28506076e-01f,  3.71317238e-01f,
+     9.78317380e-01f,  2.07111388e-01f, -2.07111418e-01f,  9.78317380e-01f,
+     5.45324981e-01f,  8.38224709e-01f, -8.38224769e-01f,  5.45324862e-01f,
+     8.24589312e-01f,  5.65731823e-01f, -5.65731764e-01f,  8.24589312e-01f,
+     1.83039889e-01f,  9.83105481e-01f, -9.83105481e-01f,  1.83039844e-01f,
+     9.93906975e-01f,  1.10222206e-01f, -1.10222206e-01f,  9.93906975e-01f,
+     6.24859452e-01f,  7.80737281e-01f, -7.80737281e-01f,  6.24859452e-01f,
+     8.76070082e-01f,  4.82183754e-01f, -4.82183903e-01f,  8.76070023e-01f,
+     2.78519630e-01f,  9.60430562e-01f, -9.60430503e-01f,  2.78519690e-01f,
+     9.53306019e-01f,  3.02005947e-01f, -3.02006036e-01f,  9.53306019e-01f,
+     4.60538715e-01f,  8.87639642e-01f, -8.87639701e-01f,  4.60538566e-01f,
+     7.65167236e-01f,  6.43831551e-01f, -6.43831551e-01f,  7.65167236e-01f,
+     8.57972726e-02f,  9.96312618e-01f, -9.96312618e-01f,  8.57972279e-02f,
+     9.98118103e-01f,  6.13207407e-02f, -6.13208339e-02f,  9.98118103e-01f,
+     6.62415743e-01f,  7.49136388e-01f, -7.49136508e-01f,  6.62415624e-01f,
+     8.98674488e-01f,  4.38616246e-01f, -4.38616246e-01f,  8.98674428e-01f,
+     3.25310230e-01f,  9.45607364e-01f, -9.45607364e-01f,  3.25310200e-01f,
+     9.66976464e-01f,  2.54865676e-01f, -2.54865706e-01f,  9.66976464e-01f,
+     5.03538430e-01f,  8.63972843e-01f, -8.63972843e-01f,  5.03538370e-01f,
+     7.95836926e-01f,  6.05511010e-01f, -6.05511129e-01f,  7.95836866e-01f,
+     1.34580687e-01f,  9.90902662e-01f, -9.90902662e-01f,  1.34580523e-01f,
+     9.87301409e-01f,  1.58858150e-01f, -1.58858165e-01f,  9.87301409e-01f,
+     5.85797846e-01f,  8.10457170e-01f, -8.10457170e-01f,  5.85797846e-01f,
+     8.51355195e-01f,  5.24589717e-01f, -5.24589717e-01f,  8.51355135e-01f,
+     2.31058136e-01f,  9.72939968e-01f, -9.72939968e-01f,  2.31057972e-01f,
+     9.37339008e-01f,  3.48418683e-01f, -3.48418772e-01f,  9.37338948e-01f,
+     4.16429549e-01f,  9.09168005e-01f, -9.09168005e-01f,  4.16429490e-01f,
+     7.32654274e-01f,  6.80601001e-01f, -6.80601120e-01f,  7.32654154e-01f,
+     3.68071645e-02f,  9.99322414e-01f, -9.99322355e-01f,  3.68072391e-02f,
+     9.99322355e-01f,  3.68072242e-02f, -3.68072502e-02f,  9.99322355e-01f,
+     6.80601001e-01f,  7.32654274e-01f, -7.32654333e-01f,  6.80600941e-01f,
+     9.09167945e-01f,  4.16429579e-01f, -4.16429520e-01f,  9.09168005e-01f,
+     3.48418683e-01f,  9.37339008e-01f, -9.37339008e-01f,  3.48418653e-01f,
+     9.72939968e-01f,  2.31058121e-01f, -2.31058210e-01f,  9.72939909e-01f,
+     5.24589658e-01f,  8.51355195e-01f, -8.51355314e-01f,  5.24589539e-01f,
+     8.10457170e-01f,  5.85797906e-01f, -5.85797906e-01f,  8.10457170e-01f,
+     1.58858076e-01f,  9.87301409e-01f, -9.87301409e-01f,  1.58858031e-01f,
+     9.90902662e-01f,  1.34580716e-01f, -1.34580776e-01f,  9.90902603e-01f,
+     6.05511010e-01f,  7.95836926e-01f, -7.95836985e-01f,  6.05510950e-01f,
+     8.63972843e-01f,  5.03538370e-01f, -5.03538370e-01f,  8.63972843e-01f,
+     2.54865646e-01f,  9.66976464e-01f, -9.66976464e-01f,  2.54865587e-01f,
+     9.45607305e-01f,  3.25310320e-01f, -3.25310320e-01f,  9.45607305e-01f,
+     4.38616186e-01f,  8.98674488e-01f, -8.98674488e-01f,  4.38616246e-01f,
+     7.49136388e-01f,  6.62415802e-01f, -6.62415862e-01f,  7.49136329e-01f,
+     6.13207482e-02f,  9.98118103e-01f, -9.98118103e-01f,  6.13205843e-02f,
+     9.96312618e-01f,  8.57973173e-02f, -8.57973620e-02f,  9.96312618e-01f,
+     6.43831551e-01f,  7.65167296e-01f, -7.65167296e-01f,  6.43831551e-01f,
+     8.87639642e-01f,  4.60538715e-01f, -4.60538775e-01f,  8.87639582e-01f,
+     3.02005947e-01f,  9.53306019e-01f, -9.53306079e-01f,  3.02005798e-01f,
+     9.60430503e-01f,  2.78519690e-01f, -2.78519690e-01f,  9.60430503e-01f,
+     4.82183725e-01f,  8.76070142e-01f, -8.76070142e-01f,  4.82183695e-01f,
+     7.80737221e-01f,  6.24859512e-01f, -6.24859631e-01f,  7.80737102e-01f,
+     1.10222116e-01f,  9.93906975e-01f, -9.93906975e-01f,  1.10222198e-01f,
+     9.83105481e-01f,  1.83039889e-01f, -1.83039978e-01f,  9.83105481e-01f,
+     5.65731823e-01f,  8.24589312e-01f, -8.24589312e-01f,  5.65731764e-01f,
+     8.38224709e-01f,  5.45324981e-01f, -5.45325100e-01f,  8.38224649e-01f,
+     2.07111329e-01f,  9.78317380e-01f, -9.78317380e-01f,  2.07111403e-01f,
+     9.28506076e-01f,  3.71317208e-01f, -3.71317238e-01f,  9.28506076e-01f,
+     3.93991947e-01f,  9.19113874e-01f, -9.19113874e-01f,  3.93991917e-01f,
+     7.15730786e-01f,  6.98376298e-01f, -6.98376238e-01f,  7.15730846e-01f,
+     1.22715291e-02f,  9.99924719e-01f, -9.99924719e-01f,  1.22714853e-02f,
+     9.99981165e-01f,  6.13588467e-03f, -6.13594567e-03f,  9.99981165e-01f,
+     7.02754736e-01f,  7.11432219e-01f, -7.11432219e-01f,  7.02754736e-01f,
+     9.21514034e-01f,  3.88345033e-01f, -3.88345152e-01f,  9.21513975e-01f,
+     3.77007395e-01f,  9.26210225e-01f, -9.26210284e-01f,  3.77007246e-01f,
+     9.79569793e-01f,  2.01104641e-01f, -2.01104656e-01f,  9.79569733e-01f,
+     5.50457954e-01f,  8.34862888e-01f, -8.34862947e-01f,  5.50457895e-01f,
+     8.28045011e-01f,  5.60661614e-01f, -5.60661554e-01f,  8.28045070e-01f,
+     1.89068690e-01f,  9.81963873e-01f, -9.81963873e-01f,  1.89068645e-01f,
+     9.94564593e-01f,  1.04121640e-01f, -1.04121737e-01f,  9.94564533e-01f,
+     6.29638255e-01f,  7.76888490e-01f, -7.76888490e-01f,  6.29638195e-01f,
+     8.79012227e-01f,  4.76799250e-01f, -4.76799339e-01f,  8.79012167e-01f,
+     2.84407467e-01f,  9.58703518e-01f, -9.58703458e-01f,  2.84407556e-01f,
+     9.55141187e-01f,  2.96150893e-01f, -2.96150953e-01f,  9.55141127e-01f,
+     4.65976506e-01f,  8.84797096e-01f, -8.84797156e-01f,  4.65976357e-01f,
+     7.69103348e-01f,  6.39124453e-01f, -6.39124453e-01f,  7.69103348e-01f,
+     9.19089392e-02f,  9.95767415e-01f, -9.95767415e-01f,  9.19088945e-02f,
+     9.98475552e-01f,  5.51952459e-02f, -5.51953241e-02f,  9.98475552e-01f,
+     6.66999936e-01f,  7.45057762e-01f, -7.45057881e-01f,  6.66999817e-01f,
+     9.01348829e-01f,  4.33093846e-01f, -4.33093816e-01f,  9.01348829e-01f,
+     3.31106275e-01f,  9.43593442e-01f, -9.43593502e-01f,  3.31106216e-01f,
+     9.68522072e-01f,  2.48927608e-01f, -2.48927653e-01f,  9.68522072e-01f,
+     5.08830070e-01f,  8.60866964e-01f, -8.60866964e-01f,  5.08830130e-01f,
+     7.99537241e-01f,  6.00616515e-01f, -6.00616574e-01f,  7.99537241e-01f,
+     1.40658244e-01f,  9.90058184e-01f, -9.90058243e-01f,  1.40658081e-01f,
+     9.88257587e-01f,  1.52797192e-01f, -1.52797192e-01f,  9.88257587e-01f,
+     5.90759695e-01f,  8.06847572e-01f, -8.06847513e-01f,  5.90759754e-01f,
+     8.54557991e-01f,  5.19356012e-01f, -5.19356012e-01f,  8.54557991e-01f,
+     2.37023532e-01f,  9.71503913e-01f, -9.71503913e-01f,  2.37023488e-01f,
+     9.39459205e-01f,  3.42660725e-01f, -3.42660785e-01f,  9.39459205e-01f,
+     4.22000259e-01f,  9.06595707e-01f, -9.06595707e-01f,  4.22000229e-01f,
+     7.36816585e-01f,  6.76092744e-01f, -6.76092803e-01f,  7.36816466e-01f,
+     4.29382175e-02f,  9.99077737e-01f, -9.99077737e-01f,  4.29380536e-02f,
+     9.99529421e-01f,  3.06748040e-02f, -3.06748152e-02f,  9.99529421e-01f,
+     6.85083628e-01f,  7.28464425e-01f, -7.28464425e-01f,  6.85083628e-01f,
+     9.11706030e-01f,  4.10843194e-01f, -4.10843223e-01f,  9.11706030e-01f,
+     3.54163438e-01f,  9.35183525e-01f, -9.35183525e-01f,  3.54163527e-01f,
+     9.74339366e-01f,  2.25083917e-01f, -2.25084007e-01f,  9.74339366e-01f,
+     5.29803634e-01f,  8.48120332e-01f, -8.48120451e-01f,  5.29803455e-01f,
+     8.14036310e-01f,  5.80814004e-01f, -5.80813944e-01f,  8.14036310e-01f,
+     1.64913073e-01f,  9.86308098e-01f, -9.86308098e-01f,  1.64913028e-01f,
+     9.91709769e-01f,  1.28498122e-01f, -1.28498167e-01f,  9.91709769e-01f,
+     6.10382795e-01f,  7.92106569e-01f, -7.92106688e-01f,  6.10382676e-01f,
+     8.67046237e-01f,  4.98227656e-01f, -4.98227656e-01f,  8.67046237e-01f,
+     2.60794103e-01f,  9.65394437e-01f, -9.65394437e-01f,  2.60794073e-01f,
+     9.47585583e-01f,  3.19502026e-01f, -3.19502056e-01f,  9.47585583e-01f,
+     4.44122106e-01f,  8.95966291e-01f, -8.95966232e-01f,  4.44122165e-01f,
+     7.53186822e-01f,  6.57806695e-01f, -6.57806754e-01f,  7.53186762e-01f,
+     6.74438328e-02f,  9.97723103e-01f, -9.97723103e-01f,  6.74437881e-02f,
+     9.96820271e-01f,  7.96824396e-02f, -7.96824694e-02f,  9.96820271e-01f,
+     6.48514390e-01f,  7.61202395e-01f, -7.61202395e-01f,  6.48514390e-01f,
+     8.90448749e-01f,  4.55083579e-01f, -4.55083638e-01f,  8.90448689e-01f,
+     3.07849646e-01f,  9.51435030e-01f, -9.51435089e-01f,  3.07849497e-01f,
+     9.62121427e-01f,  2.72621363e-01f, -2.72621363e-01f,  9.62121427e-01f,
+     4.87550139e-01f,  8.73094976e-01f, -8.73095036e-01f,  4.87550080e-01f,
+     7.84556627e-01f,  6.20057225e-01f, -6.20057344e-01f,  7.84556508e-01f,
+     1.16318561e-01f,  9.93211985e-01f, -9.93211925e-01f,  1.16318636e-01f,
+     9.84210074e-01f,  1.77004218e-01f, -1.77004293e-01f,  9.84210074e-01f,
+     5.70780694e-01f,  8.21102560e-01f, -8.21102560e-01f,  5.70780694e-01f,
+     8.41554999e-01f,  5.40171504e-01f, -5.40171564e-01f,  8.41554940e-01f,
+     2.13110298e-01f,  9.77028131e-01f, -9.77028191e-01f,  2.13110134e-01f,
+     9.30766940e-01f,  3.65613014e-01f, -3.65613043e-01f,  9.30766940e-01f,
+     3.99624139e-01f,  9.16679084e-01f, -9.16679084e-01f,  3.99624109e-01f,
+     7.20002472e-01f,  6.93971455e-01f, -6.93971455e-01f,  7.20002532e-01f,
+     1.84067376e-02f,  9.99830604e-01f, -9.99830604e-01f,  1.84066948e-02f,
+     9.99830604e-01f,  1.84067301e-02f, -1.84068251e-02f,  9.99830604e-01f,
+     6.93971455e-01f,  7.20002532e-01f, -7.20002532e-01f,  6.93971395e-01f,
+     9.16679084e-01f,  3.99624199e-01f, -3.99624228e-01f,  9.16679025e-01f,
+     3.65612954e-01f,  9.30767000e-01f, -9.30766940e-01f,  3.65613014e-01f,
+     9.77028131e-01f,  2.13110328e-01f, -2.13110372e-01f,  9.77028131e-01f,
+     5.40171504e-01f,  8.41554940e-01f, -8.41555059e-01f,  5.40171325e-01f,
+     8.21102500e-01f,  5.70780754e-01f, -5.70780754e-01f,  8.21102500e-01f,
+     1.77004203e-01f,  9.84210074e-01f, -9.84210074e-01f,  1.77004158e-01f,
+     9.93211925e-01f,  1.16318636e-01f, -1.16318651e-01f,  9.93211925e-01f,
+     6.20057166e-01f,  7.84556627e-01f, -7.84556687e-01f,  6.20057106e-01f,
+     8.73094976e-01f,  4.87550169e-01f, -4.87550318e-01f,  8.73094916e-01f,
+     2.72621274e-01f,  9.62121427e-01f, -9.62121427e-01f,  2.72621334e-01f,
+     9.51435030e-01f,  3.07849675e-01f, -3.07849735e-01f,  9.51434970e-01f,
+     4.55083579e-01f,  8.90448749e-01f, -8.90448809e-01f,  4.55083430e-01f,
+     7.61202335e-01f,  6.48514450e-01f, -6.48514390e-01f,  7.61202395e-01f,
+     7.96823800e-02f,  9.96820331e-01f, -9.96820331e-01f,  7.96823353e-02f,
+     9.97723043e-01f,  6.74439222e-02f, -6.74439147e-02f,  9.97723043e-01f,
+     6.57806695e-01f,  7.53186822e-01f, -7.53186762e-01f,  6.57806754e-01f,
+     8.95966232e-01f,  4.44122165e-01f, -4.44122165e-01f,  8.95966232e-01f,
+     3.19501966e-01f,  9.47585642e-01f, -9.47585642e-01f,  3.19501907e-01f,
+     9.65394437e-01f,  2.60794133e-01f, -2.60794193e-01f,  9.65394437e-01f,
+     4.98227656e-01f,  8.67046237e-01f, -8.67046237e-01f,  4.98227626e-01f,
+     7.92106569e-01f,  6.10382795e-01f, -6.10382915e-01f,  7.92106509e-01f,
+     1.28498077e-01f,  9.91709769e-01f, -9.91709769e-01f,  1.28497913e-01f,
+     9.86308098e-01f,  1.64913133e-01f, -1.64913163e-01f,  9.86308098e-01f,
+     5.80813944e-01f,  8.14036310e-01f, -8.14036310e-01f,  5.80813944e-01f,
+     8.48120332e-01f,  5.29803634e-01f, -5.29803693e-01f,  8.48120332e-01f,
+     2.25083917e-01f,  9.74339366e-01f, -9.74339426e-01f,  2.25083753e-01f,
+     9.35183525e-01f,  3.54163527e-01f, -3.54163527e-01f,  9.35183525e-01f,
+     4.10843134e-01f,  9.11706030e-01f, -9.11706090e-01f,  4.10843104e-01f,
+     7.28464365e-01f,  6.85083687e-01f, -6.85083807e-01f,  7.28464305e-01f,
+     3.06747276e-02f,  9.99529421e-01f, -9.99529421e-01f,  3.06748021e-02f,
+     9.99077737e-01f,  4.29382585e-02f, -4.29383032e-02f,  9.99077737e-01f,
+     6.76092684e-01f,  7.36816585e-01f, -7.36816645e-01f,  6.76092625e-01f,
+     9.06595707e-01f,  4.22000289e-01f, -4.22000229e-01f,  9.06595707e-01f,
+     3.42660725e-01f,  9.39459205e-01f, -9.39459264e-01f,  3.42660666e-01f,
+     9.71503913e-01f,  2.37023622e-01f, -2.37023607e-01f,  9.71503913e-01f,
+     5.19355953e-01f,  8.54557991e-01f, -8.54557991e-01f,  5.19356012e-01f,
+     8.06847572e-01f,  5.90759695e-01f, -5.90759754e-01f,  8.06847513e-01f,
+     1.52797103e-01f,  9.88257587e-01f, -9.88257587e-01f,  1.52797058e-01f,
+     9.90058184e-01f,  1.40658244e-01f, -1.40658319e-01f,  9.90058184e-01f,
+     6.00616455e-01f,  7.99537301e-01f, -7.99537361e-01f,  6.00616336e-01f,
+     8.60866904e-01f,  5.08830190e-01f, -5.08830130e-01f,  8.60866964e-01f,
+     2.48927563e-01f,  9.68522131e-01f, -9.68522131e-01f,  2.48927519e-01f,
+     9.43593442e-01f,  3.31106305e-01f, -3.31106365e-01f,  9.43593442e-01f,
+     4.33093756e-01f,  9.01348889e-01f, -9.01348829e-01f,  4.33093816e-01f,
+     7.45057762e-01f,  6.66999936e-01f, -6.66999996e-01f,  7.45057702e-01f,
+     5.51952384e-02f,  9.98475552e-01f, -9.98475611e-01f,  5.51950745e-02f,
+     9.95767415e-01f,  9.19089541e-02f, -9.19090211e-02f,  9.95767415e-01f,
+     6.39124393e-01f,  7.69103348e-01f, -7.69103348e-01f,  6.39124453e-01f,
+     8.84797096e-01f,  4.65976506e-01f, -4.65976596e-01f,  8.84797037e-01f,
+     2.96150863e-01f,  9.55141187e-01f, -9.55141246e-01f,  2.96150714e-01f,
+     9.58703458e-01f,  2.84407556e-01f, -2.84407556e-01f,  9.58703458e-01f,
+     4.76799160e-01f,  8.79012287e-01f, -8.79012287e-01f,  4.76799130e-01f,
+     7.76888430e-01f,  6.29638255e-01f, -6.29638195e-01f,  7.76888490e-01f,
+     1.04121648e-01f,  9.94564593e-01f, -9.94564593e-01f,  1.04121603e-01f,
+     9.81963873e-01f,  1.89068675e-01f, -1.89068764e-01f,  9.81963873e-01f,
+     5.60661554e-01f,  8.28045070e-01f, -8.28045070e-01f,  5.60661495e-01f,
+     8.34862828e-01f,  5.50458014e-01f, -5.50458074e-01f,  8.34862769e-01f,
+     2.01104566e-01f,  9.79569793e-01f, -9.79569793e-01f,  2.01104641e-01f,
+     9.26210225e-01f,  3.77007425e-01f, -3.77007484e-01f,  9.26210225e-01f,
+     3.88345063e-01f,  9.21514034e-01f, -9.21514094e-01f,  3.88344914e-01f,
+     7.11432219e-01f,  7.02754736e-01f, -7.02754736e-01f,  7.11432219e-01f,
+     6.13585813e-03f,  9.99981165e-01f, -9.99981165e-01f,  6.13581482e-03f,
+};
+
+const float fft_w4r_table[FFT_W4R_TABLE_SIZE] = {
+     1.00000000e+00f,  0.00000000e+00f,  9.99995291e-01f,  3.06795677e-03f,
+     9.99981165e-01f,  6.13588467e-03f,  9.99957621e-01f,  9.20375437e-03f,
+     9.99924719e-01f,  1.22715384e-02f,  9.99882340e-01f,  1.53392060e-02f,
+     9.99830604e-01f,  1.84067301e-02f,  9.99769390e-01f,  2.14740802e-02f,
+     9.99698818e-01f,  2.45412290e-02f,  9.99618828e-01f,  2.76081450e-02f,
+     9.99529421e-01f,  3.06748021e-02f,  9.99430597e-01f,  3.37411724e-02f,
+     9.99322355e-01f,  3.68072242e-02f,  9.99204755e-01f,  3.98729295e-02f,
+     9.99077737e-01f,  4.29382548e-02f,  9.98941302e-01f,  4.60031815e-02f,
+     9.98795450e-01f,  4.90676761e-02f,  9.98640239e-01f,  5.21317050e-02f,
+     9.98475552e-01f,  5.51952459e-02f,  9.98301566e-01f,  5.82582653e-02f,
+     9.98118103e-01f,  6.13207370e-02f,  9.97925282e-01f,  6.43826276e-02f,
+     9.97723043e-01f,  6.74439147e-02f,  9.97511446e-01f,  7.05045760e-02f,
+     9.97290432e-01f,  7.35645667e-02f,  9.97060061e-01f,  7.66238645e-02f,
+     9.96820271e-01f,  7.96824396e-02f,  9.96571124e-01f,  8.27402622e-02f,
+     9.96312618e-01f,  8.57973099e-02f,  9.96044695e-01f,  8.88535529e-02f,
+     9.95767415e-01f,  9.19089541e-02f,  9.95480776e-01f,  9.49634984e-02f,
+     9.95184720e-01f,  9.80171412e-02f,  9.94879305e-01f,  1.01069860e-01f,
+     9.94564593e-01f,  1.04121633e-01f,  9.94240463e-01f,  1.07172422e-01f,
+     9.93906975e-01f,  1.10222206e-01f,  9.93564129e-01f,  1.13270953e-01f,
+     9.93211925e-01f,  1.16318636e-01f,  9.92850423e-01f,  1.19365215e-01f,
+     9.92479563e-01f,  1.22410670e-01f,  9.92099285e-01f,  1.25454977e-01f,
+     9.91709769e-01f,  1.28498107e-01f,  9.91310835e-01f,  1.31540030e-01f,
+     9.90902662e-01f,  1.34580702e-01f,  9.90485072e-01f,  1.37620121e-01f,
+     9.90058184e-01f,  1.40658244e-01f,  9.89621997e-01f,  1.43695042e-01f,
+     9.89176512e-01f,  1.46730468e-01f,  9.88721669e-01f,  1.49764523e-01f,
+     9.88257587e-01f,  1.52797192e-01f,  9.87784147e-01f,  1.55828401e-01f,
+     9.87301409e-01f,  1.58858150e-01f,  9.86809373e-01f,  1.61886394e-01f,
+     9.86308098e-01f,  1.64913118e-01f,  9.85797524e-01f,  1.67938292e-01f,
+     9.85277653e-01f,  1.70961887e-01f,  9.84748483e-01f,  1.73983872e-01f,
+     9.84210074e-01f,  1.77004218e-01f,  9.83662426e-01f,  1.80022910e-01f,
+     9.83105481e-01f,  1.83039889e-01f,  9.82539296e-01f,  1.86055154e-01f,
+     9.81963873e-01f,  1.89068675e-01f,  9.81379211e-01f,  1.92080393e-01f,
+     9.80785251e-01f,  1.95090324e-01f,  9.80182111e-01f,  1.98098406e-01f,
+     9.79569793e-01f,  2.01104626e-01f,  9.78948176e-01f,  2.04108968e-01f,
+     9.78317380e-01f,  2.07111374e-01f,  9.77677345e-01f,  2.10111842e-01f,
+     9.77028131e-01f,  2.13110313e-01f,  9.76369739e-01f,  2.16106802e-01f,
+     9.75702107e-01f,  2.19101235e-01f,  9.75025356e-01f,  2.22093612e-01f,
+     9.74339366e-01f,  2.25083917e-01f,  9.73644257e-01f,  2.28072077e-01f,
+     9.72939968e-01f,  2.31058121e-01f,  9.72226501e-01f,  2.34041959e-01f,
+     9.71503913e-01f,  2.37023607e-01f,  9.70772147e-01f,  2.40003020e-01f,
+     9.70031261e-01f,  2.42980182e-01f,  9.69281256e-01f,  2.45955050e-01f,
+     9.68522072e-01f,  2.48927608e-01f,  9.67753828e-01f,  2.51897812e-01f,
+     9.66976464e-01f,  2.54865646e-01f,  9.66189981e-01f,  2.57831097e-01f,
+     9.65394437e-01f,  2.60794133e-01f,  9.64589775e-01f,  2.63754696e-01f,
+     9.63776052e-01f,  2.66712755e-01f,  9.62953269e-01f,  2.69668341e-01f,
+     9.62121427e-01f,  2.72621363e-01f,  9.61280465e-01f,  2.75571793e-01f,
+     9.60430503e-01f,  2.78519690e-01f,  9.59571540e-01f,  2.81464934e-01f,
+     9.58703458e-01f,  2.84407556e-01f,  9.57826436e-01f,  2.87347466e-01f,
+     9.56940353e-01f,  2.90284693e-01f,  9.56045270e-01f,  2.93219179e-01f,
+     9.55141187e-01f,  2.96150893e-01f,  9.54228103e-01f,  2.99079835e-01f,
+     9.53306019e-01f,  3.02005947e-01f,  9.52374995e-01f,  3.04929256e-01f,
+     9.51435030e-01f,  3.07849646e-01f,  9.50486064e-01f,  3.10767144e-01f,
+     9.49528158e-01f,  3.13681751e-01f,  9.48561370e-01f,  3.16593379e-01f,
+     9.47585583e-01f,  3.19502026e-01f,  9.46600914e-01f,  3.22407693e-01f,
+     9.45607305e-01f,  3.25310290e-01f,  9.44604814e-01f,  3.28209847e-01f,
+     9.43593442e-01f,  3.31106305e-01f,  9.42573190e-01f,  3.33999664e-01f,
+     9.41544056e-01f,  3.36889833e-01f,  9.40506041e-01f,  3.39776874e-01f,
+     9.39459205e-01f,  3.42660725e-01f,  9.38403547e-01f,  3.45541328e-01f,
+     9.37339008e-01f,  3.48418683e-01f,  9.36265647e-01f,  3.51292759e-01f,
+     9.35183525e-01f,  3.54163527e-01f,  9.34092581e-01f,  3.57030958e-01f,
+     9.32992816e-01f,  3.59895051e-01f,  9.31884289e-01f,  3.62755746e-01f,
+     9.30766940e-01f,  3.65612984e-01f,  9.29640889e-01f,  3.68466824e-01f,
+     9.28506076e-01f,  3.71317208e-01f,  9.27362502e-01f,  3.74164075e-01f,
+     9.26210225e-01f,  3.77007395e-01f,  9.25049245e-01f,  3.79847199e-01f,
+     9.23879504e-01f,  3.82683456e-01f,  9.22701120e-01f,  3.85516047e-01f,
+     9.21514034e-01f,  3.88345033e-01f,  9.20318246e-01f,  3.91170382e-01f,
+     9.19113874e-01f,  3.93992037e-01f,  9.17900801e-01f,  3.96809995e-01f,
+     9.16679084e-01f,  3.99624199e-01f,  9.15448725e-01f,  4.02434677e-01f,
+     9.14209783e-01f,  4.05241311e-01f,  9.12962198e-01f,  4.08044159e-01f,
+     9.11706030e-01f,  4.10843194e-01f,  9.10441279e-01f,  4.13638294e-01f,
+     9.09168005e-01f,  4.16429549e-01f,  9.07886088e-01f,  4.19216901e-01f,
+     9.06595707e-01f,  4.22000289e-01f,  9.05296743e-01f,  4.24779683e-01f,
+     9.03989315e-01f,  4.27555084e-01f,  9.02673304e-01f,  4.30326492e-01f,
+     9.01348829e-01f,  4.33093816e-01f,  9.00015891e-01f,  4.35857087e-01f,
+     8.98674488e-01f,  4.38616246e-01f,  8.97324562e-01f,  4.41371292e-01f,
+     8.95966232e-01f,  4.44122136e-01f,  8.94599497e-01f,  4.46868837e-01f,
+     8.93224299e-01f,  4.49611336e-01f,  8.91840696e-01f,  4.52349573e-01f,
+     8.90448749e-01f,  4.55083579e-01f,  8.89048338e-01f,  4.57813323e-01f,
+     8.87639642e-01f,  4.60538685e-01f,  8.86222541e-01f,  4.63259786e-01f,
+     8.84797096e-01f,  4.65976506e-01f,  8.83363307e-01f,  4.68688846e-01f,
+     8.81921291e-01f,  4.71396714e-01f,  8.80470872e-01f,  4.74100202e-01f,
+     8.79012227e-01f,  4.76799250e-01f,  8.77545297e-01f,  4.79493737e-01f,
+     8.76070082e-01f,  4.82183754e-01f,  8.74586642e-01f,  4.84869242e-01f,
+     8.73094976e-01f,  4.87550169e-01f,  8.71595085e-01f,  4.90226507e-01f,
+     8.70087028e-01f,  4.92898166e-01f,  8.68570745e-01f,  4.95565236e-01f,
+     8.67046237e-01f,  4.98227656e-01f,  8.65513623e-01f,  5.00885367e-01f,
+     8.63972843e-01f,  5.03538370e-01f,  8.62423956e-01f,  5.06186664e-01f,
+     8.60866904e-01f,  5.08830190e-01f,  8.59301805e-01f,  5.11468828e-01f,
+     8.57728601e-01f,  5.14102697e-01f,  8.56147349e-01f,  5.16731799e-01f,
+     8.54557991e-01f,  5.19356012e-01f,  8.52960587e-01f,  5.21975279e-01f,
+     8.51355195e-01f,  5.24589717e-01f,  8.49741757e-01f,  5.27199149e-01f,
+     8.48120332e-01f,  5.29803574e-01f,  8.46490920e-01f,  5.32403111e-01f,
+     8.44853580e-01f,  5.34997582e-01f,  8.43208253e-01f,  5.37587047e-01f,
+     8.41554999e-01f,  5.40171504e-01f,  8.39893758e-01f,  5.42750776e-01f,
+     8.38224709e-01f,  5.45324981e-01f,  8.36547732e-01f,  5.47894061e-01f,
+     8.34862888e-01f,  5.50457954e-01f,  8.33170176e-01f,  5.53016722e-01f,
+     8.31469595e-01f,  5.55570245e-01f,  8.29761207e-01f,  5.58118522e-01f,
+     8.28045011e-01f,  5.60661614e-01f,  8.26321065e-01f,  5.63199341e-01f,
+     8.24589312e-01f,  5.65731764e-01f,  8.22849810e-01f,  5.68258941e-01f,
+     8.21102500e-01f,  5.70780754e-01f,  8.19347501e-01f,  5.73297143e-01f,
+     8.17584813e-01f,  5.75808227e-01f,  8.15814376e-01f,  5.78313828e-01f,
+     8.14036310e-01f,  5.80814004e-01f,  8.12250614e-01f,  5.83308637e-01f,
+     8.10457230e-01f,  5.85797846e-01f,  8.08656156e-01f,  5.88281572e-01f,
+     8.06847572e-01f,  5.90759695e-01f,  8.05031300e-01f,  5.93232334e-01f,
+     8.03207517e-01f,  5.95699310e-01f,  8.01376164e-01f,  5.98160684e-01f,
+     7.99537301e-01f,  6.00616455e-01f,  7.97690868e-01f,  6.03066564e-01f,
+     7.95836926e-01f,  6.05511010e-01f,  7.93975472e-01f,  6.07949793e-01f,
+     7.92106569e-01f,  6.10382795e-01f,  7.90230215e-01f,  6.12810075e-01f,
+     7.88346469e-01f,  6.15231574e-01f,  7.86455214e-01f,  6.17647290e-01f,
+     7.84556627e-01f,  6.20057225e-01f,  7.82650590e-01f,  6.22461259e-01f,
+     7.80737221e-01f,  6.24859512e-01f,  7.78816521e-01f,  6.27251804e-01f,
+     7.76888430e-01f,  6.29638255e-01f,  7.74953127e-01f,  6.32018745e-01f,
+     7.73010492e-01f,  6.34393275e-01f,  7.71060526e-01f,  6.36761844e-01f,
+     7.69103348e-01f,  6.39124453e-01f,  7.67138898e-01f,  6.41481042e-01f,
+     7.65167236e-01f,  6.43831551e-01f,  7.63188422e-01f,  6.46176040e-01f,
+     7.61202395e-01f,  6.48514390e-01f,  7.59209216e-01f,  6.50846660e-01f,
+     7.57208824e-01f,  6.53172851e-01f,  7.55201399e-01f,  6.55492842e-01f,
+     7.53186822e-01f,  6.57806695e-01f,  7.51165092e-01f,  6.60114348e-01f,
+     7.49136388e-01f,  6.62415802e-01f,  7.47100651e-01f,  6.64710939e-01f,
+     7.45057821e-01f,  6.66999936e-01f,  7.43007958e-01f,  6.69282615e-01f,
+     7.40951121e-01f,  6.71558976e-01f,  7.38887310e-01f,  6.73829019e-01f,
+     7.36816585e-01f,  6.76092744e-01f,  7.34738886e-01f,  6.78350091e-01f,
+     7.32654274e-01f,  6.80601001e-01f,  7.30562806e-01f,  6.82845533e-01f,
+     7.28464365e-01f,  6.85083687e-01f,  7.26359129e-01f,  6.87315345e-01f,
+     7.24247098e-01f,  6.89540565e-01f,  7.22128153e-01f,  6.91759288e-01f,
+     7.20002472e-01f,  6.93971455e-01f,  7.17870057e-01f,  6.96177125e-01f,
+     7.15730846e-01f,  6.98376238e-01f,  7.13584900e-01f,  7.00568795e-01f,
+     7.11432219e-01f,  7.02754736e-01f,  7.09272802e-01f,  7.04934061e-01f,
+     7.07106769e-01f,  7.07106769e-01f,  7.04934120e-01f,  7.09272802e-01f,
+     7.02754736e-01f,  7.11432159e-01f,  7.00568795e-01f,  7.13584840e-01f,
+     6.98376238e-01f,  7.15730846e-01f,  6.96177125e-01f,  7.17870057e-01f,
+     6.93971455e-01f,  7.20002532e-01f,  6.91759229e-01f,  7.22128212e-01f,
+     6.89540565e-01f,  7.24247038e-01f,  6.87315345e-01f,  7.26359129e-01f,
+     6.85083687e-01f,  7.28464365e-01f,  6.82845533e-01f,  7.30562747e-01f,
+     6.80601001e-01f,  7.32654274e-01f,  6.78350031e-01f,  7.34738886e-01f,
+     6.76092684e-01f,  7.36816585e-01f,  6.73829019e-01f,  7.38887310e-01f,
+     6.71558976e-01f,  7.40951121e-01f,  6.69282615e-01f,  7.43007958e-01f,
+     6.66999936e-01f,  7.45057762e-01f,  6.64710999e-01f,  7.47100592e-01f,
+     6.62415743e-01f,  7.49136388e-01f,  6.60114348e-01f,  7.51165152e-01f,
+     6.57806695e-01f,  7.53186762e-01f,  6.55492842e-01f,  7.55201340e-01f,
+     6.53172851e-01f,  7.57208824e-01f,  6.50846660e-01f,  7.59209216e-01f,
+     6.48514390e-01f,  7.61202395e-01f,  6.46175981e-01f,  7.63188422e-01f,
+     6.43831551e-01f,  7.65167296e-01f,  6.41481042e-01f,  7.67138898e-01f,
+     6.39124453e-01f,  7.69103348e-01f,  6.36761844e-01f,  7.71060526e-01f,
+     6.34393275e-01f,  7.73010433e-01f,  6.32018745e-01f,  7.74953127e-01f,
+     6.29638255e-01f,  7.76888490e-01f,  6.27251804e-01f,  7.78816521e-01f,
+     6.24859512e-01f,  7.80737221e-01f,  6.22461319e-01f,  7.82650590e-01f,
+     6.20057225e-01f,  7.84556568e-01f,  6.17647290e-01f,  7.86455214e-01f,
+     6.15231574e-01f,  7.88346410e-01f,  6.12810075e-01f,  7.90230215e-01f,
+     6.10382795e-01f,  7.92106569e-01f,  6.07949793e-01f,  7.93975472e-01f,
+     6.05511069e-01f,  7.95836926e-01f,  6.03066623e-01f,  7.97690868e-01f,
+     6.00616455e-01f,  7.99537301e-01f,  5.98160684e-01f,  8.01376164e-01f,
+     5.95699310e-01f,  8.03207517e-01f,  5.93232334e-01f,  8.05031300e-01f,
+     5.90759695e-01f,  8.06847513e-01f,  5.88281572e-01f,  8.08656156e-01f,
+     5.85797846e-01f,  8.10457170e-01f,  5.83308637e-01f,  8.12250614e-01f,
+     5.80813944e-01f,  8.14036310e-01f,  5.78313768e-01f,  8.15814435e-01f,
+     5.75808227e-01f,  8.17584813e-01f,  5.73297203e-01f,  8.19347501e-01f,
+     5.70780754e-01f,  8.21102500e-01f,  5.68258941e-01f,  8.22849810e-01f,
+     5.65731823e-01f,  8.24589312e-01f,  5.63199341e-01f,  8.26321065e-01f,
+     5.60661554e-01f,  8.28045070e-01f,  5.58118522e-01f,  8.29761207e-01f,
+     5.55570245e-01f,  8.31469595e-01f,  5.53016722e-01f,  8.33170176e-01f,
+     5.50457954e-01f,  8.34862888e-01f,  5.47894061e-01f,  8.36547732e-01f,
+     5.45324981e-01f,  8.38224709e-01f,  5.42750776e-01f,  8.39893818e-01f,
+     5.40171504e-01f,  8.41554940e-01f,  5.37587106e-01f,  8.43208253e-01f,
+     5.34997642e-01f,  8.44853580e-01f,  5.32403111e-01f,  8.46490920e-01f,
+     5.29803634e-01f,  8.48120332e-01f,  5.27199090e-01f,  8.49741757e-01f,
+     5.24589658e-01f,  8.51355195e-01f,  5.21975279e-01f,  8.52960646e-01f,
+     5.19355953e-01f,  8.54557991e-01f,  5.16731739e-01f,  8.56147349e-01f,
+     5.14102817e-01f,  8.57728601e-01f,  5.11468887e-01f,  8.59301805e-01f,
+     5.08830190e-01f,  8.60866904e-01f,  5.06186664e-01f,  8.62423956e-01f,
+     5.03538430e-01f,  8.63972843e-01f,  5.00885367e-01f,  8.65513623e-01f,
+     4.98227656e-01f,  8.67046237e-01f,  4.95565265e-01f,  8.68570685e-01f,
+     4.92898166e-01f,  8.70086968e-01f,  4.90226477e-01f,  8.71595085e-01f,
+     4.87550139e-01f,  8.73094976e-01f,  4.84869212e-01f,  8.74586642e-01f,
+     4.82183725e-01f,  8.76070142e-01f,  4.79493707e-01f,  8.77545297e-01f,
+     4.76799279e-01f,  8.79012227e-01f,  4.74100262e-01f,  8.80470872e-01f,
+     4.71396774e-01f,  8.81921232e-01f,  4.68688846e-01f,  8.83363307e-01f,
+     4.65976506e-01f,  8.84797096e-01f,  4.63259786e-01f,  8.86222541e-01f,
+     4.60538715e-01f,  8.87639642e-01f,  4.57813293e-01f,  8.89048338e-01f,
+     4.55083579e-01f,  8.90448749e-01f,  4.52349573e-01f,  8.91840696e-01f,
+     4.49611306e-01f,  8.93224299e-01f,  4.46868807e-01f,  8.94599497e-01f,
+     4.44122106e-01f,  8.95966291e-01f,  4.41371202e-01f,  8.97324622e-01f,
+     4.38616276e-01f,  8.98674428e-01f,  4.35857117e-01f,  9.00015891e-01f,
+     4.33093846e-01f,  9.01348829e-01f,  4.30326492e-01f,  9.02673304e-01f,
+     4.27555114e-01f,  9.03989315e-01f,  4.24779683e-01f,  9.05296743e-01f,
+     4.22000259e-01f,  9.06595707e-01f,  4.19216871e-01f,  9.07886147e-01f,
+     4.16429549e-01f,  9.09168005e-01f,  4.13638294e-01f,  9.10441279e-01f,
+     4.10843134e-01f,  9.11706030e-01f,  4.08044130e-01f,  9.12962198e-01f,
+     4.05241281e-01f,  9.14209783e-01f,  4.02434707e-01f,  9.15448666e-01f,
+     3.99624258e-01f,  9.16679025e-01f,  3.96810025e-01f,  9.17900741e-01f,
+     3.93992066e-01f,  9.19113815e-01f,  3.91170412e-01f,  9.20318246e-01f,
+     3.88345063e-01f,  9.21514034e-01f,  3.85516047e-01f,  9.22701120e-01f,
+     3.82683426e-01f,  9.23879504e-01f,  3.79847199e-01f,  9.25049245e-01f,
+     3.77007395e-01f,  9.26210225e-01f,  3.74164045e-01f,  9.27362561e-01f,
+     3.71317148e-01f,  9.28506076e-01f,  3.68466794e-01f,  9.29640889e-01f,
+     3.65612954e-01f,  9.30767000e-01f,  3.62755775e-01f,  9.31884229e-01f,
+     3.59895080e-01f,  9.32992756e-01f,  3.57030988e-01f,  9.34092522e-01f,
+     3.54163557e-01f,  9.35183525e-01f,  3.51292789e-01f,  9.36265647e-01f,
+     3.48418683e-01f,  9.37339008e-01f,  3.45541328e-01f,  9.38403547e-01f,
+     3.42660725e-01f,  9.39459205e-01f,  3.39776874e-01f,  9.40506101e-01f,
+     3.36889833e-01f,  9.41544056e-01f,  3.33999634e-01f,  9.42573190e-01f,
+     3.31106275e-01f,  9.43593442e-01f,  3.28209788e-01f,  9.44604874e-01f,
+     3.25310230e-01f,  9.45607364e-01f,  3.22407722e-01f,  9.46600914e-01f,
+     3.19502085e-01f,  9.47585583e-01f,  3.16593409e-01f,  9.48561311e-01f,
+     3.13681781e-01f,  9.49528158e-01f,  3.10767174e-01f,  9.50486064e-01f,
+     3.07849646e-01f,  9.51435030e-01f,  3.04929227e-01f,  9.52374995e-01f,
+     3.02005947e-01f,  9.53306019e-01f,  2.99079806e-01f,  9.54228103e-01f,
+     2.96150863e-01f,  9.55141187e-01f,  2.93219119e-01f,  9.56045270e-01f,
+     2.90284634e-01f,  9.56940353e-01f,  2.87347406e-01f,  9.57826436e-01f,
+     2.84407586e-01f,  9.58703458e-01f,  2.81464994e-01f,  9.59571481e-01f,
+     2.78519720e-01f,  9.60430503e-01f,  2.75571853e-01f,  9.61280465e-01f,
+     2.72621393e-01f,  9.62121427e-01f,  2.69668341e-01f,  9.62953269e-01f,
+     2.66712755e-01f,  9.63776052e-01f,  2.63754666e-01f,  9.64589775e-01f,
+     2.60794103e-01f,  9.65394437e-01f,  2.57831097e-01f,  9.66189981e-01f,
+     2.54865646e-01f,  9.66976464e-01f,  2.51897782e-01f,  9.67753828e-01f,
+     2.48927563e-01f,  9.68522131e-01f,  2.45955005e-01f,  9.69281256e-01f,
+     2.42980242e-01f,  9.70031261e-01f,  2.40003064e-01f,  9.70772147e-01f,
+     2.37023652e-01f,  9.71503854e-01f,  2.34041989e-01f,  9.72226501e-01f,
+     2.31058136e-01f,  9.72939968e-01f,  2.28072092e-01f,  9.73644257e-01f,
+     2.25083917e-01f,  9.74339366e-01f,  2.22093612e-01f,  9.75025356e-01f,
+     2.19101235e-01f,  9.75702107e-01f,  2.16106772e-01f,  9.76369739e-01f,
+     2.13110298e-01f,  9.77028131e-01f,  2.10111797e-01f,  9.77677345e-01f,
+     2.07111329e-01f,  9.78317380e-01f,  2.04108909e-01f,  9.78948176e-01f,
+     2.01104686e-01f,  9.79569733e-01f,  1.98098451e-01f,  9.80182111e-01f,
+     1.95090353e-01f,  9.80785251e-01f,  1.92080423e-01f,  9.81379211e-01f,
+     1.89068690e-01f,  9.81963873e-01f,  1.86055169e-01f,  9.82539296e-01f,
+     1.83039889e-01f,  9.83105481e-01f,  1.80022895e-01f,  9.83662426e-01f,
+     1.77004203e-01f,  9.84210074e-01f,  1.73983842e-01f,  9.84748483e-01f,
+     1.70961857e-01f,  9.85277653e-01f,  1.67938247e-01f,  9.85797524e-01f,
+     1.64913073e-01f,  9.86308098e-01f,  1.61886334e-01f,  9.86809433e-01f,
+     1.58858195e-01f,  9.87301409e-01f,  1.55828446e-01f,  9.87784147e-01f,
+     1.52797222e-01f,  9.88257587e-01f,  1.49764553e-01f,  9.88721669e-01f,
+     1.46730497e-01f,  9.89176512e-01f,  1.43695042e-01f,  9.89621997e-01f,
+     1.40658244e-01f,  9.90058184e-01f,  1.37620106e-01f,  9.90485072e-01f,
+     1.34580687e-01f,  9.90902662e-01f,  1.31540000e-01f,  9.91310835e-01f,
+     1.28498077e-01f,  9.91709769e-01f,  1.25454932e-01f,  9.92099345e-01f,
+     1.22410625e-01f,  9.92479563e-01f,  1.19365275e-01f,  9.92850423e-01f,
+     1.16318680e-01f,  9.93211925e-01f,  1.13270991e-01f,  9.93564129e-01f,
+     1.10222235e-01f,  9.93906975e-01f,  1.07172444e-01f,  9.94240463e-01f,
+     1.04121648e-01f,  9.94564593e-01f,  1.01069868e-01f,  9.94879305e-01f,
+     9.80171338e-02f,  9.95184720e-01f,  9.49634835e-02f,  9.95480776e-01f,
+     9.19089392e-02f,  9.95767415e-01f,  8.88535231e-02f,  9.96044695e-01f,
+     8.57972726e-02f,  9.96312618e-01f,  8.27402174e-02f,  9.96571124e-01f,
+     7.96823800e-02f,  9.96820331e-01f,  7.66239166e-02f,  9.97060061e-01f,
+     7.35646114e-02f,  9.97290432e-01f,  7.05046132e-02f,  9.97511446e-01f,
+     6.74439445e-02f,  9.97723043e-01f,  6.43826500e-02f,  9.97925282e-01f,
+     6.13207482e-02f,  9.98118103e-01f,  5.82582653e-02f,  9.98301566e-01f,
+     5.51952384e-02f,  9.98475552e-01f,  5.21316901e-02f,  9.98640239e-01f,
+     4.90676500e-02f,  9.98795450e-01f,  4.60031480e-02f,  9.98941302e-01f,
+     4.29382175e-02f,  9.99077737e-01f,  3.98728773e-02f,  9.99204755e-01f,
+     3.68071645e-02f,  9.99322414e-01f,  3.37412246e-02f,  9.99430597e-01f,
+     3.06748468e-02f,  9.99529421e-01f,  2.76081804e-02f,  9.99618828e-01f,
+     2.45412551e-02f,  9.99698818e-01f,  2.14740969e-02f,  9.99769390e-01f,
+     1.84067376e-02f,  9.99830604e-01f,  1.53392060e-02f,  9.99882340e-01f,
+     1.22715291e-02f,  9.99924719e-01f,  9.20373760e-03f,  9.99957621e-01f,
+     6.13585813e-03f,  9.99981165e-01f,  3.06792185e-03f,  9.99995291e-01f,
+    -4.37113883e-08f,  1.00000000e+00f, -3.06800916e-03f,  9.99995291e-01f,
+    -6.13582646e-03f,  9.99981165e-01f, -9.20370501e-03f,  9.99957621e-01f,
+    -1.22714974e-02f,  9.99924719e-01f, -1.53391743e-02f,  9.99882340e-01f,
+    -1.84067059e-02f,  9.99830604e-01f, -2.14740653e-02f,  9.99769390e-01f,
+    -2.45412234e-02f,  9.99698818e-01f, -2.76081488e-02f,  9.99618828e-01f,
+    -3.06748152e-02f,  9.99529421e-01f, -3.37411910e-02f,  9.99430597e-01f,
+    -3.68072502e-02f,  9.99322355e-01f, -3.98729667e-02f,  9.99204755e-01f,
+    -4.29383032e-02f,  9.99077737e-01f, -4.60032374e-02f,  9.98941302e-01f,
+    -4.90676202e-02f,  9.98795450e-01f, -5.21316566e-02f,  9.98640239e-01f,
+    -5.51952049e-02f,  9.98475611e-01f, -5.82582355e-02f,  9.98301566e-01f,
+    -6.13207147e-02f,  9.98118103e-01f, -6.43826202e-02f,  9.97925282e-01f,
+    -6.74439147e-02f,  9.97723043e-01f, -7.05045760e-02f,  9.97511446e-01f,
+    -7.35645741e-02f,  9.97290432e-01f, -7.66238868e-02f,  9.97060061e-01f,
+    -7.96824694e-02f,  9.96820271e-01f, -8.27403069e-02f,  9.96571124e-01f,
+    -8.57973620e-02f,  9.96312618e-01f, -8.88536125e-02f,  9.96044695e-01f,
+    -9.19089019e-02f,  9.95767415e-01f, -9.49634537e-02f,  9.95480776e-01f,
+    -9.80171040e-02f,  9.95184720e-01f, -1.01069838e-01f,  9.94879305e-01f,
+    -1.04121618e-01f,  9.94564593e-01f, -1.07172415e-01f,  9.94240463e-01f,
+    -1.10222206e-01f,  9.93906975e-01f, -1.13270961e-01f,  9.93564129e-01f,
+    -1.16318651e-01f,  9.93211925e-01f, -1.19365238e-01f,  9.92850423e-01f,
+    -1.22410707e-01f,  9.92479503e-01f, -1.25455022e-01f,  9.92099285e-01f,
+    -1.28498167e-01f,  9.91709769e-01f, -1.31539971e-01f,  9.91310894e-01f,
+    -1.34580657e-01f,  9.90902662e-01f, -1.37620077e-01f,  9.90485072e-01f,
+    -1.40658200e-01f,  9.90058243e-01f, -1.43695012e-01f,  9.89621997e-01f,
+    -1.46730453e-01f,  9.89176512e-01f, -1.49764523e-01f,  9.88721669e-01f,
+    -1.52797192e-01f,  9.88257587e-01f, -1.55828401e-01f,  9.87784147e-01f,
+    -1.58858165e-01f,  9.87301409e-01f, -1.61886424e-01f,  9.86809373e-01f,
+    -1.64913163e-01f,  9.86308098e-01f, -1.67938337e-01f,  9.85797524e-01f,
+    -1.70961946e-01f,  9.85277653e-01f, -1.73983812e-01f,  9.84748483e-01f,
+    -1.77004173e-01f,  9.84210074e-01f, -1.80022866e-01f,  9.83662426e-01f,
+    -1.83039859e-01f,  9.83105481e-01f, -1.86055124e-01f,  9.82539296e-01f,
+    -1.89068645e-01f,  9.81963873e-01f, -1.92080393e-01f,  9.81379211e-01f,
+    -1.95090324e-01f,  9.80785251e-01f, -1.98098421e-01f,  9.80182111e-01f,
+    -2.01104656e-01f,  9.79569733e-01f, -2.04108998e-01f,  9.78948176e-01f,
+    -2.07111418e-01f,  9.78317380e-01f, -2.10111886e-01f,  9.77677345e-01f,
+    -2.13110372e-01f,  9.77028131e-01f, -2.16106743e-01f,  9.76369739e-01f,
+    -2.19101191e-01f,  9.75702167e-01f, -2.22093582e-01f,  9.75025356e-01f,
+    -2.25083888e-01f,  9.74339366e-01f, -2.28072062e-01f,  9.73644257e-01f,
+    -2.31058106e-01f,  9.72939968e-01f, -2.34041959e-01f,  9.72226501e-01f,
+    -2.37023607e-01f,  9.71503913e-01f, -2.40003034e-01f,  9.70772147e-01f,
+    -2.42980197e-01f,  9.70031261e-01f, -2.45955080e-01f,  9.69281256e-01f,
+    -2.48927653e-01f,  9.68522072e-01f, -2.51897871e-01f,  9.67753828e-01f,
+    -2.54865706e-01f,  9.66976464e-01f, -2.57831067e-01f,  9.66190040e-01f,
+    -2.60794073e-01f,  9.65394437e-01f, -2.63754636e-01f,  9.64589775e-01f,
+    -2.66712725e-01f,  9.63776052e-01f, -2.69668311e-01f,  9.62953269e-01f,
+    -2.72621363e-01f,  9.62121427e-01f, -2.75571823e-01f,  9.61280465e-01f,
+    -2.78519690e-01f,  9.60430503e-01f, -2.81464964e-01f,  9.59571481e-01f,
+    -2.84407556e-01f,  9.58703458e-01f, -2.87347496e-01f,  9.57826376e-01f,
+    -2.90284723e-01f,  9.56940293e-01f, -2.93219209e-01f,  9.56045210e-01f,
+    -2.96150833e-01f,  9.55141187e-01f, -2.99079776e-01f,  9.54228103e-01f,
+    -3.02005917e-01f,  9.53306079e-01f, -3.04929197e-01f,  9.52374995e-01f,
+    -3.07849616e-01f,  9.51435030e-01f, -3.10767144e-01f,  9.50486064e-01f,
+    -3.13681722e-01f,  9.49528158e-01f, -3.16593379e-01f,  9.48561370e-01f,
+    -3.19502056e-01f,  9.47585583e-01f, -3.22407693e-01f,  9.46600914e-01f,
+    -3.25310320e-01f,  9.45607305e-01f, -3.28209877e-01f,  9.44604814e-01f,
+    -3.31106365e-01f,  9.43593442e-01f, -3.33999693e-01f,  9.42573190e-01f,
+    -3.36889803e-01f,  9.41544056e-01f, -3.39776844e-01f,  9.40506101e-01f,
+    -3.42660695e-01f,  9.39459264e-01f, -3.45541298e-01f,  9.38403547e-01f,
+    -3.48418653e-01f,  9.37339008e-01f, -3.51292759e-01f,  9.36265647e-01f,
+    -3.54163527e-01f,  9.35183525e-01f, -3.57030958e-01f,  9.34092522e-01f,
+    -3.59895051e-01f,  9.32992816e-01f, -3.62755746e-01f,  9.31884229e-01f,
+    -3.65613043e-01f,  9.30766940e-01f, -3.68466854e-01f,  9.29640889e-01f,
+    -3.71317238e-01f,  9.28506076e-01f, -3.74164104e-01f,  9.27362502e-01f,
+    -3.77007365e-01f,  9.26210284e-01f, -3.79847169e-01f,  9.25049245e-01f,
+    -3.82683396e-01f,  9.23879564e-01f, -3.85516018e-01f,  9.22701120e-01f,
+    -3.88345033e-01f,  9.21514034e-01f, -3.91170382e-01f,  9.20318305e-01f,
+    -3.93992037e-01f,  9.19113874e-01f, -3.96809995e-01f,  9.17900801e-01f,
+    -3.99624228e-01f,  9.16679025e-01f, -4.02434677e-01f,  9.15448725e-01f,
+    -4.05241340e-01f,  9.14209723e-01f, -4.08044189e-01f,  9.12962198e-01f,
+    -4.10843223e-01f,  9.11706030e-01f, -4.13638264e-01f,  9.10441339e-01f,
+    -4.16429520e-01f,  9.09168005e-01f, -4.19216841e-01f,  9.07886147e-01f,
+    -4.22000229e-01f,  9.06595707e-01f, -4.24779654e-01f,  9.05296743e-01f,
+    -4.27555084e-01f,  9.03989315e-01f, -4.30326462e-01f,  9.02673304e-01f,
+    -4.33093816e-01f,  9.01348829e-01f, -4.35857087e-01f,  9.00015891e-01f,
+    -4.38616246e-01f,  8.98674428e-01f, -4.41371292e-01f,  8.97324562e-01f,
+    -4.44122165e-01f,  8.95966232e-01f, -4.46868867e-01f,  8.94599438e-01f,
+    -4.49611366e-01f,  8.93224299e-01f, -4.52349633e-01f,  8.91840696e-01f,
+    -4.55083638e-01f,  8.90448689e-01f, -4.57813382e-01f,  8.89048338e-01f,
+    -4.60538775e-01f,  8.87639582e-01f, -4.63259876e-01f,  8.86222482e-01f,
+    -4.65976596e-01f,  8.84797037e-01f, -4.68688935e-01f,  8.83363307e-01f,
+    -4.71396625e-01f,  8.81921291e-01f, -4.74100113e-01f,  8.80470932e-01f,
+    -4.76799130e-01f,  8.79012287e-01f, -4.79493678e-01f,  8.77545357e-01f,
+    -4.82183695e-01f,  8.76070142e-01f, -4.84869182e-01f,  8.74586701e-01f,
+    -4.87550110e-01f,  8.73095036e-01f, -4.90226448e-01f,  8.71595085e-01f,
+    -4.92898166e-01f,  8.70087028e-01f, -4.95565236e-01f,  8.68570745e-01f,
+    -4.98227656e-01f,  8.67046237e-01f, -5.00885367e-01f,  8.65513623e-01f,
+    -5.03538370e-01f,  8.63972843e-01f, -5.06186664e-01f,  8.62423956e-01f,
+    -5.08830130e-01f,  8.60866964e-01f, -5.11468887e-01f,  8.59301805e-01f,
+    -5.14102757e-01f,  8.57728601e-01f, -5.16731799e-01f,  8.56147289e-01f,
+    -5.19356012e-01f,  8.54557991e-01f, -5.21975338e-01f,  8.52960587e-01f,
+    -5.24589717e-01f,  8.51355135e-01f, -5.27199209e-01f,  8.49741757e-01f,
+    -5.29803693e-01f,  8.48120332e-01f, -5.32403171e-01f,  8.46490920e-01f,
+    -5.34997702e-01f,  8.44853520e-01f, -5.37587166e-01f,  8.43208194e-01f,
+    -5.40171564e-01f,  8.41554940e-01f, -5.42750657e-01f,  8.39893878e-01f,
+    -5.45324922e-01f,  8.38224769e-01f, -5.47894001e-01f,  8.36547792e-01f,
+    -5.50457895e-01f,  8.34862947e-01f, -5.53016663e-01f,  8.33170235e-01f,
+    -5.55570185e-01f,  8.31469655e-01f, -5.58118463e-01f,  8.29761267e-01f,
+    -5.60661554e-01f,  8.28045070e-01f, -5.63199282e-01f,  8.26321065e-01f,
+    -5.65731764e-01f,  8.24589312e-01f, -5.68258941e-01f,  8.22849810e-01f,
+    -5.70780754e-01f,  8.21102500e-01f, -5.73297143e-01f,  8.19347501e-01f,
+    -5.75808167e-01f,  8.17584813e-01f, -5.78313828e-01f,  8.15814435e-01f,
+    -5.80813944e-01f,  8.14036310e-01f, -5.83308697e-01f,  8.12250555e-01f,
+    -5.85797906e-01f,  8.10457170e-01f, -5.88281572e-01f,  8.08656156e-01f,
+    -5.90759754e-01f,  8.06847513e-01f, -5.93232334e-01f,  8.05031300e-01f,
+    -5.95699370e-01f,  8.03207517e-01f, -5.98160744e-01f,  8.01376104e-01f,
+    -6.00616574e-01f,  7.99537241e-01f, -6.03066683e-01f,  7.97690809e-01f,
+    -6.05511129e-01f,  7.95836866e-01f, -6.07949853e-01f,  7.93975413e-01f,
+    -6.10382915e-01f,  7.92106509e-01f, -6.12810016e-01f,  7.90230274e-01f,
+    -6.15231514e-01f,  7.88346469e-01f, -6.17647231e-01f,  7.86455274e-01f,
+    -6.20057166e-01f,  7.84556627e-01f, -6.22461200e-01f,  7.82650650e-01f,
+    -6.24859452e-01f,  7.80737281e-01f, -6.27251744e-01f,  7.78816521e-01f,
+    -6.29638195e-01f,  7.76888490e-01f, -6.32018685e-01f,  7.74953127e-01f,
+    -6.34393275e-01f,  7.73010492e-01f, -6.36761844e-01f,  7.71060526e-01f,
+    -6.39124453e-01f,  7.69103348e-01f, -6.41480982e-01f,  7.67138898e-01f,
+    -6.43831551e-01f,  7.65167236e-01f, -6.46176040e-01f,  7.63188422e-01f,
+    -6.48514390e-01f,  7.61202395e-01f, -6.50846720e-01f,  7.59209156e-01f,
+    -6.53172851e-01f,  7.57208824e-01f, -6.55492902e-01f,  7.55201340e-01f,
+    -6.57806754e-01f,  7.53186762e-01f, -6.60114408e-01f,  7.51165092e-01f,
+    -6.62415862e-01f,  7.49136329e-01f, -6.64711058e-01f,  7.47100532e-01f,
+    -6.66999996e-01f,  7.45057702e-01f, -6.69282675e-01f,  7.43007898e-01f,
+    -6.71559036e-01f,  7.40951061e-01f, -6.73829079e-01f,  7.38887250e-01f,
+    -6.76092625e-01f,  7.36816645e-01f, -6.78349972e-01f,  7.34738946e-01f,
+    -6.80600941e-01f,  7.32654333e-01f, -6.82845473e-01f,  7.30562806e-01f,
+    -6.85083628e-01f,  7.28464425e-01f, -6.87315285e-01f,  7.26359189e-01f,
+    -6.89540505e-01f,  7.24247098e-01f, -6.91759229e-01f,  7.22128212e-01f,
+    -6.93971455e-01f,  7.20002532e-01f, -6.96177125e-01f,  7.17870057e-01f,
+    -6.98376238e-01f,  7.15730846e-01f, -7.00568795e-01f,  7.13584900e-01f,
+    -7.02754736e-01f,  7.11432219e-01f, -7.04934061e-01f,  7.09272802e-01f,
+    -7.07106769e-01f,  7.07106769e-01f, -7.09272861e-01f,  7.04934061e-01f,
+    -7.11432219e-01f,  7.02754736e-01f, -7.13584900e-01f,  7.00568795e-01f,
+    -7.15730846e-01f,  6.98376238e-01f, -7.17870057e-01f,  6.96177125e-01f,
+    -7.20002532e-01f,  6.93971395e-01f, -7.22128212e-01f,  6.91759229e-01f,
+    -7.24247158e-01f,  6.89540505e-01f, -7.26359189e-01f,  6.87315285e-01f,
+    -7.28464425e-01f,  6.85083628e-01f, -7.30562866e-01f,  6.82845473e-01f,
+    -7.32654333e-01f,  6.80600941e-01f, -7.34738946e-01f,  6.78349972e-01f,
+    -7.36816466e-01f,  6.76092803e-01f, -7.38887250e-01f,  6.73829079e-01f,
+    -7.40951061e-01f,  6.71559036e-01f, -7.43007898e-01f,  6.69282675e-01f,
+    -7.45057762e-01f,  6.66999996e-01f, -7.47100532e-01f,  6.64711058e-01f,
+    -7.49136329e-01f,  6.62415802e-01f, -7.51165092e-01f,  6.60114408e-01f,
+    -7.53186762e-01f,  6.57806754e-01f, -7.55201340e-01f,  6.55492902e-01f,
+    -7.57208824e-01f,  6.53172851e-01f, -7.59209156e-01f,  6.50846720e-01f,
+    -7.61202395e-01f,  6.48514390e-01f, -7.63188422e-01f,  6.46176040e-01f,
+    -7.65167296e-01f,  6.43831551e-01f, -7.67138898e-01f,  6.41480982e-01f,
+    -7.69103348e-01f,  6.39124453e-01f, -7.71060526e-01f,  6.36761844e-01f,
+    -7.73010492e-01f,  6.34393275e-01f, -7.74953127e-01f,  6.32018685e-01f,
+    -7.76888490e-01f,  6.29638195e-01f, -7.78816581e-01f,  6.27251744e-01f,
+    -7.80737281e-01f,  6.24859452e-01f, -7.82650650e-01f,  6.22461200e-01f,
+    -7.84556687e-01f,  6.20057106e-01f, -7.86455274e-01f,  6.17647231e-01f,
+    -7.88346469e-01f,  6.15231514e-01f, -7.90230155e-01f,  6.12810194e-01f,
+    -7.92106509e-01f,  6.10382915e-01f, -7.93975413e-01f,  6.07949853e-01f,
+    -7.95836866e-01f,  6.05511129e-01f, -7.97690809e-01f,  6.03066683e-01f,
+    -7.99537241e-01f,  6.00616515e-01f, -8.01376164e-01f,  5.98160744e-01f,
+    -8.03207517e-01f,  5.95699370e-01f, -8.05031300e-01f,  5.93232334e-01f,
+    -8.06847513e-01f,  5.90759754e-01f, -8.08656156e-01f,  5.88281572e-01f,
+    -8.10457170e-01f,  5.85797846e-01f, -8.12250555e-01f,  5.83308637e-01f,
+    -8.14036310e-01f,  5.80813944e-01f, -8.15814435e-01f,  5.78313768e-01f,
+    -8.17584813e-01f,  5.75808167e-01f, -8.19347560e-01f,  5.73297143e-01f,
+    -8.21102560e-01f,  5.70780694e-01f, -8.22849810e-01f,  5.68258941e-01f,
+    -8.24589312e-01f,  5.65731764e-01f, -8.26321125e-01f,  5.63199282e-01f,
+    -8.28045070e-01f,  5.60661495e-01f, -8.29761267e-01f,  5.58118463e-01f,
+    -8.31469655e-01f,  5.55570185e-01f, -8.33170235e-01f,  5.53016603e-01f,
+    -8.34862947e-01f,  5.50457895e-01f, -8.36547792e-01f,  5.47893941e-01f,
+    -8.38224649e-01f,  5.45325100e-01f, -8.39893758e-01f,  5.42750895e-01f,
+    -8.41554940e-01f,  5.40171564e-01f, -8.43208194e-01f,  5.37587166e-01f,
+    -8.44853520e-01f,  5.34997702e-01f, -8.46490920e-01f,  5.32403171e-01f,
+    -8.48120332e-01f,  5.29803693e-01f, -8.49741757e-01f,  5.27199209e-01f,
+    -8.51355195e-01f,  5.24589717e-01f, -8.52960587e-01f,  5.21975338e-01f,
+    -8.54557991e-01f,  5.19356012e-01f, -8.56147289e-01f,  5.16731799e-01f,
+    -8.57728601e-01f,  5.14102757e-01f, -8.59301805e-01f,  5.11468828e-01f,
+    -8.60866964e-01f,  5.08830130e-01f, -8.62423956e-01f,  5.06186604e-01f,
+    -8.63972843e-01f,  5.03538370e-01f, -8.65513623e-01f,  5.00885367e-01f,
+    -8.67046237e-01f,  4.98227626e-01f, -8.68570745e-01f,  4.95565206e-01f,
+    -8.70087028e-01f,  4.92898136e-01f, -8.71595144e-01f,  4.90226418e-01f,
+    -8.73095036e-01f,  4.87550080e-01f, -8.74586701e-01f,  4.84869182e-01f,
+    -8.76070142e-01f,  4.82183695e-01f, -8.77545357e-01f,  4.79493678e-01f,
+    -8.79012287e-01f,  4.76799130e-01f, -8.80470932e-01f,  4.74100113e-01f,
+    -8.81921232e-01f,  4.71396834e-01f, -8.83363307e-01f,  4.68688905e-01f,
+    -8.84797037e-01f,  4.65976566e-01f, -8.86222482e-01f,  4.63259846e-01f,
+    -8.87639582e-01f,  4.60538775e-01f, -8.89048338e-01f,  4.57813352e-01f,
+    -8.90448689e-01f,  4.55083638e-01f, -8.91840696e-01f,  4.52349633e-01f,
+    -8.93224299e-01f,  4.49611366e-01f, -8.94599497e-01f,  4.46868867e-01f,
+    -8.95966232e-01f,  4.44122165e-01f, -8.97324562e-01f,  4.41371292e-01f,
+    -8.98674488e-01f,  4.38616246e-01f, -9.00015891e-01f,  4.35857087e-01f,
+    -9.01348829e-01f,  4.33093816e-01f, -9.02673304e-01f,  4.30326462e-01f,
+    -9.03989315e-01f,  4.27555054e-01f, -9.05296803e-01f,  4.24779654e-01f,
+    -9.06595707e-01f,  4.22000229e-01f, -9.07886147e-01f,  4.19216841e-01f,
+    -9.09168005e-01f,  4.16429490e-01f, -9.10441339e-01f,  4.13638234e-01f,
+    -9.11706090e-01f,  4.10843104e-01f, -9.12962198e-01f,  4.08044070e-01f,
+    -9.14209783e-01f,  4.05241221e-01f, -9.15448785e-01f,  4.02434558e-01f,
+    -9.16679084e-01f,  3.99624109e-01f, -9.17900741e-01f,  3.96810085e-01f,
+    -9.19113815e-01f,  3.93992126e-01f, -9.20318246e-01f,  3.91170472e-01f,
+    -9.21513975e-01f,  3.88345122e-01f, -9.22701120e-01f,  3.85516137e-01f,
+    -9.23879504e-01f,  3.82683486e-01f, -9.25049245e-01f,  3.79847258e-01f,
+    -9.26210225e-01f,  3.77007455e-01f, -9.27362502e-01f,  3.74164104e-01f,
+    -9.28506076e-01f,  3.71317238e-01f, -9.29640889e-01f,  3.68466854e-01f,
+    -9.30766940e-01f,  3.65613014e-01f, -9.31884289e-01f,  3.62755746e-01f,
+    -9.32992816e-01f,  3.59895051e-01f, -9.34092581e-01f,  3.57030958e-01f,
+    -9.35183525e-01f,  3.54163527e-01f, -9.36265647e-01f,  3.51292729e-01f,
+    -9.37339008e-01f,  3.48418653e-01f, -9.38403547e-01f,  3.45541298e-01f,
+    -9.39459264e-01f,  3.42660666e-01f, -9.40506101e-01f,  3.39776844e-01f,
+    -9.41544116e-01f,  3.36889803e-01f, -9.42573249e-01f,  3.33999574e-01f,
+    -9.43593502e-01f,  3.31106216e-01f, -9.44604874e-01f,  3.28209758e-01f,
+    -9.45607364e-01f,  3.25310200e-01f, -9.46600974e-01f,  3.22407573e-01f,
+    -9.47585642e-01f,  3.19501907e-01f, -9.48561311e-01f,  3.16593468e-01f,
+    -9.49528158e-01f,  3.13681841e-01f, -9.50486064e-01f,  3.10767233e-01f,
+    -9.51434970e-01f,  3.07849735e-01f, -9.52374995e-01f,  3.04929316e-01f,
+    -9.53306019e-01f,  3.02006006e-01f, -9.54228103e-01f,  2.99079895e-01f,
+    -9.55141127e-01f,  2.96150923e-01f, -9.56045210e-01f,  2.93219209e-01f,
+    -9.56940353e-01f,  2.90284723e-01f, -9.57826436e-01f,  2.87347496e-01f,
+    -9.58703458e-01f,  2.84407556e-01f, -9.59571540e-01f,  2.81464934e-01f,
+    -9.60430503e-01f,  2.78519690e-01f, -9.61280465e-01f,  2.75571823e-01f,
+    -9.62121427e-01f,  2.72621334e-01f, -9.62953269e-01f,  2.69668311e-01f,
+    -9.63776052e-01f,  2.66712725e-01f, -9.64589834e-01f,  2.63754636e-01f,
+    -9.65394437e-01f,  2.60794073e-01f, -9.66190040e-01f,  2.57831037e-01f,
+    -9.66976464e-01f,  2.54865587e-01f, -9.67753887e-01f,  2.51897752e-01f,
+    -9.68522131e-01f,  2.48927519e-01f, -9.69281256e-01f,  2.45954961e-01f,
+    -9.70031261e-01f,  2.42980078e-01f, -9.70772147e-01f,  2.40002915e-01f,
+    -9.71503854e-01f,  2.37023711e-01f, -9.72226501e-01f,  2.34042063e-01f,
+    -9.72939909e-01f,  2.31058210e-01f, -9.73644257e-01f,  2.28072166e-01f,
+    -9.74339366e-01f,  2.25083992e-01f, -9.75025356e-01f,  2.22093686e-01f,
+    -9.75702107e-01f,  2.19101295e-01f, -9.76369739e-01f,  2.16106847e-01f,
+    -9.77028131e-01f,  2.13110358e-01f, -9.77677345e-01f,  2.10111871e-01f,
+    -9.78317380e-01f,  2.07111403e-01f, -9.78948176e-01f,  2.04108983e-01f,
+    -9.79569793e-01f,  2.01104641e-01f, -9.80182111e-01f,  1.98098406e-01f,
+    -9.80785310e-01f,  1.95090309e-01f, -9.81379211e-01f,  1.92080379e-01f,
+    -9.81963873e-01f,  1.89068645e-01f, -9.82539296e-01f,  1.86055124e-01f,
+    -9.83105481e-01f,  1.83039844e-01f, -9.83662426e-01f,  1.80022851e-01f,
+    -9.84210074e-01f,  1.77004158e-01f, -9.84748542e-01f,  1.73983812e-01f,
+    -9.85277653e-01f,  1.70961812e-01f, -9.85797524e-01f,  1.67938218e-01f,
+    -9.86308098e-01f,  1.64913028e-01f, -9.86809433e-01f,  1.61886290e-01f,
+    -9.87301409e-01f,  1.58858031e-01f, -9.87784147e-01f,  1.55828521e-01f,
+    -9.88257527e-01f,  1.52797297e-01f, -9.88721669e-01f,  1.49764627e-01f,
+    -9.89176512e-01f,  1.46730572e-01f, -9.89621997e-01f,  1.43695116e-01f,
+    -9.90058184e-01f,  1.40658319e-01f, -9.90485072e-01f,  1.37620181e-01f,
+    -9.90902603e-01f,  1.34580761e-01f, -9.91310835e-01f,  1.31540075e-01f,
+    -9.91709769e-01f,  1.28498152e-01f, -9.92099285e-01f,  1.25455007e-01f,
+    -9.92479503e-01f,  1.22410700e-01f, -9.92850423e-01f,  1.19365230e-01f,
+    -9.93211925e-01f,  1.16318636e-01f, -9.93564129e-01f,  1.13270946e-01f,
+    -9.93906975e-01f,  1.10222198e-01f, -9.94240463e-01f,  1.07172407e-01f,
+    -9.94564593e-01f,  1.04121603e-01f, -9.94879305e-01f,  1.01069823e-01f,
+    -9.95184720e-01f,  9.80170965e-02f, -9.95480776e-01f,  9.49634388e-02f,
+    -9.95767415e-01f,  9.19088945e-02f, -9.96044695e-01f,  8.88534784e-02f,
+    -9.96312618e-01f,  8.57972279e-02f, -9.96571124e-01f,  8.27401727e-02f,
+    -9.96820331e-01f,  7.96823353e-02f, -9.97060061e-01f,  7.66237527e-02f,
+    -9.97290492e-01f,  7.35644475e-02f, -9.97511446e-01f,  7.05046877e-02f,
+    -9.97723043e-01f,  6.74440265e-02f, -9.97925282e-01f,  6.43827245e-02f,
+    -9.98118103e-01f,  6.13208227e-02f, -9.98301566e-01f,  5.82583435e-02f,
+    -9.98475552e-01f,  5.51953129e-02f, -9.98640239e-01f,  5.21317646e-02f,
+    -9.98795450e-01f,  4.90677245e-02f, -9.98941302e-01f,  4.60032262e-02f,
+    -9.99077737e-01f,  4.29382920e-02f, -9.99204755e-01f,  3.98729518e-02f,
+    -9.99322355e-01f,  3.68072391e-02f, -9.99430597e-01f,  3.37411799e-02f,
+    -9.99529421e-01f,  3.06748021e-02f, -9.99618828e-01f,  2.76081376e-02f,
+    -9.99698818e-01f,  2.45412104e-02f, -9.99769390e-01f,  2.14740541e-02f,
+    -9.99830604e-01f,  1.84066948e-02f, -9.99882340e-01f,  1.53391622e-02f,
+    -9.99924719e-01f,  1.22714853e-02f, -9.99957621e-01f,  9.20369383e-03f,
+    -9.99981165e-01f,  6.13581482e-03f, -9.99995291e-01f,  3.06787807e-03f,
+    -1.00000000e+00f, -8.74227766e-08f, -9.99995291e-01f, -3.06805293e-03f,
+    -9.99981165e-01f, -6.13598945e-03f, -9.99957621e-01f, -9.20386799e-03f,
+    -9.99924719e-01f, -1.22714220e-02f, -9.99882340e-01f, -1.53390989e-02f,
+    -9.99830604e-01f, -1.84066314e-02f, -9.99769390e-01f, -2.14739908e-02f,
+    -9.99698818e-01f, -2.45411471e-02f, -9.99618828e-01f, -2.76080724e-02f,
+    -9.99529421e-01f, -3.06747388e-02f, -9.99430597e-01f, -3.37411165e-02f,
+    -9.99322414e-01f, -3.68071757e-02f, -9.99204755e-01f, -3.98728885e-02f,
+    -9.99077737e-01f, -4.29382287e-02f, -9.98941302e-01f, -4.60031629e-02f,
+    -9.98795450e-01f, -4.90676612e-02f, -9.98640239e-01f, -5.21317013e-02f,
+    -9.98475552e-01f, -5.51952496e-02f, -9.98301566e-01f, -5.82582802e-02f,
+    -9.98118103e-01f, -6.13207594e-02f, -9.97925282e-01f, -6.43826649e-02f,
+    -9.97723043e-01f, -6.74439594e-02f, -9.97511446e-01f, -7.05046207e-02f,
+    -9.97290432e-01f, -7.35646188e-02f, -9.97060061e-01f, -7.66239241e-02f,
+    -9.96820271e-01f, -7.96825141e-02f, -9.96571124e-01f, -8.27403516e-02f,
+    -9.96312618e-01f, -8.57974067e-02f, -9.96044695e-01f, -8.88536572e-02f,
+    -9.95767415e-01f, -9.19090658e-02f, -9.95480716e-01f, -9.49636102e-02f,
+    -9.95184720e-01f, -9.80170295e-02f, -9.94879365e-01f, -1.01069763e-01f,
+    -9.94564593e-01f, -1.04121543e-01f, -9.94240463e-01f, -1.07172340e-01f,
+    -9.93906975e-01f, -1.10222131e-01f, -9.93564129e-01f, -1.13270886e-01f,
+    -9.93211985e-01f, -1.16318576e-01f, -9.92850423e-01f, -1.19365163e-01f,
+    -9.92479563e-01f, -1.22410633e-01f, -9.92099345e-01f, -1.25454947e-01f,
+    -9.91709769e-01f, -1.28498092e-01f, -9.91310835e-01f, -1.31540015e-01f,
+    -9.90902662e-01f, -1.34580702e-01f, -9.90485072e-01f, -1.37620121e-01f,
+    -9.90058184e-01f, -1.40658244e-01f, -9.89621997e-01f, -1.43695056e-01f,
+    -9.89176512e-01f, -1.46730497e-01f, -9.88721669e-01f, -1.49764568e-01f,
+    -9.88257587e-01f, -1.52797237e-01f, -9.87784147e-01f, -1.55828446e-01f,
+    -9.87301409e-01f, -1.58858210e-01f, -9.86809373e-01f, -1.61886469e-01f,
+    -9.86308098e-01f, -1.64913207e-01f, -9.85797465e-01f, -1.67938381e-01f,
+    -9.85277653e-01f, -1.70961991e-01f, -9.84748483e-01f, -1.73983976e-01f,
+    -9.84210074e-01f, -1.77004337e-01f, -9.83662426e-01f, -1.80022791e-01f,
+    -9.83105481e-01f, -1.83039784e-01f, -9.82539296e-01f, -1.86055064e-01f,
+    -9.81963873e-01f, -1.89068571e-01f, -9.81379211e-01f, -1.92080319e-01f,
+    -9.80785310e-01f, -1.95090249e-01f, -9.80182171e-01f, -1.98098347e-01f,
+    -9.79569793e-01f, -2.01104581e-01f, -9.78948176e-01f, -2.04108924e-01f,
+    -9.78317380e-01f, -2.07111344e-01f, -9.77677345e-01f, -2.10111812e-01f,
+    -9.77028131e-01f, -2.13110298e-01f, -9.76369739e-01f, -2.16106787e-01f,
+    -9.75702107e-01f, -2.19101235e-01f, -9.75025356e-01f, -2.22093627e-01f,
+    -9.74339366e-01f, -2.25083932e-01f, -9.73644257e-01f, -2.28072107e-01f,
+    -9.72939968e-01f, -2.31058136e-01f, -9.72226501e-01f, -2.34042004e-01f,
+    -9.71503854e-01f, -2.37023652e-01f, -9.70772147e-01f, -2.40003079e-01f,
+    -9.70031261e-01f, -2.42980242e-01f, -9.69281197e-01f, -2.45955124e-01f,
+    -9.68522072e-01f, -2.48927683e-01f, -9.67753828e-01f, -2.51897901e-01f,
+    -9.66976464e-01f, -2.54865766e-01f, -9.66189981e-01f, -2.57831216e-01f,
+    -9.65394497e-01f, -2.60794014e-01f, -9.64589834e-01f, -2.63754576e-01f,
+    -9.63776112e-01f, -2.66712666e-01f, -9.62953269e-01f, -2.69668251e-01f,
+    -9.62121427e-01f, -2.72621274e-01f, -9.61280525e-01f, -2.75571764e-01f,
+    -9.60430562e-01f, -2.78519630e-01f, -9.59571540e-01f, -2.81464875e-01f,
+    -9.58703518e-01f, -2.84407496e-01f, -9.57826436e-01f, -2.87347436e-01f,
+    -9.56940353e-01f, -2.90284663e-01f, -9.56045270e-01f, -2.93219149e-01f,
+    -9.55141187e-01f, -2.96150863e-01f, -9.54228103e-01f, -2.99079835e-01f,
+    -9.53306019e-01f, -3.02005947e-01f, -9.52374995e-01f, -3.04929256e-01f,
+    -9.51435030e-01f, -3.07849675e-01f, -9.50486064e-01f, -3.10767174e-01f,
+    -9.49528158e-01f, -3.13681781e-01f, -9.48561311e-01f, -3.16593409e-01f,
+    -9.47585583e-01f, -3.19502085e-01f, -9.46600914e-01f, -3.22407752e-01f,
+    -9.45607305e-01f, -3.25310349e-01f, -9.44604814e-01f, -3.28209937e-01f,
+    -9.43593442e-01f, -3.31106395e-01f, -9.42573190e-01f, -3.33999753e-01f,
+    -9.41544056e-01f, -3.36889952e-01f, -9.40506041e-01f, -3.39776993e-01f,
+    -9.39459264e-01f, -3.42660606e-01f, -9.38403547e-01f, -3.45541239e-01f,
+    -9.37339067e-01f, -3.48418593e-01f, -9.36265707e-01f, -3.51292670e-01f,
+    -9.35183525e-01f, -3.54163468e-01f, -9.34092581e-01f, -3.57030898e-01f,
+    -9.32992816e-01f, -3.59894991e-01f, -9.31884289e-01f, -3.62755686e-01f,
+    -9.30767000e-01f, -3.65612954e-01f, -9.29640889e-01f, -3.68466794e-01f,
+    -9.28506076e-01f, -3.71317178e-01f, -9.27362561e-01f, -3.74164045e-01f,
+    -9.26210225e-01f, -3.77007395e-01f, -9.25049245e-01f, -3.79847199e-01f,
+    -9.23879504e-01f, -3.82683426e-01f, -9.22701120e-01f, -3.85516077e-01f,
+    -9.21514034e-01f, -3.88345063e-01f, -9.20318246e-01f, -3.91170412e-01f,
+    -9.19113815e-01f, -3.93992066e-01f, -9.17900741e-01f, -3.96810025e-01f,
+    -9.16679025e-01f, -3.99624258e-01f, -9.15448666e-01f, -4.02434707e-01f,
+    -9.14209723e-01f, -4.05241400e-01f, -9.12962139e-01f, -4.08044249e-01f,
+    -9.11705971e-01f, -4.10843253e-01f, -9.10441220e-01f, -4.13638413e-01f,
+    -9.09167945e-01f, -4.16429669e-01f, -9.07886147e-01f, -4.19216782e-01f,
+    -9.06595767e-01f, -4.22000170e-01f, -9.05296803e-01f, -4.24779594e-01f,
+    -9.03989315e-01f, -4.27555025e-01f, -9.02673364e-01f, -4.30326402e-01f,
+    -9.01348889e-01f, -4.33093756e-01f, -9.00015891e-01f, -4.35857028e-01f,
+    -8.98674488e-01f, -4.38616186e-01f, -8.97324622e-01f, -4.41371232e-01f,
+    -8.95966291e-01f, -4.44122106e-01f, -8.94599497e-01f, -4.46868807e-01f,
+    -8.93224299e-01f, -4.49611306e-01f, -8.91840696e-01f, -4.52349573e-01f,
+    -8.90448749e-01f, -4.55083579e-01f, -8.89048338e-01f, -4.57813293e-01f,
+    -8.87639642e-01f, -4.60538715e-01f, -8.86222541e-01f, -4.63259816e-01f,
+    -8.84797096e-01f, -4.65976536e-01f, -8.83363307e-01f, -4.68688846e-01f,
+    -8.81921232e-01f, -4.71396774e-01f, -8.80470872e-01f, -4.74100262e-01f,
+    -8.79012167e-01f, -4.76799279e-01f, -8.77545238e-01f, -4.79493827e-01f,
+    -8.76070082e-01f, -4.82183844e-01f, -8.74586582e-01f, -4.84869331e-01f,
+    -8.73094916e-01f, -4.87550259e-01f, -8.71595025e-01f, -4.90226567e-01f,
+    -8.70086908e-01f, -4.92898285e-01f, -8.68570745e-01f, -4.95565176e-01f,
+    -8.67046297e-01f, -4.98227566e-01f, -8.65513682e-01f, -5.00885308e-01f,
+    -8.63972902e-01f, -5.03538311e-01f, -8.62424016e-01f, -5.06186604e-01f,
+    -8.60866964e-01f, -5.08830070e-01f, -8.59301865e-01f, -5.11468768e-01f,
+    -8.57728660e-01f, -5.14102697e-01f, -8.56147349e-01f, -5.16731739e-01f,
+    -8.54557991e-01f, -5.19355953e-01f, -8.52960646e-01f, -5.21975279e-01f,
+    -8.51355195e-01f, -5.24589658e-01f, -8.49741757e-01f, -5.27199149e-01f,
+    -8.48120332e-01f, -5.29803634e-01f, -8.46490920e-01f, -5.32403111e-01f,
+    -8.44853580e-01f, -5.34997642e-01f, -8.43208253e-01f, -5.37587106e-01f,
+    -8.41554940e-01f, -5.40171504e-01f, -8.39893758e-01f, -5.42750835e-01f,
+    -8.38224649e-01f, -5.45325041e-01f, -8.36547673e-01f, -5.47894120e-01f,
+    -8.34862828e-01f, -5.50458014e-01f, -8.33170116e-01f, -5.53016782e-01f,
+    -8.31469536e-01f, -5.55570304e-01f, -8.29761207e-01f, -5.58118582e-01f,
+    -8.28045011e-01f, -5.60661674e-01f, -8.26321006e-01f, -5.63199461e-01f,
+    -8.24589372e-01f, -5.65731704e-01f, -8.22849870e-01f, -5.68258882e-01f,
+    -8.21102560e-01f, -5.70780635e-01f, -8.19347560e-01f, -5.73297083e-01f,
+    -8.17584872e-01f, -5.75808108e-01f, -8.15814435e-01f, -5.78313708e-01f,
+    -8.14036369e-01f, -5.80813885e-01f, -8.12250614e-01f, -5.83308637e-01f,
+    -8.10457230e-01f, -5.85797846e-01f, -8.08656216e-01f, -5.88281512e-01f,
+    -8.06847572e-01f, -5.90759695e-01f, -8.05031359e-01f, -5.93232274e-01f,
+    -8.03207517e-01f, -5.95699310e-01f, -8.01376164e-01f, -5.98160684e-01f,
+    -7.99537241e-01f, -6.00616515e-01f, -7.97690809e-01f, -6.03066623e-01f,
+    -7.95836866e-01f, -6.05511069e-01f, -7.93975472e-01f, -6.07949793e-01f,
+    -7.92106569e-01f, -6.10382855e-01f, -7.90230215e-01f, -6.12810135e-01f,
+    -7.88346410e-01f, -6.15231633e-01f, -7.86455154e-01f, -6.17647350e-01f,
+    -7.84556568e-01f, -6.20057285e-01f, -7.82650530e-01f, -6.22461319e-01f,
+    -7.80737162e-01f, -6.24859571e-01f, -7.78816462e-01f, -6.27251923e-01f,
+    -7.76888371e-01f, -6.29638314e-01f, -7.74953187e-01f, -6.32018626e-01f,
+    -7.73010552e-01f, -6.34393215e-01f, -7.71060586e-01f, -6.36761785e-01f,
+    -7.69103408e-01f, -6.39124393e-01f, -7.67138958e-01f, -6.41480923e-01f,
+    -7.65167296e-01f, -6.43831491e-01f, -7.63188481e-01f, -6.46175981e-01f,
+    -7.61202395e-01f, -6.48514330e-01f, -7.59209216e-01f, -6.50846660e-01f,
+    -7.57208884e-01f, -6.53172791e-01f, -7.55201399e-01f, -6.55492842e-01f,
+    -7.53186822e-01f, -6.57806695e-01f, -7.51165152e-01f, -6.60114348e-01f,
+    -7.49136388e-01f, -6.62415802e-01f, -7.47100592e-01f, -6.64710999e-01f,
+    -7.45057762e-01f, -6.66999936e-01f, -7.43007958e-01f, -6.69282615e-01f,
+    -7.40951121e-01f, -6.71558976e-01f, -7.38887310e-01f, -6.73829019e-01f,
+    -7.36816525e-01f, -6.76092744e-01f, -7.34738827e-01f, -6.78350091e-01f,
+    -7.32654214e-01f, -6.80601060e-01f, -7.30562747e-01f, -6.82845592e-01f,
+    -7.28464305e-01f, -6.85083747e-01f, -7.26359069e-01f, -6.87315404e-01f,
+    -7.24247038e-01f, -6.89540625e-01f, -7.22128093e-01f, -6.91759348e-01f,
+    -7.20002413e-01f, -6.93971574e-01f, -7.17870116e-01f, -6.96177065e-01f,
+    -7.15730906e-01f, -6.98376179e-01f, -7.13584960e-01f, -7.00568736e-01f,
+    -7.11432278e-01f, -7.02754676e-01f, -7.09272861e-01f, -7.04934001e-01f,
+    -7.07106829e-01f, -7.07106709e-01f, -7.04934120e-01f, -7.09272802e-01f,
+    -7.02754796e-01f, -7.11432159e-01f, -7.00568795e-01f, -7.13584840e-01f,
+    -6.98376298e-01f, -7.15730786e-01f, -6.96177125e-01f, -7.17870057e-01f,
+    -6.93971455e-01f, -7.20002472e-01f, -6.91759288e-01f, -7.22128212e-01f,
+    -6.89540565e-01f, -7.24247098e-01f, -6.87315345e-01f, -7.26359189e-01f,
+    -6.85083628e-01f, -7.28464425e-01f, -6.82845533e-01f, -7.30562806e-01f,
+    -6.80601001e-01f, -7.32654274e-01f, -6.78350031e-01f, -7.34738886e-01f,
+    -6.76092684e-01f, -7.36816585e-01f, -6.73828959e-01f, -7.38887370e-01f,
+    -6.71558917e-01f, -7.40951180e-01f, -6.69282556e-01f, -7.43008018e-01f,
+    -6.66999876e-01f, -7.45057821e-01f, -6.64710939e-01f, -7.47100651e-01f,
+    -6.62415683e-01f, -7.49136448e-01f, -6.60114288e-01f, -7.51165211e-01f,
+    -6.57806754e-01f, -7.53186703e-01f, -6.55492961e-01f, -7.55201280e-01f,
+    -6.53172910e-01f, -7.57208765e-01f, -6.50846779e-01f, -7.59209156e-01f,
+    -6.48514450e-01f, -7.61202335e-01f, -6.46176100e-01f, -7.63188362e-01f,
+    -6.43831611e-01f, -7.65167236e-01f, -6.41481042e-01f, -7.67138898e-01f,
+    -6.39124513e-01f, -7.69103289e-01f, -6.36761904e-01f, -7.71060526e-01f,
+    -6.34393334e-01f, -7.73010433e-01f, -6.32018745e-01f, -7.74953067e-01f,
+    -6.29638255e-01f, -7.76888430e-01f, -6.27251804e-01f, -7.78816521e-01f,
+    -6.24859512e-01f, -7.80737221e-01f, -6.22461259e-01f, -7.82650590e-01f,
+    -6.20057166e-01f, -7.84556627e-01f, -6.17647290e-01f, -7.86455214e-01f,
+    -6.15231574e-01f, -7.88346469e-01f, -6.12810016e-01f, -7.90230274e-01f,
+    -6.10382736e-01f, -7.92106628e-01f, -6.07949734e-01f, -7.93975532e-01f,
+    -6.05511010e-01f, -7.95836926e-01f, -6.03066504e-01f, -7.97690868e-01f,
+    -6.00616395e-01f, -7.99537301e-01f, -5.98160625e-01f, -8.01376224e-01f,
+    -5.95699191e-01f, -8.03207576e-01f, -5.93232214e-01f, -8.05031419e-01f,
+    -5.90759575e-01f, -8.06847632e-01f, -5.88281453e-01f, -8.08656275e-01f,
+    -5.85797727e-01f, -8.10457289e-01f, -5.83308518e-01f, -8.12250674e-01f,
+    -5.80813825e-01f, -8.14036429e-01f, -5.78313649e-01f, -8.15814495e-01f,
+    -5.75808048e-01f, -8.17584932e-01f, -5.73297024e-01f, -8.19347620e-01f,
+    -5.70780575e-01f, -8.21102619e-01f, -5.68258762e-01f, -8.22849870e-01f,
+    -5.65731645e-01f, -8.24589431e-01f, -5.63199162e-01f, -8.26321185e-01f,
+    -5.60661376e-01f, -8.28045189e-01f, -5.58118701e-01f, -8.29761088e-01f,
+    -5.55570424e-01f, -8.31469476e-01f, -5.53016901e-01f, -8.33170056e-01f,
+    -5.50458133e-01f, -8.34862769e-01f, -5.47894239e-01f, -8.36547613e-01f,
+    -5.45325160e-01f, -8.38224590e-01f, -5.42750955e-01f, -8.39893699e-01f,
+    -5.40171623e-01f, -8.41554880e-01f, -5.37587225e-01f, -8.43208134e-01f,
+    -5.34997761e-01f, -8.44853461e-01f, -5.32403231e-01f, -8.46490860e-01f,
+    -5.29803753e-01f, -8.48120272e-01f, -5.27199268e-01f, -8.49741697e-01f,
+    -5.24589777e-01f, -8.51355135e-01f, -5.21975398e-01f, -8.52960527e-01f,
+    -5.19356072e-01f, -8.54557931e-01f, -5.16731858e-01f, -8.56147289e-01f,
+    -5.14102817e-01f, -8.57728541e-01f, -5.11468947e-01f, -8.59301805e-01f,
+    -5.08830190e-01f, -8.60866904e-01f, -5.06186724e-01f, -8.62423897e-01f,
+    -5.03538430e-01f, -8.63972843e-01f, -5.00885427e-01f, -8.65513623e-01f,
+    -4.98227686e-01f, -8.67046237e-01f, -4.95565295e-01f, -8.68570685e-01f,
+    -4.92898196e-01f, -8.70086968e-01f, -4.90226477e-01f, -8.71595085e-01f,
+    -4.87550169e-01f, -8.73094976e-01f, -4.84869242e-01f, -8.74586642e-01f,
+    -4.82183754e-01f, -8.76070082e-01f, -4.79493737e-01f, -8.77545297e-01f,
+    -4.76799190e-01f, -8.79012227e-01f, -4.74100173e-01f, -8.80470932e-01f,
+    -4.71396685e-01f, -8.81921291e-01f, -4.68688756e-01f, -8.83363366e-01f,
+    -4.65976447e-01f, -8.84797156e-01f, -4.63259727e-01f, -8.86222541e-01f,
+    -4.60538626e-01f, -8.87639642e-01f, -4.57813233e-01f, -8.89048398e-01f,
+    -4.55083489e-01f, -8.90448749e-01f, -4.52349484e-01f, -8.91840756e-01f,
+    -4.49611217e-01f, -8.93224359e-01f, -4.46868718e-01f, -8.94599557e-01f,
+    -4.44122016e-01f, -8.95966291e-01f, -4.41371143e-01f, -8.97324622e-01f,
+    -4.38616097e-01f, -8.98674548e-01f, -4.35856938e-01f, -9.00015950e-01f,
+    -4.33093667e-01f, -9.01348948e-01f, -4.30326313e-01f, -9.02673423e-01f,
+    -4.27554935e-01f, -9.03989375e-01f, -4.24779505e-01f, -9.05296862e-01f,
+    -4.22000080e-01f, -9.06595767e-01f, -4.19216692e-01f, -9.07886207e-01f,
+    -4.16429371e-01f, -9.09168065e-01f, -4.13638085e-01f, -9.10441399e-01f,
+    -4.10843372e-01f, -9.11705911e-01f, -4.08044368e-01f, -9.12962079e-01f,
+    -4.05241519e-01f, -9.14209664e-01f, -4.02434856e-01f, -9.15448606e-01f,
+    -3.99624377e-01f, -9.16678965e-01f, -3.96810174e-01f, -9.17900681e-01f,
+    -3.93992215e-01f, -9.19113755e-01f, -3.91170532e-01f, -9.20318186e-01f,
+    -3.88345212e-01f, -9.21513975e-01f, -3.85516196e-01f, -9.22701061e-01f,
+    -3.82683575e-01f, -9.23879504e-01f, -3.79847348e-01f, -9.25049186e-01f,
+    -3.77007544e-01f, -9.26210165e-01f, -3.74164164e-01f, -9.27362502e-01f,
+    -3.71317297e-01f, -9.28506017e-01f, -3.68466914e-01f, -9.29640830e-01f,
+    -3.65613073e-01f, -9.30766940e-01f, -3.62755805e-01f, -9.31884229e-01f,
+    -3.59895110e-01f, -9.32992756e-01f, -3.57031018e-01f, -9.34092522e-01f,
+    -3.54163587e-01f, -9.35183465e-01f, -3.51292819e-01f, -9.36265647e-01f,
+    -3.48418713e-01f, -9.37339008e-01f, -3.45541358e-01f, -9.38403547e-01f,
+    -3.42660755e-01f, -9.39459205e-01f, -3.39776903e-01f, -9.40506041e-01f,
+    -3.36889863e-01f, -9.41544056e-01f, -3.33999664e-01f, -9.42573190e-01f,
+    -3.31106305e-01f, -9.43593442e-01f, -3.28209817e-01f, -9.44604814e-01f,
+    -3.25310260e-01f, -9.45607305e-01f, -3.22407633e-01f, -9.46600914e-01f,
+    -3.19501996e-01f, -9.47585583e-01f, -3.16593319e-01f, -9.48561370e-01f,
+    -3.13681692e-01f, -9.49528217e-01f, -3.10767084e-01f, -9.50486124e-01f,
+    -3.07849556e-01f, -9.51435030e-01f, -3.04929137e-01f, -9.52375054e-01f,
+    -3.02005857e-01f, -9.53306079e-01f, -2.99079716e-01f, -9.54228103e-01f,
+    -2.96150774e-01f, -9.55141187e-01f, -2.93219060e-01f, -9.56045270e-01f,
+    -2.90284544e-01f, -9.56940353e-01f, -2.87347317e-01f, -9.57826436e-01f,
+    -2.84407407e-01f, -9.58703518e-01f, -2.81464785e-01f, -9.59571540e-01f,
+    -2.78519541e-01f, -9.60430562e-01f, -2.75571644e-01f, -9.61280525e-01f,
+    -2.72621185e-01f, -9.62121427e-01f, -2.69668132e-01f, -9.62953329e-01f,
+    -2.66712576e-01f, -9.63776112e-01f, -2.63754487e-01f, -9.64589834e-01f,
+    -2.60793895e-01f, -9.65394497e-01f, -2.57830888e-01f, -9.66190040e-01f,
+    -2.54865438e-01f, -9.66976523e-01f, -2.51898050e-01f, -9.67753768e-01f,
+    -2.48927832e-01f, -9.68522012e-01f, -2.45955259e-01f, -9.69281197e-01f,
+    -2.42980376e-01f, -9.70031202e-01f, -2.40003213e-01f, -9.70772088e-01f,
+    -2.37023786e-01f, -9.71503854e-01f, -2.34042138e-01f, -9.72226441e-01f,
+    -2.31058270e-01f, -9.72939909e-01f, -2.28072241e-01f, -9.73644197e-01f,
+    -2.25084066e-01f, -9.74339366e-01f, -2.22093761e-01f, -9.75025296e-01f,
+    -2.19101369e-01f, -9.75702107e-01f, -2.16106921e-01f, -9.76369679e-01f,
+    -2.13110432e-01f, -9.77028131e-01f, -2.10111946e-01f, -9.77677345e-01f,
+    -2.07111478e-01f, -9.78317320e-01f, -2.04109058e-01f, -9.78948176e-01f,
+    -2.01104715e-01f, -9.79569733e-01f, -1.98098481e-01f, -9.80182111e-01f,
+    -1.95090383e-01f, -9.80785251e-01f, -1.92080453e-01f, -9.81379211e-01f,
+    -1.89068720e-01f, -9.81963873e-01f, -1.86055198e-01f, -9.82539296e-01f,
+    -1.83039919e-01f, -9.83105481e-01f, -1.80022925e-01f, -9.83662426e-01f,
+    -1.77004233e-01f, -9.84210074e-01f, -1.73983887e-01f, -9.84748483e-01f,
+    -1.70961887e-01f, -9.85277653e-01f, -1.67938292e-01f, -9.85797524e-01f,
+    -1.64913103e-01f, -9.86308098e-01f, -1.61886364e-01f, -9.86809433e-01f,
+    -1.58858106e-01f, -9.87301409e-01f, -1.55828357e-01f, -9.87784147e-01f,
+    -1.52797133e-01f, -9.88257587e-01f, -1.49764478e-01f, -9.88721728e-01f,
+    -1.46730408e-01f, -9.89176512e-01f, -1.43694952e-01f, -9.89622056e-01f,
+    -1.40658155e-01f, -9.90058243e-01f, -1.37620032e-01f, -9.90485072e-01f,
+    -1.34580597e-01f, -9.90902662e-01f, -1.31539911e-01f, -9.91310894e-01f,
+    -1.28497988e-01f, -9.91709769e-01f, -1.25454858e-01f, -9.92099345e-01f,
+    -1.22410536e-01f, -9.92479563e-01f, -1.19365066e-01f, -9.92850423e-01f,
+    -1.16318472e-01f, -9.93211985e-01f, -1.13270789e-01f, -9.93564129e-01f,
+    -1.10222034e-01f, -9.93906975e-01f, -1.07172243e-01f, -9.94240463e-01f,
+    -1.04121439e-01f, -9.94564593e-01f, -1.01069659e-01f, -9.94879365e-01f,
+    -9.80169326e-02f, -9.95184720e-01f, -9.49632749e-02f, -9.95480776e-01f,
+    -9.19087306e-02f, -9.95767415e-01f, -8.88533145e-02f, -9.96044695e-01f,
+    -8.57975408e-02f, -9.96312618e-01f, -8.27404857e-02f, -9.96571124e-01f,
+    -7.96826482e-02f, -9.96820271e-01f, -7.66240656e-02f, -9.97060061e-01f,
+    -7.35647604e-02f, -9.97290432e-01f, -7.05047622e-02f, -9.97511446e-01f,
+    -6.74441010e-02f, -9.97723043e-01f, -6.43827990e-02f, -9.97925282e-01f,
+    -6.13208972e-02f, -9.98118103e-01f, -5.82584180e-02f, -9.98301566e-01f,
+    -5.51953875e-02f, -9.98475552e-01f, -5.21318391e-02f, -9.98640239e-01f,
+    -4.90678027e-02f, -9.98795450e-01f, -4.60033007e-02f, -9.98941302e-01f,
+    -4.29383665e-02f, -9.99077737e-01f, -3.98730300e-02f, -9.99204755e-01f,
+    -3.68073136e-02f, -9.99322355e-01f, -3.37412544e-02f, -9.99430597e-01f,
+    -3.06748785e-02f, -9.99529421e-01f, -2.76082121e-02f, -9.99618828e-01f,
+    -2.45412868e-02f, -9.99698818e-01f, -2.14741286e-02f, -9.99769390e-01f,
+    -1.84067693e-02f, -9.99830604e-01f, -1.53392376e-02f, -9.99882340e-01f,
+    -1.22715607e-02f, -9.99924719e-01f, -9.20376927e-03f, -9.99957621e-01f,
+    -6.13589026e-03f, -9.99981165e-01f, -3.06795351e-03f, -9.99995291e-01f,
+     1.19248806e-08f, -1.00000000e+00f,  3.06797749e-03f, -9.99995291e-01f,
+     6.13591401e-03f, -9.99981165e-01f,  9.20379255e-03f, -9.99957621e-01f,
+     1.22715849e-02f, -9.99924719e-01f,  1.53392619e-02f, -9.99882340e-01f,
+     1.84067935e-02f, -9.99830604e-01f,  2.14741528e-02f, -9.99769390e-01f,
+     2.45413091e-02f, -9.99698818e-01f,  2.76082363e-02f, -9.99618828e-01f,
+     3.06749027e-02f, -9.99529421e-01f,  3.37412804e-02f, -9.99430597e-01f,
+     3.68073396e-02f, -9.99322355e-01f,  3.98730524e-02f, -9.99204755e-01f,
+     4.29383889e-02f, -9.99077737e-01f,  4.60033230e-02f, -9.98941302e-01f,
+     4.90678251e-02f, -9.98795450e-01f,  5.21318652e-02f, -9.98640239e-01f,
+     5.51954135e-02f, -9.98475552e-01f,  5.82584403e-02f, -9.98301506e-01f,
+     6.13209233e-02f, -9.98118103e-01f,  6.43828288e-02f, -9.97925282e-01f,
+     6.74441233e-02f, -9.97723043e-01f,  7.05047846e-02f, -9.97511446e-01f,
+     7.35647827e-02f, -9.97290432e-01f,  7.66240880e-02f, -9.97060061e-01f,
+     7.96826780e-02f, -9.96820271e-01f,  8.27400386e-02f, -9.96571183e-01f,
+     8.57970938e-02f, -9.96312618e-01f,  8.88533443e-02f, -9.96044695e-01f,
+     9.19087529e-02f, -9.95767415e-01f,  9.49633047e-02f, -9.95480776e-01f,
+     9.80169550e-02f, -9.95184720e-01f,  1.01069689e-01f, -9.94879365e-01f,
+     1.04121469e-01f, -9.94564593e-01f,  1.07172266e-01f, -9.94240463e-01f,
+     1.10222057e-01f, -9.93906975e-01f,  1.13270812e-01f, -9.93564129e-01f,
+     1.16318494e-01f, -9.93211985e-01f,  1.19365089e-01f, -9.92850423e-01f,
+     1.22410558e-01f, -9.92479563e-01f,  1.25454873e-01f, -9.92099345e-01f,
+     1.28498018e-01f, -9.91709769e-01f,  1.31539941e-01f, -9.91310894e-01f,
+     1.34580627e-01f, -9.90902662e-01f,  1.37620047e-01f, -9.90485072e-01f,
+     1.40658170e-01f, -9.90058243e-01f,  1.43694982e-01f, -9.89621997e-01f,
+     1.46730423e-01f, -9.89176512e-01f,  1.49764493e-01f, -9.88721669e-01f,
+     1.52797163e-01f, -9.88257587e-01f,  1.55828372e-01f, -9.87784147e-01f,
+     1.58858135e-01f, -9.87301409e-01f,  1.61886394e-01f, -9.86809373e-01f,
+     1.64913133e-01f, -9.86308098e-01f,  1.67938307e-01f, -9.85797524e-01f,
+     1.70961916e-01f, -9.85277653e-01f,  1.73983902e-01f, -9.84748483e-01f,
+     1.77004263e-01f, -9.84210074e-01f,  1.80022955e-01f, -9.83662426e-01f,
+     1.83039948e-01f, -9.83105481e-01f,  1.86055213e-01f, -9.82539296e-01f,
+     1.89068735e-01f, -9.81963873e-01f,  1.92080483e-01f, -9.81379151e-01f,
+     1.95090413e-01f, -9.80785251e-01f,  1.98098511e-01f, -9.80182111e-01f,
+     2.01104745e-01f, -9.79569733e-01f,  2.04109088e-01f, -9.78948176e-01f,
+     2.07111508e-01f, -9.78317320e-01f,  2.10111976e-01f, -9.77677345e-01f,
+     2.13110462e-01f, -9.77028131e-01f,  2.16106951e-01f, -9.76369679e-01f,
+     2.19101399e-01f, -9.75702107e-01f,  2.22093791e-01f, -9.75025296e-01f,
+     2.25084081e-01f, -9.74339366e-01f,  2.28072271e-01f, -9.73644197e-01f,
+     2.31058300e-01f, -9.72939909e-01f,  2.34042153e-01f, -9.72226441e-01f,
+     2.37023816e-01f, -9.71503854e-01f,  2.40003243e-01f, -9.70772088e-01f,
+     2.42980406e-01f, -9.70031202e-01f,  2.45954826e-01f, -9.69281316e-01f,
+     2.48927385e-01f, -9.68522131e-01f,  2.51897603e-01f, -9.67753887e-01f,
+     2.54865468e-01f, -9.66976523e-01f,  2.57830918e-01f, -9.66190040e-01f,
+     2.60793924e-01f, -9.65394497e-01f,  2.63754487e-01f, -9.64589834e-01f,
+     2.66712576e-01f, -9.63776112e-01f,  2.69668162e-01f, -9.62953329e-01f,
+     2.72621214e-01f, -9.62121427e-01f,  2.75571674e-01f, -9.61280525e-01f,
+     2.78519541e-01f, -9.60430562e-01f,  2.81464815e-01f, -9.59571540e-01f,
+     2.84407407e-01f, -9.58703518e-01f,  2.87347347e-01f, -9.57826436e-01f,
+     2.90284574e-01f, -9.56940353e-01f,  2.93219060e-01f, -9.56045270e-01f,
+     2.96150804e-01f, -9.55141187e-01f,  2.99079746e-01f, -9.54228103e-01f,
+     3.02005887e-01f, -9.53306079e-01f,  3.04929167e-01f, -9.52375054e-01f,
+     3.07849586e-01f, -9.51435030e-01f,  3.10767114e-01f, -9.50486064e-01f,
+     3.13681692e-01f, -9.49528217e-01f,  3.16593349e-01f, -9.48561370e-01f,
+     3.19502026e-01f, -9.47585583e-01f,  3.22407663e-01f, -9.46600914e-01f,
+     3.25310290e-01f, -9.45607305e-01f,  3.28209847e-01f, -9.44604814e-01f,
+     3.31106335e-01f, -9.43593442e-01f,  3.33999664e-01f, -9.42573190e-01f,
+     3.36889893e-01f, -9.41544056e-01f,  3.39776933e-01f, -9.40506041e-01f,
+     3.42660755e-01f, -9.39459205e-01f,  3.45541388e-01f, -9.38403487e-01f,
+     3.48418742e-01f, -9.37339008e-01f,  3.51292819e-01f, -9.36265647e-01f,
+     3.54163617e-01f, -9.35183465e-01f,  3.57031047e-01f, -9.34092522e-01f,
+     3.59895140e-01f, -9.32992756e-01f,  3.62755835e-01f, -9.31884229e-01f,
+     3.65613103e-01f, -9.30766940e-01f,  3.68466944e-01f, -9.29640830e-01f,
+     3.71317327e-01f, -9.28506017e-01f,  3.74164194e-01f, -9.27362442e-01f,
+     3.77007544e-01f, -9.26210165e-01f,  3.79847348e-01f, -9.25049186e-01f,
+     3.82683605e-01f, -9.23879445e-01f,  3.85516226e-01f, -9.22701061e-01f,
+     3.88345212e-01f, -9.21513975e-01f,  3.91170561e-01f, -9.20318186e-01f,
+     3.93992215e-01f, -9.19113755e-01f,  3.96810174e-01f, -9.17900681e-01f,
+     3.99624407e-01f, -9.16678965e-01f,  4.02434856e-01f, -9.15448606e-01f,
+     4.05241102e-01f, -9.14209843e-01f,  4.08043951e-01f, -9.12962258e-01f,
+     4.10842985e-01f, -9.11706150e-01f,  4.13638115e-01f, -9.10441399e-01f,
+     4.16429371e-01f, -9.09168065e-01f,  4.19216722e-01f, -9.07886207e-01f,
+     4.22000110e-01f, -9.06595767e-01f,  4.24779534e-01f, -9.05296862e-01f,
+     4.27554935e-01f, -9.03989375e-01f,  4.30326343e-01f, -9.02673364e-01f,
+     4.33093697e-01f, -9.01348889e-01f,  4.35856968e-01f, -9.00015950e-01f,
+     4.38616127e-01f, -8.98674548e-01f,  4.41371173e-01f, -8.97324622e-01f,
+     4.44122046e-01f, -8.95966291e-01f,  4.46868747e-01f, -8.94599557e-01f,
+     4.49611247e-01f, -8.93224359e-01f,  4.52349514e-01f, -8.91840756e-01f,
+     4.55083519e-01f, -8.90448749e-01f,  4.57813233e-01f, -8.89048398e-01f,
+     4.60538656e-01f, -8.87639642e-01f,  4.63259727e-01f, -8.86222541e-01f,
+     4.65976447e-01f, -8.84797096e-01f,  4.68688786e-01f, -8.83363366e-01f,
+     4.71396714e-01f, -8.81921291e-01f,  4.74100202e-01f, -8.80470872e-01f,
+     4.76799220e-01f, -8.79012227e-01f,  4.79493767e-01f, -8.77545297e-01f,
+     4.82183784e-01f, -8.76070082e-01f,  4.84869272e-01f, -8.74586642e-01f,
+     4.87550169e-01f, -8.73094976e-01f,  4.90226507e-01f, -8.71595085e-01f,
+     4.92898226e-01f, -8.70086968e-01f,  4.95565295e-01f, -8.68570685e-01f,
+     4.98227715e-01f, -8.67046237e-01f,  5.00885427e-01f, -8.65513563e-01f,
+     5.03538430e-01f, -8.63972843e-01f,  5.06186724e-01f, -8.62423897e-01f,
+     5.08830249e-01f, -8.60866904e-01f,  5.11468947e-01f, -8.59301746e-01f,
+     5.14102817e-01f, -8.57728541e-01f,  5.16731918e-01f, -8.56147289e-01f,
+     5.19356072e-01f, -8.54557931e-01f,  5.21975398e-01f, -8.52960527e-01f,
+     5.24589777e-01f, -8.51355135e-01f,  5.27199268e-01f, -8.49741697e-01f,
+     5.29803753e-01f, -8.48120272e-01f,  5.32403290e-01f, -8.46490860e-01f,
+     5.34997761e-01f, -8.44853461e-01f,  5.37587225e-01f, -8.43208134e-01f,
+     5.40171623e-01f, -8.41554880e-01f,  5.42750955e-01f, -8.39893699e-01f,
+     5.45325160e-01f, -8.38224590e-01f,  5.47894239e-01f, -8.36547613e-01f,
+     5.50458193e-01f, -8.34862769e-01f,  5.53016484e-01f, -8.33170295e-01f,
+     5.55570066e-01f, -8.31469715e-01f,  5.58118343e-01f, -8.29761326e-01f,
+     5.60661376e-01f, -8.28045189e-01f,  5.63199162e-01f, -8.26321185e-01f,
+     5.65731645e-01f, -8.24589431e-01f,  5.68258822e-01f, -8.22849870e-01f,
+     5.70780575e-01f, -8.21102619e-01f,  5.73297024e-01f, -8.19347620e-01f,
+     5.75808048e-01f, -8.17584932e-01f,  5.78313649e-01f, -8.15814495e-01f,
+     5.80813825e-01f, -8.14036429e-01f,  5.83308518e-01f, -8.12250674e-01f,
+     5.85797787e-01f, -8.10457289e-01f,  5.88281453e-01f, -8.08656275e-01f,
+     5.90759635e-01f, -8.06847632e-01f,  5.93232214e-01f, -8.05031359e-01f,
+     5.95699251e-01f, -8.03207576e-01f,  5.98160625e-01f, -8.01376224e-01f,
+     6.00616395e-01f, -7.99537301e-01f,  6.03066564e-01f, -7.97690868e-01f,
+     6.05511010e-01f, -7.95836926e-01f,  6.07949734e-01f, -7.93975532e-01f,
+     6.10382795e-01f, -7.92106569e-01f,  6.12810075e-01f, -7.90230215e-01f,
+     6.15231574e-01f, -7.88346410e-01f,  6.17647290e-01f, -7.86455214e-01f,
+     6.20057225e-01f, -7.84556568e-01f,  6.22461259e-01f, -7.82650590e-01f,
+     6.24859512e-01f, -7.80737221e-01f,  6.27251863e-01f, -7.78816521e-01f,
+     6.29638255e-01f, -7.76888430e-01f,  6.32018745e-01f, -7.74953067e-01f,
+     6.34393334e-01f, -7.73010433e-01f,  6.36761904e-01f, -7.71060467e-01f,
+     6.39124513e-01f, -7.69103289e-01f,  6.41481102e-01f, -7.67138839e-01f,
+     6.43831611e-01f, -7.65167236e-01f,  6.46176100e-01f, -7.63188362e-01f,
+     6.48514509e-01f, -7.61202335e-01f,  6.50846779e-01f, -7.59209096e-01f,
+     6.53172910e-01f, -7.57208765e-01f,  6.55492961e-01f, -7.55201280e-01f,
+     6.57806814e-01f, -7.53186703e-01f,  6.60114467e-01f, -7.51165032e-01f,
+     6.62415922e-01f, -7.49136269e-01f,  6.64711118e-01f, -7.47100472e-01f,
+     6.67000055e-01f, -7.45057642e-01f,  6.69282734e-01f, -7.43007839e-01f,
+     6.71559095e-01f, -7.40951002e-01f,  6.73829138e-01f, -7.38887191e-01f,
+     6.76092863e-01f, -7.36816406e-01f,  6.78350210e-01f, -7.34738708e-01f,
+     6.80601180e-01f, -7.32654095e-01f,  6.82845712e-01f, -7.30562627e-01f,
+     6.85083508e-01f, -7.28464544e-01f,  6.87315166e-01f, -7.26359308e-01f,
+     6.89540386e-01f, -7.24247217e-01f,  6.91759109e-01f, -7.22128332e-01f,
+     6.93971336e-01f, -7.20002651e-01f,  6.96177006e-01f, -7.17870176e-01f,
+     6.98376119e-01f, -7.15730965e-01f,  7.00568676e-01f, -7.13584960e-01f,
+     7.02754617e-01f, -7.11432338e-01f,  7.04933941e-01f, -7.09272921e-01f,
+     7.07106650e-01f, -7.07106888e-01f,  7.09272742e-01f, -7.04934180e-01f,
+     7.11432099e-01f, -7.02754855e-01f,  7.13584781e-01f, -7.00568855e-01f,
+     7.15730727e-01f, -6.98376358e-01f,  7.17869997e-01f, -6.96177185e-01f,
+     7.20002472e-01f, -6.93971515e-01f,  7.22128153e-01f, -6.91759348e-01f,
+     7.24247038e-01f, -6.89540625e-01f,  7.26359129e-01f, -6.87315404e-01f,
+     7.28464365e-01f, -6.85083687e-01f,  7.30562747e-01f, -6.82845592e-01f,
+     7.32654274e-01f, -6.80601001e-01f,  7.34738827e-01f, -6.78350091e-01f,
+     7.36816525e-01f, -6.76092744e-01f,  7.38887310e-01f, -6.73829019e-01f,
+     7.40951121e-01f, -6.71558976e-01f,  7.43007958e-01f, -6.69282615e-01f,
+     7.45057821e-01f, -6.66999936e-01f,  7.47100592e-01f, -6.64710939e-01f,
+     7.49136388e-01f, -6.62415743e-01f,  7.51165152e-01f, -6.60114288e-01f,
+     7.53186822e-01f, -6.57806635e-01f,  7.55201399e-01f, -6.55492842e-01f,
+     7.57208884e-01f, -6.53172791e-01f,  7.59209216e-01f, -6.50846660e-01f,
+     7.61202455e-01f, -6.48514330e-01f,  7.63188481e-01f, -6.46175921e-01f,
+     7.65167356e-01f, -6.43831491e-01f,  7.67138958e-01f, -6.41480923e-01f,
+     7.69103408e-01f, -6.39124334e-01f,  7.71060586e-01f, -6.36761785e-01f,
+     7.73010552e-01f, -6.34393156e-01f,  7.74953187e-01f, -6.32018626e-01f,
+     7.76888549e-01f, -6.29638135e-01f,  7.78816640e-01f, -6.27251685e-01f,
+     7.80737340e-01f, -6.24859333e-01f,  7.82650709e-01f, -6.22461140e-01f,
+     7.84556687e-01f, -6.20057046e-01f,  7.86455333e-01f, -6.17647171e-01f,
+     7.88346529e-01f, -6.15231454e-01f,  7.90230334e-01f, -6.12809896e-01f,
+     7.92106688e-01f, -6.10382617e-01f,  7.93975592e-01f, -6.07949615e-01f,
+     7.95837045e-01f, -6.05510831e-01f,  7.97690690e-01f, -6.03066802e-01f,
+     7.99537122e-01f, -6.00616634e-01f,  8.01376045e-01f, -5.98160863e-01f,
+     8.03207397e-01f, -5.95699489e-01f,  8.05031240e-01f, -5.93232453e-01f,
+     8.06847453e-01f, -5.90759873e-01f,  8.08656096e-01f, -5.88281691e-01f,
+     8.10457110e-01f, -5.85797966e-01f,  8.12250495e-01f, -5.83308756e-01f,
+     8.14036250e-01f, -5.80814064e-01f,  8.15814316e-01f, -5.78313887e-01f,
+     8.17584753e-01f, -5.75808287e-01f,  8.19347441e-01f, -5.73297262e-01f,
+     8.21102440e-01f, -5.70780814e-01f,  8.22849691e-01f, -5.68259060e-01f,
+     8.24589252e-01f, -5.65731883e-01f,  8.26321006e-01f, -5.63199401e-01f,
+     8.28045011e-01f, -5.60661614e-01f,  8.29761207e-01f, -5.58118582e-01f,
+     8.31469595e-01f, -5.55570304e-01f,  8.33170116e-01f, -5.53016722e-01f,
+     8.34862828e-01f, -5.50458014e-01f,  8.36547732e-01f, -5.47894061e-01f,
+     8.38224709e-01f, -5.45325041e-01f,  8.39893758e-01f, -5.42750776e-01f,
+     8.41554999e-01f, -5.40171504e-01f,  8.43208253e-01f, -5.37587106e-01f,
+     8.44853580e-01f, -5.34997642e-01f,  8.46490920e-01f, -5.32403111e-01f,
+     8.48120332e-01f, -5.29803634e-01f,  8.49741757e-01f, -5.27199090e-01f,
+     8.51355195e-01f, -5.24589658e-01f,  8.52960646e-01f, -5.21975279e-01f,
+     8.54557991e-01f, -5.19355953e-01f,  8.56147349e-01f, -5.16731739e-01f,
+     8.57728660e-01f, -5.14102697e-01f,  8.59301865e-01f, -5.11468768e-01f,
+     8.60866964e-01f, -5.08830070e-01f,  8.62424016e-01f, -5.06186545e-01f,
+     8.63972902e-01f, -5.03538311e-01f,  8.65513682e-01f, -5.00885308e-01f,
+     8.67046297e-01f, -4.98227566e-01f,  8.68570745e-01f, -4.95565146e-01f,
+     8.70087087e-01f, -4.92898077e-01f,  8.71595144e-01f, -4.90226358e-01f,
+     8.73095036e-01f, -4.87550020e-01f,  8.74586761e-01f, -4.84869093e-01f,
+     8.76070201e-01f, -4.82183605e-01f,  8.77545357e-01f, -4.79493588e-01f,
+     8.79012346e-01f, -4.76799071e-01f,  8.80470991e-01f, -4.74100024e-01f,
+     8.81921351e-01f, -4.71396536e-01f,  8.83363426e-01f, -4.68688637e-01f,
+     8.84797215e-01f, -4.65976298e-01f,  8.86222422e-01f, -4.63259995e-01f,
+     8.87639523e-01f, -4.60538924e-01f,  8.89048278e-01f, -4.57813501e-01f,
+     8.90448630e-01f, -4.55083787e-01f,  8.91840637e-01f, -4.52349752e-01f,
+     8.93224239e-01f, -4.49611515e-01f,  8.94599378e-01f, -4.46869016e-01f,
+     8.95966172e-01f, -4.44122314e-01f,  8.97324502e-01f, -4.41371411e-01f,
+     8.98674369e-01f, -4.38616395e-01f,  9.00015831e-01f, -4.35857207e-01f,
+     9.01348770e-01f, -4.33093935e-01f,  9.02673244e-01f, -4.30326611e-01f,
+     9.03989255e-01f, -4.27555203e-01f,  9.05296683e-01f, -4.24779773e-01f,
+     9.06595647e-01f, -4.22000378e-01f,  9.07886088e-01f, -4.19216990e-01f,
+     9.09167945e-01f, -4.16429639e-01f,  9.10441279e-01f, -4.13638383e-01f,
+     9.11706030e-01f, -4.10843223e-01f,  9.12962139e-01f, -4.08044219e-01f,
+     9.14209723e-01f, -4.05241370e-01f,  9.15448725e-01f, -4.02434707e-01f,
+     9.16679025e-01f, -3.99624228e-01f,  9.17900741e-01f, -3.96810025e-01f,
+     9.19113815e-01f, -3.93992066e-01f,  9.20318246e-01f, -3.91170382e-01f,
+     9.21514034e-01f, -3.88345063e-01f,  9.22701120e-01f, -3.85516047e-01f,
+     9.23879564e-01f, -3.82683426e-01f,  9.25049245e-01f, -3.79847199e-01f,
+     9.26210225e-01f, -3.77007395e-01f,  9.27362561e-01f, -3.74164015e-01f,
+     9.28506076e-01f, -3.71317148e-01f,  9.29640889e-01f, -3.68466765e-01f,
+     9.30767000e-01f, -3.65612924e-01f,  9.31884289e-01f, -3.62755656e-01f,
+     9.32992816e-01f, -3.59894961e-01f,  9.34092581e-01f, -3.57030869e-01f,
+     9.35183525e-01f, -3.54163438e-01f,  9.36265707e-01f, -3.51292640e-01f,
+     9.37339067e-01f, -3.48418564e-01f,  9.38403606e-01f, -3.45541209e-01f,
+     9.39459264e-01f, -3.42660576e-01f,  9.40506101e-01f, -3.39776754e-01f,
+     9.41544116e-01f, -3.36889714e-01f,  9.42573249e-01f, -3.33999485e-01f,
+     9.43593502e-01f, -3.31106156e-01f,  9.44604874e-01f, -3.28209668e-01f,
+     9.45607364e-01f, -3.25310111e-01f,  9.46600974e-01f, -3.22407484e-01f,
+     9.47585642e-01f, -3.19501847e-01f,  9.48561430e-01f, -3.16593170e-01f,
+     9.49528277e-01f, -3.13681543e-01f,  9.50486124e-01f, -3.10766935e-01f,
+     9.51434970e-01f, -3.07849854e-01f,  9.52374935e-01f, -3.04929435e-01f,
+     9.53305960e-01f, -3.02006155e-01f,  9.54228044e-01f, -2.99080014e-01f,
+     9.55141127e-01f, -2.96151072e-01f,  9.56045210e-01f, -2.93219358e-01f,
+     9.56940293e-01f, -2.90284842e-01f,  9.57826376e-01f, -2.87347615e-01f,
+     9.58703399e-01f, -2.84407705e-01f,  9.59571481e-01f, -2.81465083e-01f,
+     9.60430503e-01f, -2.78519839e-01f,  9.61280465e-01f, -2.75571942e-01f,
+     9.62121367e-01f, -2.72621483e-01f,  9.62953210e-01f, -2.69668430e-01f,
+     9.63776052e-01f, -2.66712874e-01f,  9.64589775e-01f, -2.63754785e-01f,
+     9.65394437e-01f, -2.60794222e-01f,  9.66189981e-01f, -2.57831186e-01f,
+     9.66976464e-01f, -2.54865736e-01f,  9.67753828e-01f, -2.51897901e-01f,
+     9.68522072e-01f, -2.48927668e-01f,  9.69281197e-01f, -2.45955110e-01f,
+     9.70031261e-01f, -2.42980227e-01f,  9.70772147e-01f, -2.40003064e-01f,
+     9.71503913e-01f, -2.37023637e-01f,  9.72226501e-01f, -2.34041974e-01f,
+     9.72939968e-01f, -2.31058121e-01f,  9.73644257e-01f, -2.28072092e-01f,
+     9.74339366e-01f, -2.25083902e-01f,  9.75025356e-01f, -2.22093612e-01f,
+     9.75702107e-01f, -2.19101220e-01f,  9.76369739e-01f, -2.16106758e-01f,
+     9.77028131e-01f, -2.13110283e-01f,  9.77677345e-01f, -2.10111782e-01f,
+     9.78317380e-01f, -2.07111314e-01f,  9.78948176e-01f, -2.04108894e-01f,
+     9.79569793e-01f, -2.01104566e-01f,  9.80182171e-01f, -1.98098332e-01f,
+     9.80785310e-01f, -1.95090234e-01f,  9.81379211e-01f, -1.92080289e-01f,
+     9.81963873e-01f, -1.89068556e-01f,  9.82539296e-01f, -1.86055034e-01f,
+     9.83105540e-01f, -1.83039755e-01f,  9.83662426e-01f, -1.80022761e-01f,
+     9.84210134e-01f, -1.77004069e-01f,  9.84748542e-01f, -1.73983723e-01f,
+     9.85277653e-01f, -1.70961723e-01f,  9.85797524e-01f, -1.67938128e-01f,
+     9.86308098e-01f, -1.64912939e-01f,  9.86809433e-01f, -1.61886200e-01f,
+     9.87301469e-01f, -1.58857942e-01f,  9.87784147e-01f, -1.55828193e-01f,
+     9.88257587e-01f, -1.52796969e-01f,  9.88721728e-01f, -1.49764314e-01f,
+     9.89176571e-01f, -1.46730244e-01f,  9.89621997e-01f, -1.43695265e-01f,
+     9.90058184e-01f, -1.40658468e-01f,  9.90485072e-01f, -1.37620330e-01f,
+     9.90902603e-01f, -1.34580910e-01f,  9.91310835e-01f, -1.31540224e-01f,
+     9.91709709e-01f, -1.28498301e-01f,  9.92099285e-01f, -1.25455171e-01f,
+     9.92479503e-01f, -1.22410849e-01f,  9.92850423e-01f, -1.19365379e-01f,
+     9.93211925e-01f, -1.16318785e-01f,  9.93564129e-01f, -1.13271095e-01f,
+     9.93906975e-01f, -1.10222347e-01f,  9.94240463e-01f, -1.07172556e-01f,
+     9.94564533e-01f, -1.04121752e-01f,  9.94879305e-01f, -1.01069972e-01f,
+     9.95184720e-01f, -9.80172455e-02f,  9.95480776e-01f, -9.49635878e-02f,
+     9.95767415e-01f, -9.19090435e-02f,  9.96044695e-01f, -8.88536274e-02f,
+     9.96312618e-01f, -8.57973844e-02f,  9.96571124e-01f, -8.27403218e-02f,
+     9.96820271e-01f, -7.96824917e-02f,  9.97060061e-01f, -7.66239017e-02f,
+     9.97290432e-01f, -7.35645965e-02f,  9.97511446e-01f, -7.05045983e-02f,
+     9.97723043e-01f, -6.74439371e-02f,  9.97925282e-01f, -6.43826425e-02f,
+     9.98118103e-01f, -6.13207370e-02f,  9.98301566e-01f, -5.82582541e-02f,
+     9.98475611e-01f, -5.51952273e-02f,  9.98640239e-01f, -5.21316789e-02f,
+     9.98795450e-01f, -4.90676388e-02f,  9.98941302e-01f, -4.60031368e-02f,
+     9.99077737e-01f, -4.29382026e-02f,  9.99204755e-01f, -3.98728661e-02f,
+     9.99322414e-01f, -3.68071534e-02f,  9.99430597e-01f, -3.37410942e-02f,
+     9.99529421e-01f, -3.06747146e-02f,  9.99618828e-01f, -2.76080500e-02f,
+     9.99698818e-01f, -2.45411228e-02f,  9.99769390e-01f, -2.14739665e-02f,
+     9.99830604e-01f, -1.84066072e-02f,  9.99882340e-01f, -1.53390747e-02f,
+     9.99924719e-01f, -1.22713987e-02f,  9.99957621e-01f, -9.20360629e-03f,
+     9.99981165e-01f, -6.13572728e-03f,  9.99995291e-01f, -3.06779053e-03f,
+};
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,117 @@
+/**
+ * @file fir_filter.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "fir_filter.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define Q15_ONE         32768.0f
+#define MIN_TAPS        2           /*!< dsps_fird_init_s16() limit */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void fir_quantize(const float * h, int16_t * coeffs, uint16_t taps){
+    long q;
+    for(uint16_t n = 0; n < taps; n++){
+        q = lroundf(h[n] * Q15_ONE);
+        if(q > INT16_MAX){
+            q = INT16_MAX;
+        } else if(q < INT16_MIN){
+            q = INT16_MIN;
+        }
+        coeffs[n] = (int16_t)q;
+    }
+}
+
+/*==================[external functions definition]==========================*/
+void FIRDesignLowPass(float * h, float norm_cut, uint16_t taps){
+    float center = (taps - 1) / 2.0f;
+    float sum = 0;
+    float t;
+    for(uint16_t n = 0; n < taps; n++){
+        t = n - center;
+        h[n] = (t == 0) ? 2 * norm_cut : sinf(2 * M_PI * norm_cut * t) / (M_PI * t);
+        if(taps > 1){
+            h[n] *= 0.54f - 0.46f * cosf(2 * M_PI * n / (taps - 1));
+        }
+        sum += h[n];
+    }
+    for(uint16_t n = 0; n < taps; n++){
+        h[n] /= sum;
+    }
+}
+
+bool FIRInitQ15(fir_q15_t * filter, const int16_t * coeffs, uint16_t taps){
+    if((taps < MIN_TAPS) || (taps > FIR_MAX_TAPS)){
+        return false;
+    }
+    if(coeffs != filter->coeffs){
+        memcpy(filter->coeffs, coeffs, taps * sizeof(int16_t));
+    }
+    memset(filter->delay, 0, sizeof(filter->delay));
+    /* No decimation, Q15 x Q15 products shifted back to Q15 */
+    return dsps_fird_init_s16(&filter->fir, filter->coeffs, filter->delay, taps, 1, 0, 0) == ESP_OK;
+}
+
+bool FIRLowPassInitQ15(fir_q15_t * filter, float sample_frec, float cut_frec, uint16_t taps){
+    float h[FIR_MAX_TAPS];
+    if((sample_frec <= 0) || (cut_frec <= 0) || (cut_frec >= sample_frec / 2)){
+        return false;
+    }
+    if((taps < MIN_TAPS) || (taps > FIR_MAX_TAPS)){
+        return false;
+    }
+    FIRDesignLowPass(h, cut_frec / sample_frec, taps);
+    fir_quantize(h, filter->coeffs, taps);
+    return FIRInitQ15(filter, filter->coeffs, taps);
+}
+
+bool FIRHiPassInitQ15(fir_q15_t * filter, float sample_frec, float cut_frec, uint16_t taps){
+    float h[FIR_MAX_TAPS];
+    if((sample_frec <= 0) || (cut_frec <= 0) || (cut_frec >= sample_frec / 2)){
+        return false;
+    }
+    /* Spectral inversion needs a center tap (odd length) */
+    if((taps < 3) || (taps > FIR_MAX_TAPS) || ((taps % 2) == 0)){
+        return false;
+    }
+    FIRDesignLowPass(h, cut_frec / sample_frec, taps);
+    for(uint16_t n = 0; n < taps; n++){
+        h[n] = -h[n];
+    }
+    h[taps / 2] += 1.0f;
+    fir_quantize(h, filter->coeffs, taps);
+    return FIRInitQ15(filter, filter->coeffs, taps);
+}
+
+void FIRFilterQ15(fir_q15_t * filter, const int16_t * input_signal, int16_t * output_signal, uint16_t signal_lenght){
+    dsps_fird_s16(&filter->fir, input_signal, output_signal, signal_lenght);
+}
+
+void FIRResetQ15(fir_q15_t * filter){
+    memset(filter->delay, 0, sizeof(filter->delay));
+    filter->fir.pos = 0;
+    filter->fir.d_pos = 0;
+}
+
+void FIRDeinitQ15(fir_q15_t * filter){
+    dsps_fird_s16_aexx_free(&filter->fir);
+}
+
+/*==================[end of file]============================================*/
@@ -10,11 +10,18 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
 #include "iir_filter.h"
 #include "esp_dsp.h"
+#include "trace_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define N_SOS       5
 #define N_DELAY     2
+#define Q29_SHIFT   29
+#define Q29_ONE     (1L << Q29_SHIFT)
+#define Q15_TO_Q29  (Q29_SHIFT - 15)
 // 2nd order Butterworth 
 #define ORDER2_Q    (1 / 1.414)
 // 4th order Butterworth 
@@ -47,6 +54,14 @@ float hp2_sos_coeff[N_SOS];
 float hp4_sos_coeff[N_SOS]; 
 float hp6_sos_coeff[N_SOS]; 
 float hp8_sos_coeff[N_SOS]; 
+
+/* Q factor of each section of the Butterworth filters (index: order / 2 - 1) */
+static const float butter_q[IIR_MAX_SECTIONS][IIR_MAX_SECTIONS] = {
+    {ORDER2_Q},
+    {ORDER4_Q1, ORDER4_Q2},
+    {ORDER6_Q1, ORDER6_Q2, ORDER6_Q3},
+    {ORDER8_Q1, ORDER8_Q2, ORDER8_Q3, ORDER8_Q4}
+};
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -54,6 +69,48 @@ float hp8_sos_coeff[N_SOS];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Quantize a section to Q29 and check it (triangle of stability of the
+ * quantized a1, a2 and non-zero numerator).
+ */
+static bool iir_quantize_section(const float * sos, int32_t * coeff){
+    for(uint8_t i = 0; i < N_SOS; i++){
+        coeff[i] = (int32_t)lroundf(sos[i] * (float)Q29_ONE);
+    }
+    int64_t a1 = coeff[3];
+    int64_t a2 = coeff[4];
+    if((a2 >= Q29_ONE) || (a2 <= -Q29_ONE) || (llabs(a1) >= Q29_ONE + a2)){
+        return false;
+    }
+    return (coeff[0] != 0) || (coeff[1] != 0) || (coeff[2] != 0);
+}
+
+static bool iir_init_q15(iir_q15_t * filter, float sample_frec, float cut_frec, filter_order_t order, bool low_pass){
+    float sos[N_SOS];
+    float f;
+
+    if((sample_frec <= 0) || (cut_frec <= 0) || (cut_frec >= sample_frec / 2)){
+        return false;
+    }
+    if((order != ORDER_2) && (order != ORDER_4) && (order != ORDER_6) && (order != ORDER_8)){
+        return false;
+    }
+    f = cut_frec / sample_frec;
+    filter->sections = order / 2;
+    for(uint8_t s = 0; s < filter->sections; s++){
+        if(low_pass){
+            dsps_biquad_gen_lpf_f32(sos, f, butter_q[filter->sections - 1][s]);
+        } else{
+            dsps_biquad_gen_hpf_f32(sos, f, butter_q[filter->sections - 1][s]);
+        }
+        if(!iir_quantize_section(sos, filter->coeff[s])){
+            filter->sections = 0;
+            return false;
+        }
+    }
+    IIRResetQ15(filter);
+    return true;
+}
 
 /*==================[external functions definition]==========================*/
 
@@ -108,6 +165,7 @@ void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
 }
 
 void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
+    TRACE_ENTER(TRACE_IIR);
     switch(lp_order){
         case ORDER_2:
             dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
@@ -128,9 +186,11 @@ void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_l
             dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp8_sos_coeff, lp8_delay);
         break;
     }
+    TRACE_EXIT(TRACE_IIR);
 }
 
 void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
+    TRACE_ENTER(TRACE_IIR);
     switch(hp_order){
         case ORDER_2:
             dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
@@ -151,6 +211,56 @@ void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_le
             dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp8_sos_coeff, hp8_delay);
         break;
     }
+    TRACE_EXIT(TRACE_IIR);
+}
+
+bool LowPassInitQ15(iir_q15_t * filter, float sample_frec, float cut_frec, filter_order_t order){
+    return iir_init_q15(filter, sample_frec, cut_frec, order, true);
+}
+
+bool HiPassInitQ15(iir_q15_t * filter, float sample_frec, float cut_frec, filter_order_t order){
+    return iir_init_q15(filter, sample_frec, cut_frec, order, false);
+}
+
+void IIRFilterQ15(iir_q15_t * filter, const int16_t * input_signal, int16_t * output_signal, uint16_t signal_lenght){
+    int32_t x, y;
+    int64_t acc;
+    TRACE_ENTER(TRACE_IIR);
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        x = (int32_t)input_signal[i] << Q15_TO_Q29;
+        for(uint8_t s = 0; s < filter->sections; s++){
+            const int32_t * c = filter->coeff[s];
+            int32_t * w = filter->state[s];
+            /* |data| < 4 and sum(|coeff|) < 7: the Q58 sum can't overflow */
+            acc = (int64_t)c[0] * x + (int64_t)c[1] * w[0] + (int64_t)c[2] * w[1]
+                - (int64_t)c[3] * w[2] - (int64_t)c[4] * w[3];
+            acc = (acc + (1LL << (Q29_SHIFT - 1))) >> Q29_SHIFT;
+            if(acc > INT32_MAX){
+                acc = INT32_MAX;
+            } else if(acc < INT32_MIN){
+                acc = INT32_MIN;
+            }
+            y = (int32_t)acc;
+            w[1] = w[0];
+            w[0] = x;
+            w[3] = w[2];
+            w[2] = y;
+            x = y;
+        }
+        /* Back to Q15, rounded (in 64 bits, x may be saturated) and saturated */
+        acc = ((int64_t)x + (1LL << (Q15_TO_Q29 - 1))) >> Q15_TO_Q29;
+        if(acc > INT16_MAX){
+            acc = INT16_MAX;
+        } else if(acc < INT16_MIN){
+            acc = INT16_MIN;
+        }
+        output_signal[i] = (int16_t)acc;
+    }
+    TRACE_EXIT(TRACE_IIR);
+}
+
+void IIRResetQ15(iir_q15_t * filter){
+    memset(filter->state, 0, sizeof(filter->state));
 }
 
 /*==================[end of file]============================================*/
\ No newline at end of file
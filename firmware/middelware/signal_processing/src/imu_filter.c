@@ -0,0 +1,436 @@
+/**
+ * @file imu_filter.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "imu_filter.h"
+#include "trace_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define Q30                 30
+#define GYRO_SHIFT          (16 + 46 - Q30)     /*!< Bias corrected gyro (Q16) * gyro_scale (Q46) to Q30 */
+#define KB_SHIFT            (Q30 + 24 - 16)     /*!< Error (Q30) * kb (Q24) to bias (Q16) */
+#define PI_Q30              3373259426LL        /*!< pi in Q30 */
+#define PI_2_Q30            1686629713LL        /*!< pi / 2 in Q30 */
+#define RAD_TO_MDEG         57296               /*!< 180000 / pi */
+#define RSQRT_TABLE_START   8                   /*!< First index of the table (x = 0.25) */
+#define MIN_CORRECTION_W    (1 << 20)           /*!< Min w (Q30) of the tilt correction (not upside down) */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/* 1 / sqrt(x) at the center of each 1/32 interval of x in [0.25, 1) (Q30) */
+static const uint32_t rsqrt_table[24] = {
+    2083365155, 1970666148, 1874477404, 1791125178, 1717986918, 1653133683,
+    1595110809, 1542797797, 1495315679, 1451963954, 1412176548, 1375490368,
+    1341522400, 1309952745, 1280511845, 1252970736, 1227133513, 1202831433,
+    1179918260, 1158266544, 1137764631, 1118314230, 1099828424, 1082230034
+};
+
+/* atan(z) minimax polynomial in z² for z in [0, 1] (Q30), error 1e-5 rad */
+static const int32_t atan_coeffs[5] = {
+    1073597943, -354656388, 193424926, -91410863, 22371518
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static inline int32_t q30_mul(int32_t a, int32_t b){
+    return (int32_t)(((int64_t)a * b) >> Q30);
+}
+
+/**
+ * @brief Reciprocal square root of s > 0: 1 / sqrt(s) = y * 2^(half - 32),
+ * with y in Q30 (1 to 2). Table and 2 Newton iterations (error 3e-6).
+ */
+static uint32_t imu_rsqrt(uint64_t s, uint8_t * half){
+    uint8_t k = __builtin_clzll(s) & ~1;
+    uint32_t x = (uint32_t)((s << k) >> 32);    /* Q32, 0.25 to 1 */
+    uint32_t y = rsqrt_table[(x >> 27) - RSQRT_TABLE_START];
+    uint64_t y2, xy2;
+    for(uint8_t i = 0; i < 2; i++){
+        y2 = ((uint64_t)y * y) >> Q30;
+        xy2 = ((uint64_t)x * y2) >> 32;
+        y = (uint32_t)(((uint64_t)y * ((3ULL << Q30) - xy2)) >> 31);
+    }
+    *half = k / 2;
+    return y;
+}
+
+/**
+ * @brief Scale a vector to norm 1 (Q30), given its squared norm (> 0, in any units)
+ */
+static void imu_normalize(int32_t * v, uint8_t n, uint64_t norm2){
+    uint8_t half;
+    uint32_t y = imu_rsqrt(norm2, &half);
+    for(uint8_t i = 0; i < n; i++){
+        v[i] = (int32_t)(((int64_t)v[i] * y) >> (32 - half));
+    }
+}
+
+/**
+ * @brief Square root of v in [0, 1] (Q30)
+ */
+static int32_t imu_sqrt(int32_t v){
+    uint8_t half;
+    if(v <= 0){
+        return 0;
+    }
+    uint32_t y = imu_rsqrt((uint64_t)v, &half);
+    return (int32_t)(((int64_t)v * y) >> (47 - half));
+}
+
+/**
+ * @brief Bring the quaternion norm back to 1, it only moves slightly in each
+ * sample: 1 / sqrt(n²) ~ (3 - n²) / 2
+ */
+static void imu_renormalize(int32_t * q){
+    int64_t n2 = 0;
+    for(uint8_t i = 0; i < 4; i++){
+        n2 += (int64_t)q[i] * q[i];
+    }
+    int32_t f = (int32_t)(((3LL << Q30) - (n2 >> Q30)) >> 1);
+    for(uint8_t i = 0; i < 4; i++){
+        q[i] = q30_mul(q[i], f);
+    }
+}
+
+/**
+ * @brief Quaternion that rotates the unit vector g (Q30) onto the vertical:
+ * [1 + gz, gy, -gx, 0] normalized
+ * @return false    g is almost downwards (rotation axis undefined)
+ */
+static bool imu_tilt(const int32_t * g, int32_t * r){
+    r[0] = IMU_FILTER_Q30_ONE + g[2];
+    r[1] = g[1];
+    r[2] = -g[0];
+    r[3] = 0;
+    if(r[0] < MIN_CORRECTION_W){
+        return false;
+    }
+    imu_normalize(r, 3, (uint64_t)((int64_t)r[0] * r[0]) + (uint64_t)((int64_t)r[1] * r[1]) + (uint64_t)((int64_t)r[2] * r[2]));
+    return true;
+}
+
+/**
+ * @brief Start the orientation from the accelerometer (roll and pitch, yaw = 0)
+ */
+static void imu_start(imu_filter_t * filter, const int32_t * accel){
+    int32_t a[3] = {accel[0], accel[1], accel[2]};
+    uint64_t norm2 = (uint64_t)((int64_t)a[0] * a[0]) + (uint64_t)((int64_t)a[1] * a[1]) + (uint64_t)((int64_t)a[2] * a[2]);
+    filter->q[0] = IMU_FILTER_Q30_ONE;
+    filter->q[1] = filter->q[2] = filter->q[3] = 0;
+    if(norm2 > 0){
+        imu_normalize(a, 3, norm2);
+        if(!imu_tilt(a, filter->q)){
+            /* Upside down: half turn around x */
+            filter->q[0] = 0;
+            filter->q[1] = IMU_FILTER_Q30_ONE;
+        }
+    }
+    filter->started = true;
+}
+
+/**
+ * @brief Normalized acceleration (Q30)
+ * @return false    Norm out of the accepted range: only the gyroscope is used
+ */
+static bool imu_accel(const imu_filter_t * filter, const int16_t * sample, int32_t * a){
+    uint32_t norm2 = (uint32_t)(sample[0] * sample[0]) + (uint32_t)(sample[1] * sample[1]) + (uint32_t)(sample[2] * sample[2]);
+    if((norm2 < filter->accel_min2) || (norm2 > filter->accel_max2)){
+        return false;
+    }
+    a[0] = sample[0];
+    a[1] = sample[1];
+    a[2] = sample[2];
+    imu_normalize(a, 3, norm2);
+    return true;
+}
+
+/**
+ * @brief Gravity direction in the sensor frame (third row of the rotation matrix, Q30)
+ */
+static void imu_gravity(const int32_t * q, int32_t * v){
+    v[0] = (int32_t)(((int64_t)q[1] * q[3] - (int64_t)q[0] * q[2]) >> (Q30 - 1));
+    v[1] = (int32_t)(((int64_t)q[0] * q[1] + (int64_t)q[2] * q[3]) >> (Q30 - 1));
+    v[2] = IMU_FILTER_Q30_ONE - (int32_t)(((int64_t)q[1] * q[1] + (int64_t)q[2] * q[2]) >> (Q30 - 1));
+}
+
+/**
+ * @brief Error between the measured and the estimated gravity directions: e = a x v (Q30)
+ */
+static void imu_cross(const int32_t * a, const int32_t * v, int32_t * e){
+    e[0] = (int32_t)(((int64_t)a[1] * v[2] - (int64_t)a[2] * v[1]) >> Q30);
+    e[1] = (int32_t)(((int64_t)a[2] * v[0] - (int64_t)a[0] * v[2]) >> Q30);
+    e[2] = (int32_t)(((int64_t)a[0] * v[1] - (int64_t)a[1] * v[0]) >> Q30);
+}
+
+/**
+ * @brief Half rotation angle of the sample (bias corrected, Q30)
+ */
+static void imu_gyro(const imu_filter_t * filter, const int16_t * gyro, int32_t * h){
+    for(uint8_t i = 0; i < 3; i++){
+        h[i] = (int32_t)(((((int64_t)gyro[i] << 16) - filter->bias[i]) * filter->gyro_scale) >> GYRO_SHIFT);
+    }
+}
+
+/**
+ * @brief Integrate the rotation: q = q + q x (0, h)
+ */
+static void imu_rotate(int32_t * q, const int32_t * h){
+    int32_t w = q[0], x = q[1], y = q[2], z = q[3];
+    q[0] += (int32_t)((-(int64_t)x * h[0] - (int64_t)y * h[1] - (int64_t)z * h[2]) >> Q30);
+    q[1] += (int32_t)(((int64_t)w * h[0] + (int64_t)y * h[2] - (int64_t)z * h[1]) >> Q30);
+    q[2] += (int32_t)(((int64_t)w * h[1] - (int64_t)x * h[2] + (int64_t)z * h[0]) >> Q30);
+    q[3] += (int32_t)(((int64_t)w * h[2] + (int64_t)x * h[1] - (int64_t)y * h[0]) >> Q30);
+}
+
+static void imu_mahony(imu_filter_t * filter, const int16_t * sample){
+    int32_t a[3], v[3], e[3], h[3];
+    bool correct = imu_accel(filter, sample, a);
+    if(correct){
+        imu_gravity(filter->q, v);
+        imu_cross(a, v, e);
+        /* Integral term: bias tracking */
+        for(uint8_t i = 0; i < 3; i++){
+            filter->bias[i] -= (int32_t)(((int64_t)e[i] * filter->kb) >> KB_SHIFT);
+        }
+    }
+    imu_gyro(filter, &sample[3], h);
+    if(correct){
+        for(uint8_t i = 0; i < 3; i++){
+            h[i] += q30_mul(e[i], filter->kp);
+        }
+    }
+    imu_rotate(filter->q, h);
+}
+
+static void imu_madgwick(imu_filter_t * filter, const int16_t * sample){
+    int32_t a[3], v[3], f[3], s[4], h[3];
+    int32_t * q = filter->q;
+    int64_t norm2 = 0;
+    bool correct = imu_accel(filter, sample, a);
+    if(correct){
+        /* Gradient of the gravity error f = v - a (J' f / 2, Q27) */
+        imu_gravity(q, v);
+        for(uint8_t i = 0; i < 3; i++){
+            f[i] = v[i] - a[i];
+        }
+        s[0] = (int32_t)((-(int64_t)q[2] * f[0] + (int64_t)q[1] * f[1]) >> 33);
+        s[1] = (int32_t)(((int64_t)q[3] * f[0] + (int64_t)q[0] * f[1] - 2 * (int64_t)q[1] * f[2]) >> 33);
+        s[2] = (int32_t)((-(int64_t)q[0] * f[0] + (int64_t)q[3] * f[1] - 2 * (int64_t)q[2] * f[2]) >> 33);
+        s[3] = (int32_t)(((int64_t)q[1] * f[0] + (int64_t)q[2] * f[1]) >> 33);
+        for(uint8_t i = 0; i < 4; i++){
+            norm2 += (int64_t)s[i] * s[i];
+        }
+        correct = norm2 > 0;
+    }
+    if(correct){
+        imu_normalize(s, 4, (uint64_t)norm2);
+        /* Bias drift compensation: gyro error = 2 q* x s (vector part) */
+        int32_t we[3] = {
+            q30_mul(q[0], s[1]) - q30_mul(s[0], q[1]) - (q30_mul(q[2], s[3]) - q30_mul(q[3], s[2])),
+            q30_mul(q[0], s[2]) - q30_mul(s[0], q[2]) - (q30_mul(q[3], s[1]) - q30_mul(q[1], s[3])),
+            q30_mul(q[0], s[3]) - q30_mul(s[0], q[3]) - (q30_mul(q[1], s[2]) - q30_mul(q[2], s[1]))
+        };
+        for(uint8_t i = 0; i < 3; i++){
+            filter->bias[i] += (int32_t)(((int64_t)we[i] * filter->kb) >> (KB_SHIFT - 1));
+        }
+    }
+    imu_gyro(filter, &sample[3], h);
+    imu_rotate(q, h);
+    if(correct){
+        for(uint8_t i = 0; i < 4; i++){
+            q[i] -= q30_mul(s[i], filter->kp);
+        }
+    }
+}
+
+static void imu_complementary(imu_filter_t * filter, const int16_t * sample){
+    int32_t a[3], v[3], e[3], g[3], r[4], h[3];
+    int32_t * q = filter->q;
+    bool correct = imu_accel(filter, sample, a);
+    if(correct){
+        imu_gravity(q, v);
+        imu_cross(a, v, e);
+        for(uint8_t i = 0; i < 3; i++){
+            filter->bias[i] -= (int32_t)(((int64_t)e[i] * filter->kb) >> KB_SHIFT);
+        }
+    }
+    imu_gyro(filter, &sample[3], h);
+    imu_rotate(q, h);
+    if(!correct){
+        return;
+    }
+    /* Measured gravity in the earth frame (first two rows of the rotation matrix) */
+    int64_t xx = (int64_t)q[1] * q[1], yy = (int64_t)q[2] * q[2], zz = (int64_t)q[3] * q[3];
+    int64_t xy = (int64_t)q[1] * q[2], xz = (int64_t)q[1] * q[3], yz = (int64_t)q[2] * q[3];
+    int64_t wx = (int64_t)q[0] * q[1], wy = (int64_t)q[0] * q[2], wz = (int64_t)q[0] * q[3];
+    g[0] = (int32_t)((((1LL << 60) - 2 * (yy + zz)) >> Q30) * a[0] >> Q30)
+         + (int32_t)(((xy - wz) >> (Q30 - 1)) * a[1] >> Q30)
+         + (int32_t)(((xz + wy) >> (Q30 - 1)) * a[2] >> Q30);
+    g[1] = (int32_t)(((xy + wz) >> (Q30 - 1)) * a[0] >> Q30)
+         + (int32_t)((((1LL << 60) - 2 * (xx + zz)) >> Q30) * a[1] >> Q30)
+         + (int32_t)(((yz - wx) >> (Q30 - 1)) * a[2] >> Q30);
+    g[2] = (int32_t)(((int64_t)v[0] * a[0] + (int64_t)v[1] * a[1] + (int64_t)v[2] * a[2]) >> Q30);
+    if(!imu_tilt(g, r)){
+        return;
+    }
+    /* Fraction kp of the correction (linear interpolation from the identity), then q = r x q */
+    r[0] = IMU_FILTER_Q30_ONE + q30_mul(r[0] - IMU_FILTER_Q30_ONE, filter->kp);
+    r[1] = q30_mul(r[1], filter->kp);
+    r[2] = q30_mul(r[2], filter->kp);
+    int32_t w = q[0], x = q[1], y = q[2], z = q[3];
+    q[0] = (int32_t)(((int64_t)r[0] * w - (int64_t)r[1] * x - (int64_t)r[2] * y) >> Q30);
+    q[1] = (int32_t)(((int64_t)r[0] * x + (int64_t)r[1] * w + (int64_t)r[2] * z) >> Q30);
+    q[2] = (int32_t)(((int64_t)r[0] * y - (int64_t)r[1] * z + (int64_t)r[2] * w) >> Q30);
+    q[3] = (int32_t)(((int64_t)r[0] * z + (int64_t)r[1] * y - (int64_t)r[2] * x) >> Q30);
+}
+
+/**
+ * @brief atan2(y, x) in millidegrees (y and x in Q30)
+ */
+static int32_t imu_atan2(int32_t y, int32_t x){
+    int64_t ay = (y < 0) ? -(int64_t)y : y;
+    int64_t ax = (x < 0) ? -(int64_t)x : x;
+    bool swap = ay > ax;
+    if((ax == 0) && (ay == 0)){
+        return 0;
+    }
+    int32_t z = swap ? (int32_t)((ax << Q30) / ay) : (int32_t)((ay << Q30) / ax);
+    int32_t z2 = q30_mul(z, z);
+    int32_t p = atan_coeffs[4];
+    for(int8_t i = 3; i >= 0; i--){
+        p = atan_coeffs[i] + q30_mul(p, z2);
+    }
+    int64_t r = q30_mul(p, z);
+    if(swap){
+        r = PI_2_Q30 - r;
+    }
+    if(x < 0){
+        r = PI_Q30 - r;
+    }
+    if(y < 0){
+        r = -r;
+    }
+    return (int32_t)((r * RAD_TO_MDEG) >> Q30);
+}
+/*==================[external functions definition]==========================*/
+bool ImuFilterInit(imu_filter_t * filter, const imu_filter_config_t * config){
+    if((config->sample_freq == 0) || (config->kp < 0) || (config->ki < 0) || (config->accel_gate < 0)){
+        return false;
+    }
+    if((config->gyro_range != 250) && (config->gyro_range != 500) && (config->gyro_range != 1000) && (config->gyro_range != 2000)){
+        return false;
+    }
+    if((config->accel_range != 2) && (config->accel_range != 4) && (config->accel_range != 8) && (config->accel_range != 16)){
+        return false;
+    }
+    double dt = 1.0 / config->sample_freq;
+    double rad_lsb = config->gyro_range * M_PI / 180.0 / 32768.0;
+    double kp;
+    switch(config->type){
+        case IMU_FILTER_MAHONY:
+            kp = 0.5 * config->kp * dt;     /* Added to the half rotation angle */
+            break;
+        case IMU_FILTER_MADGWICK:
+        case IMU_FILTER_COMPLEMENTARY:
+            kp = config->kp * dt;
+            break;
+        default:
+            return false;
+    }
+    double gyro_scale = 0.5 * dt * rad_lsb * (double)(1ULL << 46);
+    double kb = config->ki * dt / rad_lsb * (double)(1 << 24);
+    if((kp > 1.0) || (gyro_scale >= INT32_MAX) || (kb >= INT32_MAX)){
+        return false;
+    }
+    memset(filter, 0, sizeof(imu_filter_t));
+    filter->type = config->type;
+    filter->kp = (int32_t)lround(kp * IMU_FILTER_Q30_ONE);
+    filter->kb = (int32_t)lround(kb);
+    filter->gyro_scale = (int32_t)lround(gyro_scale);
+    filter->bias_samples = config->bias_samples;
+    filter->q[0] = IMU_FILTER_Q30_ONE;
+
+    double one_g = 32768.0 / config->accel_range;
+    if(config->accel_gate > 0){
+        double low = one_g * (1 - config->accel_gate), high = one_g * (1 + config->accel_gate);
+        filter->accel_min2 = (low > 0) ? (uint32_t)(low * low) : 1;
+        filter->accel_max2 = (high * high < UINT32_MAX) ? (uint32_t)(high * high) : UINT32_MAX;
+    } else{
+        filter->accel_min2 = 1;
+        filter->accel_max2 = UINT32_MAX;
+    }
+    return true;
+}
+
+bool ImuFilterUpdate(imu_filter_t * filter, const int16_t * samples, uint16_t lenght){
+    TRACE_ENTER(TRACE_IMU);
+    for(uint16_t n = 0; n < lenght; n++){
+        const int16_t * sample = &samples[n * IMU_SAMPLE_VALUES];
+        if(filter->count < filter->bias_samples){
+            /* Initial bias and gravity: sensor at rest */
+            for(uint8_t i = 0; i < IMU_SAMPLE_VALUES; i++){
+                filter->sum[i] += sample[i];
+            }
+            if(++filter->count == filter->bias_samples){
+                int32_t accel[3];
+                for(uint8_t i = 0; i < 3; i++){
+                    filter->bias[i] = (int32_t)((filter->sum[3 + i] << 16) / filter->count);
+                    accel[i] = (int32_t)(filter->sum[i] / filter->count);
+                }
+                imu_start(filter, accel);
+            }
+            continue;
+        }
+        if(!filter->started){
+            int32_t accel[3] = {sample[0], sample[1], sample[2]};
+            imu_start(filter, accel);
+        }
+        switch(filter->type){
+            case IMU_FILTER_MAHONY:
+                imu_mahony(filter, sample);
+                break;
+            case IMU_FILTER_MADGWICK:
+                imu_madgwick(filter, sample);
+                break;
+            case IMU_FILTER_COMPLEMENTARY:
+                imu_complementary(filter, sample);
+                break;
+        }
+        imu_renormalize(filter->q);
+    }
+    TRACE_EXIT(TRACE_IMU);
+    return filter->started;
+}
+
+void ImuFilterSetBias(imu_filter_t * filter, const int32_t * bias){
+    memcpy(filter->bias, bias, sizeof(filter->bias));
+    filter->count = filter->bias_samples;
+}
+
+void ImuFilterEuler(const imu_filter_t * filter, int32_t * angles){
+    const int32_t * q = filter->q;
+    int32_t sin_pitch = (int32_t)(((int64_t)q[0] * q[2] - (int64_t)q[1] * q[3]) >> (Q30 - 1));
+    if(sin_pitch > IMU_FILTER_Q30_ONE){
+        sin_pitch = IMU_FILTER_Q30_ONE;
+    } else if(sin_pitch < -IMU_FILTER_Q30_ONE){
+        sin_pitch = -IMU_FILTER_Q30_ONE;
+    }
+    angles[0] = imu_atan2((int32_t)(((int64_t)q[0] * q[1] + (int64_t)q[2] * q[3]) >> (Q30 - 1)),
+                          IMU_FILTER_Q30_ONE - (int32_t)(((int64_t)q[1] * q[1] + (int64_t)q[2] * q[2]) >> (Q30 - 1)));
+    angles[1] = imu_atan2(sin_pitch, imu_sqrt(IMU_FILTER_Q30_ONE - q30_mul(sin_pitch, sin_pitch)));
+    angles[2] = imu_atan2((int32_t)(((int64_t)q[0] * q[3] + (int64_t)q[1] * q[2]) >> (Q30 - 1)),
+                          IMU_FILTER_Q30_ONE - (int32_t)(((int64_t)q[2] * q[2] + (int64_t)q[3] * q[3]) >> (Q30 - 1)));
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,191 @@
+/**
+ * @file multirate.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "multirate.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define Q15_ONE         32768.0f
+#define Q14_SHIFT       14
+#define Q14_ONE         16384.0f
+#define Q31_ONE         2147483648.0
+#define MIN_TAPS        2           /*!< dsps_fird_init_s16() limit */
+#define MIN_FACTOR      2
+#define CIC_MAX_GAIN    65536UL     /*!< ratio^stages limit (16 bit input + growth in 32 bits) */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static int16_t multirate_sat16(int32_t x){
+    if(x > INT16_MAX){
+        return INT16_MAX;
+    } else if(x < INT16_MIN){
+        return INT16_MIN;
+    }
+    return (int16_t)x;
+}
+
+/*==================[external functions definition]==========================*/
+bool DecimatorInitQ15(decimator_q15_t * dec, uint8_t factor, uint16_t taps){
+    float h[FIR_MAX_TAPS];
+    if((factor < MIN_FACTOR) || (taps < MIN_TAPS) || (taps > FIR_MAX_TAPS)){
+        return false;
+    }
+    FIRDesignLowPass(h, MULTIRATE_CUT_RATIO * 0.5f / factor, taps);
+    for(uint16_t n = 0; n < taps; n++){
+        dec->coeffs[n] = multirate_sat16(lroundf(h[n] * Q15_ONE));
+    }
+    memset(dec->delay, 0, sizeof(dec->delay));
+    dec->factor = factor;
+    return dsps_fird_init_s16(&dec->fir, dec->coeffs, dec->delay, taps, factor, 0, 0) == ESP_OK;
+}
+
+uint16_t DecimateQ15(decimator_q15_t * dec, const int16_t * input_signal, int16_t * output_signal, uint16_t input_lenght){
+    if((input_lenght % dec->factor) != 0){
+        return 0;
+    }
+    return dsps_fird_s16(&dec->fir, input_signal, output_signal, input_lenght / dec->factor);
+}
+
+void DecimatorDeinitQ15(decimator_q15_t * dec){
+    dsps_fird_s16_aexx_free(&dec->fir);
+}
+
+bool DecimatorInitF32(decimator_f32_t * dec, uint8_t factor, uint16_t taps){
+    if((factor < MIN_FACTOR) || (taps < MIN_TAPS) || (taps > FIR_MAX_TAPS)){
+        return false;
+    }
+    /* Linear phase design: coefficient order (dsps_fird_f32 applies coeffs[0] to the oldest sample) does not matter */
+    FIRDesignLowPass(dec->coeffs, MULTIRATE_CUT_RATIO * 0.5f / factor, taps);
+    dec->factor = factor;
+    return dsps_fird_init_f32(&dec->fir, dec->coeffs, dec->delay, taps, factor) == ESP_OK;
+}
+
+uint16_t DecimateF32(decimator_f32_t * dec, const float * input_signal, float * output_signal, uint16_t input_lenght){
+    if((input_lenght % dec->factor) != 0){
+        return 0;
+    }
+    return dsps_fird_f32(&dec->fir, input_signal, output_signal, input_lenght / dec->factor);
+}
+
+bool InterpolatorInitQ15(interpolator_q15_t * interp, uint8_t factor, uint16_t taps){
+    float h[FIR_MAX_TAPS];
+    uint16_t phase_taps, p, j;
+    if((factor < MIN_FACTOR) || (taps == 0)){
+        return false;
+    }
+    phase_taps = (taps + factor - 1) / factor;
+    taps = phase_taps * factor;
+    if(taps > FIR_MAX_TAPS){
+        return false;
+    }
+    FIRDesignLowPass(h, MULTIRATE_CUT_RATIO * 0.5f / factor, taps);
+    /* Phase p uses h[k * factor + p] (k = 0 newest), stored oldest first to match the history */
+    for(p = 0; p < factor; p++){
+        for(j = 0; j < phase_taps; j++){
+            interp->coeffs[p * phase_taps + j] = multirate_sat16(lroundf(h[(phase_taps - 1 - j) * factor + p] * factor * Q14_ONE));
+        }
+    }
+    interp->phase_taps = phase_taps;
+    interp->factor = factor;
+    InterpolatorResetQ15(interp);
+    return true;
+}
+
+uint16_t InterpolateQ15(interpolator_q15_t * interp, const int16_t * input_signal, int16_t * output_signal, uint16_t input_lenght){
+    uint16_t taps = interp->phase_taps;
+    uint16_t result = 0;
+    const int16_t * window;
+    const int16_t * coeffs;
+    int32_t acc;
+    for(uint16_t i = 0; i < input_lenght; i++){
+        interp->delay[interp->pos] = input_signal[i];
+        interp->delay[interp->pos + taps] = input_signal[i];
+        if(++interp->pos >= taps){
+            interp->pos = 0;
+        }
+        window = &interp->delay[interp->pos];
+        coeffs = interp->coeffs;
+        for(uint8_t p = 0; p < interp->factor; p++){
+            /* Each phase gain is ~1, Q15 x Q14 sums stay well inside 32 bits */
+            acc = 1 << (Q14_SHIFT - 1);
+            for(uint16_t j = 0; j < taps; j++){
+                acc += (int32_t)coeffs[j] * window[j];
+            }
+            output_signal[result++] = multirate_sat16(acc >> Q14_SHIFT);
+            coeffs += taps;
+        }
+    }
+    return result;
+}
+
+void InterpolatorResetQ15(interpolator_q15_t * interp){
+    memset(interp->delay, 0, sizeof(interp->delay));
+    interp->pos = 0;
+}
+
+bool CICInitQ15(cic_q15_t * cic, uint16_t ratio, uint8_t stages){
+    uint32_t gain = 1;
+    if((ratio < MIN_FACTOR) || (stages == 0) || (stages > CIC_MAX_STAGES)){
+        return false;
+    }
+    for(uint8_t k = 0; k < stages; k++){
+        gain *= ratio;
+        if(gain > CIC_MAX_GAIN){
+            return false;
+        }
+    }
+    cic->norm = (int32_t)lround(Q31_ONE / gain);
+    cic->ratio = ratio;
+    cic->stages = stages;
+    CICResetQ15(cic);
+    return true;
+}
+
+uint16_t CICDecimateQ15(cic_q15_t * cic, const int16_t * input_signal, int16_t * output_signal, uint16_t input_lenght){
+    uint16_t result = 0;
+    uint32_t v, t;
+    uint8_t k;
+    for(uint16_t i = 0; i < input_lenght; i++){
+        /* Integrators wrap around, the combs recover the exact result (modulo 2^32) */
+        cic->integ[0] += (uint32_t)(int32_t)input_signal[i];
+        for(k = 1; k < cic->stages; k++){
+            cic->integ[k] += cic->integ[k - 1];
+        }
+        if(++cic->count < cic->ratio){
+            continue;
+        }
+        cic->count = 0;
+        v = cic->integ[cic->stages - 1];
+        for(k = 0; k < cic->stages; k++){
+            t = v - cic->comb[k];
+            cic->comb[k] = v;
+            v = t;
+        }
+        output_signal[result++] = multirate_sat16((int32_t)((((int64_t)(int32_t)v * cic->norm) + (1LL << 30)) >> 31));
+    }
+    return result;
+}
+
+void CICResetQ15(cic_q15_t * cic){
+    memset(cic->integ, 0, sizeof(cic->integ));
+    memset(cic->comb, 0, sizeof(cic->comb));
+    cic->count = 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,356 @@
+/**
+ * @file online_stats.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "online_stats.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Add sample number n to a monotonic deque, dropping the elements that
+ * left the window and the ones the new sample makes useless (greater or equal
+ * for a min deque, smaller or equal for a max deque)
+ */
+static void stats_deque_push(stats_deque_t * d, float x, uint32_t n, uint16_t window, bool is_max){
+    uint16_t back;
+    if((d->count > 0) && (n - d->index[d->head] >= window)){
+        d->head = (d->head + 1) % window;
+        d->count--;
+    }
+    while(d->count > 0){
+        back = (d->head + d->count - 1) % window;
+        if(is_max ? (d->value[back] > x) : (d->value[back] < x)){
+            break;
+        }
+        d->count--;
+    }
+    back = (d->head + d->count) % window;
+    d->value[back] = x;
+    d->index[back] = n;
+    d->count++;
+}
+
+/**
+ * @brief Insert x in the sorted first samples (P² start up)
+ */
+static void p2_insert(p2_f32_t * p2, float x){
+    int8_t i = p2->count;
+    while((i > 0) && (p2->q[i - 1] > x)){
+        p2->q[i] = p2->q[i - 1];
+        i--;
+    }
+    p2->q[i] = x;
+}
+
+/**
+ * @brief Move marker i by d (-1 or 1), with the piecewise parabolic
+ * prediction or linear if it would not keep the heights ordered
+ */
+static void p2_adjust(p2_f32_t * p2, uint8_t i, int8_t d){
+    float * q = p2->q;
+    int32_t * n = p2->n;
+    float qp = q[i] + (float)d / (n[i + 1] - n[i - 1]) *
+        ((n[i] - n[i - 1] + d) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+         (n[i + 1] - n[i] - d) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+    if((qp <= q[i - 1]) || (qp >= q[i + 1])){
+        qp = q[i] + d * (q[i + d] - q[i]) / (n[i + d] - n[i]);
+    }
+    q[i] = qp;
+    n[i] += d;
+}
+
+static void p2_add(p2_f32_t * p2, float x){
+    uint8_t i, k;
+    float d;
+    if(p2->count < P2_MARKERS){
+        p2_insert(p2, x);
+        p2->count++;
+        return;
+    }
+    /* Cell of the new sample, extending the extreme markers if needed */
+    if(x < p2->q[0]){
+        p2->q[0] = x;
+        k = 0;
+    } else if(x >= p2->q[P2_MARKERS - 1]){
+        p2->q[P2_MARKERS - 1] = x;
+        k = P2_MARKERS - 2;
+    } else{
+        k = 0;
+        while(x >= p2->q[k + 1]){
+            k++;
+        }
+    }
+    for(i = k + 1; i < P2_MARKERS; i++){
+        p2->n[i]++;
+    }
+    for(i = 0; i < P2_MARKERS; i++){
+        p2->np[i] += p2->dn[i];
+    }
+    for(i = 1; i < P2_MARKERS - 1; i++){
+        d = p2->np[i] - p2->n[i];
+        if(((d >= 1) && (p2->n[i + 1] - p2->n[i] > 1)) || ((d <= -1) && (p2->n[i - 1] - p2->n[i] < -1))){
+            p2_adjust(p2, i, (d > 0) ? 1 : -1);
+        }
+    }
+    p2->count++;
+}
+
+/*==================[external functions definition]==========================*/
+void RunningStatsInit(running_stats_t * stats){
+    memset(stats, 0, sizeof(running_stats_t));
+}
+
+void RunningStatsUpdateF32(running_stats_t * stats, const float * samples, uint16_t lenght){
+    running_stats_t block;
+    float sum = 0, d;
+    uint16_t i;
+    if(lenght == 0){
+        return;
+    }
+    /* Two pass statistics of the block, then merged (no cancellation in m2) */
+    block.min = samples[0];
+    block.max = samples[0];
+    for(i = 0; i < lenght; i++){
+        sum += samples[i];
+        if(samples[i] < block.min){
+            block.min = samples[i];
+        }
+        if(samples[i] > block.max){
+            block.max = samples[i];
+        }
+    }
+    block.count = lenght;
+    block.mean = sum / lenght;
+    block.m2 = 0;
+    for(i = 0; i < lenght; i++){
+        d = samples[i] - block.mean;
+        block.m2 += d * d;
+    }
+    RunningStatsMerge(stats, &block);
+}
+
+void RunningStatsMerge(running_stats_t * stats, const running_stats_t * other){
+    uint32_t count;
+    float delta;
+    if(other->count == 0){
+        return;
+    }
+    if(stats->count == 0){
+        *stats = *other;
+        return;
+    }
+    count = stats->count + other->count;
+    delta = other->mean - stats->mean;
+    stats->mean += delta * other->count / count;
+    stats->m2 += other->m2 + delta * delta * ((float)stats->count * other->count / count);
+    stats->count = count;
+    if(other->min < stats->min){
+        stats->min = other->min;
+    }
+    if(other->max > stats->max){
+        stats->max = other->max;
+    }
+}
+
+float RunningStatsVariance(const running_stats_t * stats){
+    return (stats->count > 1) ? stats->m2 / (stats->count - 1) : 0;
+}
+
+float RunningStatsStd(const running_stats_t * stats){
+    return sqrtf(RunningStatsVariance(stats));
+}
+
+bool EMAInitF32(ema_f32_t * ema, float alpha){
+    if((alpha <= 0) || (alpha > 1)){
+        return false;
+    }
+    ema->alpha = alpha;
+    ema->value = 0;
+    ema->started = false;
+    return true;
+}
+
+float EMAProcessF32(ema_f32_t * ema, const float * input, float * output, uint16_t lenght){
+    float y = ema->value;
+    if((lenght > 0) && !ema->started){
+        y = input[0];
+        ema->started = true;
+    }
+    for(uint16_t i = 0; i < lenght; i++){
+        y += ema->alpha * (input[i] - y);
+        if(output != NULL){
+            output[i] = y;
+        }
+    }
+    ema->value = y;
+    return y;
+}
+
+bool MinMaxInitF32(minmax_f32_t * mm, uint16_t window){
+    if((window == 0) || (window > ONLINE_STATS_MAX_WINDOW)){
+        return false;
+    }
+    mm->min.head = 0;
+    mm->min.count = 0;
+    mm->max.head = 0;
+    mm->max.count = 0;
+    mm->samples = 0;
+    mm->window = window;
+    return true;
+}
+
+void MinMaxProcessF32(minmax_f32_t * mm, const float * input, float * min, float * max, uint16_t lenght){
+    for(uint16_t i = 0; i < lenght; i++){
+        stats_deque_push(&mm->min, input[i], mm->samples, mm->window, false);
+        stats_deque_push(&mm->max, input[i], mm->samples, mm->window, true);
+        mm->samples++;
+        if(min != NULL){
+            min[i] = mm->min.value[mm->min.head];
+        }
+        if(max != NULL){
+            max[i] = mm->max.value[mm->max.head];
+        }
+    }
+}
+
+bool MinMaxGetF32(const minmax_f32_t * mm, float * min, float * max){
+    if(mm->samples == 0){
+        return false;
+    }
+    *min = mm->min.value[mm->min.head];
+    *max = mm->max.value[mm->max.head];
+    return true;
+}
+
+bool RMSInitF32(rms_f32_t * rms, uint16_t window){
+    if((window == 0) || (window > ONLINE_STATS_MAX_WINDOW)){
+        return false;
+    }
+    memset(rms->squares, 0, sizeof(rms->squares));
+    rms->sum = 0;
+    rms->fresh = 0;
+    rms->window = window;
+    rms->pos = 0;
+    rms->fill = 0;
+    return true;
+}
+
+float RMSProcessF32(rms_f32_t * rms, const float * input, uint16_t lenght){
+    float sq;
+    for(uint16_t i = 0; i < lenght; i++){
+        sq = input[i] * input[i];
+        rms->sum += sq - rms->squares[rms->pos];
+        rms->fresh += sq;
+        rms->squares[rms->pos] = sq;
+        if(rms->fill < rms->window){
+            rms->fill++;
+        }
+        if(++rms->pos >= rms->window){
+            /* The fresh sum now covers exactly the window: drop accumulated rounding */
+            rms->pos = 0;
+            rms->sum = rms->fresh;
+            rms->fresh = 0;
+        }
+    }
+    if((rms->fill == 0) || (rms->sum <= 0)){
+        return 0;
+    }
+    return sqrtf(rms->sum / rms->fill);
+}
+
+float BlockRMSF32(const float * input, uint16_t lenght){
+    float sum = 0;
+    if(lenght == 0){
+        return 0;
+    }
+    dsps_dotprod_f32(input, input, &sum, lenght);
+    return sqrtf(sum / lenght);
+}
+
+void ZCRInitF32(zcr_f32_t * zcr, float level, float hysteresis){
+    zcr->level = level;
+    zcr->hysteresis = fabsf(hysteresis);
+    zcr->side = 0;
+}
+
+uint16_t ZCRProcessF32(zcr_f32_t * zcr, const float * input, uint16_t lenght){
+    uint16_t crossings = 0;
+    float high = zcr->level + zcr->hysteresis;
+    float low = zcr->level - zcr->hysteresis;
+    int8_t side;
+    for(uint16_t i = 0; i < lenght; i++){
+        if(input[i] > high){
+            side = 1;
+        } else if(input[i] < low){
+            side = -1;
+        } else{
+            continue;
+        }
+        if((zcr->side != 0) && (side != zcr->side)){
+            crossings++;
+        }
+        zcr->side = side;
+    }
+    return crossings;
+}
+
+bool P2InitF32(p2_f32_t * p2, float p){
+    if((p < 0) || (p > 1)){
+        return false;
+    }
+    p2->p = p;
+    p2->count = 0;
+    for(uint8_t i = 0; i < P2_MARKERS; i++){
+        p2->n[i] = i;
+        p2->q[i] = 0;
+    }
+    p2->np[0] = 0;
+    p2->np[1] = 2 * p;
+    p2->np[2] = 4 * p;
+    p2->np[3] = 2 + 2 * p;
+    p2->np[4] = 4;
+    p2->dn[0] = 0;
+    p2->dn[1] = p / 2;
+    p2->dn[2] = p;
+    p2->dn[3] = (1 + p) / 2;
+    p2->dn[4] = 1;
+    return true;
+}
+
+void P2ProcessF32(p2_f32_t * p2, const float * input, uint16_t lenght){
+    for(uint16_t i = 0; i < lenght; i++){
+        p2_add(p2, input[i]);
+    }
+}
+
+float P2GetF32(const p2_f32_t * p2){
+    if(p2->count == 0){
+        return 0;
+    }
+    if(p2->count < P2_MARKERS){
+        /* Still sorted samples: nearest rank */
+        return p2->q[lroundf(p2->p * (p2->count - 1))];
+    }
+    return p2->q[2];
+}
+
+/*==================[end of file]============================================*/
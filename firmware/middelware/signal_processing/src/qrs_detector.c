@@ -0,0 +1,293 @@
+/**
+ * @file qrs_detector.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "qrs_detector.h"
+/*==================[macros and definitions]=================================*/
+#define BAND_LOW_HZ         5.0f
+#define BAND_HIGH_HZ        15.0f
+#define BAND_CENTER_HZ      10.0f       /*!< Frequency where the band pass delay is compensated */
+#define WINDOW_MS           150
+#define REFRACTORY_MS       200
+#define T_WAVE_MS           360
+#define LEARN_S             2
+#define SEARCH_BACK_PCT     166         /*!< Search back after this % of the mean RR */
+#define SQUARE_SHIFT        8           /*!< Squared derivative scaling (window sum fits in 31 bits) */
+#define CHUNK               32          /*!< Samples band passed at once */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Band passed sample n - back (back < QRS_HISTORY)
+ */
+static int16_t qrs_history(const qrs_detector_t * qrs, uint32_t back){
+    return qrs->history[(qrs->n - back) % QRS_HISTORY];
+}
+
+static uint16_t qrs_samples(uint16_t sample_freq, uint16_t ms){
+    return ((uint32_t)sample_freq * ms + 500) / 1000;
+}
+
+static void qrs_thresholds(qrs_detector_t * qrs){
+    qrs->threshold1 = qrs->npki + ((qrs->spki - qrs->npki) >> 2);
+    qrs->threshold2 = qrs->threshold1 >> 1;
+}
+
+/**
+ * @brief R peak of an integrated peak: largest |band passed| sample in the
+ * integration window ending at the peak
+ */
+static uint32_t qrs_locate_r(const qrs_detector_t * qrs, uint32_t peak_n){
+    uint32_t first = qrs->n - peak_n;
+    uint32_t last = first + qrs->window + 2;
+    uint32_t r = peak_n;
+    int16_t v, best = -1;
+    if(last >= QRS_HISTORY){
+        last = QRS_HISTORY - 1;
+    }
+    if(last > qrs->n){
+        last = qrs->n;
+    }
+    for(uint32_t back = first; back <= last; back++){
+        v = qrs_history(qrs, back);
+        v = (v < 0) ? ((v == INT16_MIN) ? INT16_MAX : -v) : v;
+        if(v > best){
+            best = v;
+            r = qrs->n - back;
+        }
+    }
+    return r;
+}
+
+static void qrs_beat(qrs_detector_t * qrs, uint32_t peak_n, uint32_t r_n, int32_t slope, bool search_back,
+                     qrs_beat_t * beats, uint8_t max_beats, uint8_t * count){
+    uint32_t rr = 0;
+    if(qrs->have_qrs){
+        rr = r_n - qrs->r_n;
+        qrs->rr_sum += rr - qrs->rr[qrs->rr_pos];
+        qrs->rr[qrs->rr_pos] = rr;
+        qrs->rr_pos = (qrs->rr_pos + 1) % QRS_RR_AVERAGE;
+        if(qrs->rr_count < QRS_RR_AVERAGE){
+            qrs->rr_count++;
+        }
+    }
+    qrs->have_qrs = true;
+    qrs->qrs_n = peak_n;
+    qrs->qrs_slope = slope;
+    qrs->r_n = r_n;
+    qrs->sb_peak = 0;
+    if(*count < max_beats){
+        /* Sample numbers are counted from 1 internally; remove the band pass delay */
+        r_n = (r_n > qrs->delay) ? r_n - 1 - qrs->delay : 0;
+        beats[*count].sample = r_n;
+        beats[*count].time_ms = (uint64_t)r_n * 1000 / qrs->sample_freq;
+        beats[*count].rr_ms = (rr * 1000 + qrs->sample_freq / 2) / qrs->sample_freq;
+        beats[*count].bpm = QRSGetHeartRate(qrs);
+        beats[*count].search_back = search_back;
+        (*count)++;
+    }
+}
+
+/**
+ * @brief Classify a peak of the integrated signal
+ */
+static void qrs_peak(qrs_detector_t * qrs, int32_t peak, uint32_t peak_n, int32_t slope,
+                     qrs_beat_t * beats, uint8_t max_beats, uint8_t * count){
+    uint32_t since = peak_n - qrs->qrs_n;
+    bool after_refractory = !qrs->have_qrs || (since > qrs->refractory);
+    if((peak > qrs->threshold1) && after_refractory){
+        /* Steep enough to be a QRS and not the T wave of the last one */
+        if(!qrs->have_qrs || (since > qrs->t_wave) || (slope >= qrs->qrs_slope / 2)){
+            qrs->spki += (peak - qrs->spki) >> 3;
+            qrs_thresholds(qrs);
+            qrs_beat(qrs, peak_n, qrs_locate_r(qrs, peak_n), slope, false, beats, max_beats, count);
+            return;
+        }
+    }
+    qrs->npki += (peak - qrs->npki) >> 3;
+    qrs_thresholds(qrs);
+    /* Keep the largest noise peak as a candidate for search back */
+    if(after_refractory && (peak > qrs->threshold2) && (peak > qrs->sb_peak)){
+        qrs->sb_peak = peak;
+        qrs->sb_n = peak_n;
+        qrs->sb_r = qrs_locate_r(qrs, peak_n);
+        qrs->sb_slope = slope;
+    }
+}
+
+/**
+ * @brief Phase (rad) of the quantized filter at w (rad/sample)
+ */
+static float qrs_phase(const iir_q15_t * filter, float w){
+    float phase = 0, b_re, b_im, a_re, a_im;
+    const float q29 = 536870912.0f;
+    for(uint8_t s = 0; s < filter->sections; s++){
+        const int32_t * c = filter->coeff[s];
+        b_re = (c[0] + c[1] * cosf(w) + c[2] * cosf(2 * w)) / q29;
+        b_im = -(c[1] * sinf(w) + c[2] * sinf(2 * w)) / q29;
+        a_re = 1 + (c[3] * cosf(w) + c[4] * cosf(2 * w)) / q29;
+        a_im = -(c[3] * sinf(w) + c[4] * sinf(2 * w)) / q29;
+        phase += atan2f(b_im, b_re) - atan2f(a_im, a_re);
+    }
+    return phase;
+}
+
+/**
+ * @brief Band pass group delay (samples) at BAND_CENTER_HZ, computed once at init
+ */
+static uint16_t qrs_band_delay(const qrs_detector_t * qrs){
+    const float dw = 0.001f;
+    float w = 2 * M_PI * BAND_CENTER_HZ / qrs->sample_freq;
+    float d = qrs_phase(&qrs->hi_pass, w + dw) - qrs_phase(&qrs->hi_pass, w - dw) +
+              qrs_phase(&qrs->low_pass, w + dw) - qrs_phase(&qrs->low_pass, w - dw);
+    d = -d / (2 * dw);
+    return (d > 0) ? lroundf(d) : 0;
+}
+
+/*==================[external functions definition]==========================*/
+bool QRSInit(qrs_detector_t * qrs, uint16_t sample_freq){
+    if((sample_freq < QRS_MIN_SAMPLE_FREQ) || (sample_freq > QRS_MAX_SAMPLE_FREQ)){
+        return false;
+    }
+    if(!HiPassInitQ15(&qrs->hi_pass, sample_freq, BAND_LOW_HZ, ORDER_2) ||
+       !LowPassInitQ15(&qrs->low_pass, sample_freq, BAND_HIGH_HZ, ORDER_2)){
+        return false;
+    }
+    qrs->sample_freq = sample_freq;
+    qrs->window = qrs_samples(sample_freq, WINDOW_MS);
+    qrs->refractory = qrs_samples(sample_freq, REFRACTORY_MS);
+    qrs->t_wave = qrs_samples(sample_freq, T_WAVE_MS);
+    qrs->learn = (uint32_t)sample_freq * LEARN_S;
+    qrs->delay = qrs_band_delay(qrs);
+    QRSReset(qrs);
+    return true;
+}
+
+uint8_t QRSProcess(qrs_detector_t * qrs, const int16_t * samples, uint16_t lenght, qrs_beat_t * beats, uint8_t max_beats){
+    int16_t band[CHUNK];
+    uint16_t chunk, i;
+    int32_t d, sq, m;
+    uint8_t count = 0;
+    uint32_t pos;
+    while(lenght > 0){
+        chunk = (lenght > CHUNK) ? CHUNK : lenght;
+        IIRFilterQ15(&qrs->hi_pass, samples, band, chunk);
+        IIRFilterQ15(&qrs->low_pass, band, band, chunk);
+        for(i = 0; i < chunk; i++){
+            qrs->n++;
+            qrs->history[qrs->n % QRS_HISTORY] = band[i];
+            /* d = (2x[n] + x[n-1] - x[n-3] - 2x[n-4]) / 8 */
+            d = (2 * band[i] + qrs_history(qrs, 1) - qrs_history(qrs, 3) - 2 * qrs_history(qrs, 4)) >> 3;
+            sq = (d * d) >> SQUARE_SHIFT;
+            pos = qrs->n % qrs->window;
+            qrs->mwi_sum += sq - qrs->squares[pos];
+            qrs->squares[pos] = sq;
+            m = qrs->mwi_sum / qrs->window;
+            d = (d < 0) ? -d : d;
+
+            if(qrs->n <= qrs->learn){
+                /* Initial levels: a third of the max as signal, half the mean as noise */
+                if(m > qrs->learn_max){
+                    qrs->learn_max = m;
+                }
+                qrs->learn_sum += m;
+                if(qrs->n == qrs->learn){
+                    qrs->spki = qrs->learn_max / 3;
+                    qrs->npki = qrs->learn_sum / qrs->learn / 2;
+                    qrs_thresholds(qrs);
+                }
+                continue;
+            }
+
+            /* Peak search: rising until the signal halves or a window passes */
+            if(d > qrs->slope){
+                qrs->slope = d;
+            }
+            if(!qrs->falling){
+                if(m > qrs->peak){
+                    qrs->peak = m;
+                    qrs->peak_n = qrs->n;
+                    qrs->peak_slope = qrs->slope;
+                } else if((qrs->peak > 0) && ((m < qrs->peak / 2) || (qrs->n - qrs->peak_n >= qrs->window))){
+                    qrs_peak(qrs, qrs->peak, qrs->peak_n, qrs->peak_slope, beats, max_beats, &count);
+                    qrs->falling = true;
+                    qrs->valley = m;
+                }
+            } else if(m < qrs->valley){
+                qrs->valley = m;
+            } else if(m > qrs->valley){
+                qrs->falling = false;
+                qrs->peak = m;
+                qrs->peak_n = qrs->n;
+                qrs->slope = d;
+                qrs->peak_slope = d;
+            }
+
+            /* Search back: no beat for too long, take the best candidate */
+            if(qrs->have_qrs && (qrs->rr_count > 0) && (qrs->sb_peak > 0) &&
+               ((qrs->n - qrs->qrs_n) * 100 > (qrs->rr_sum / qrs->rr_count) * SEARCH_BACK_PCT)){
+                qrs->spki += (qrs->sb_peak - qrs->spki) >> 2;
+                qrs_thresholds(qrs);
+                qrs_beat(qrs, qrs->sb_n, qrs->sb_r, qrs->sb_slope, true, beats, max_beats, &count);
+            }
+        }
+        samples += chunk;
+        lenght -= chunk;
+    }
+    return count;
+}
+
+uint16_t QRSGetHeartRate(const qrs_detector_t * qrs){
+    if(qrs->rr_count == 0){
+        return 0;
+    }
+    return ((uint32_t)60 * qrs->sample_freq * qrs->rr_count + qrs->rr_sum / 2) / qrs->rr_sum;
+}
+
+void QRSReset(qrs_detector_t * qrs){
+    IIRResetQ15(&qrs->hi_pass);
+    IIRResetQ15(&qrs->low_pass);
+    memset(qrs->history, 0, sizeof(qrs->history));
+    memset(qrs->squares, 0, sizeof(qrs->squares));
+    memset(qrs->rr, 0, sizeof(qrs->rr));
+    qrs->mwi_sum = 0;
+    qrs->n = 0;
+    qrs->learn_max = 0;
+    qrs->learn_sum = 0;
+    qrs->peak = 0;
+    qrs->peak_n = 0;
+    qrs->peak_slope = 0;
+    qrs->slope = 0;
+    qrs->valley = 0;
+    qrs->falling = false;
+    qrs->spki = 0;
+    qrs->npki = 0;
+    qrs->threshold1 = 0;
+    qrs->threshold2 = 0;
+    qrs->have_qrs = false;
+    qrs->qrs_n = 0;
+    qrs->qrs_slope = 0;
+    qrs->r_n = 0;
+    qrs->sb_peak = 0;
+    qrs->rr_sum = 0;
+    qrs->rr_count = 0;
+    qrs->rr_pos = 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,217 @@
+/**
+ * @file stft.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "stft.h"
+#include "fft.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define MIN_LENGHT      8
+#define HANN_ENBW       1.5f        /*!< Equivalent noise bandwidth of the Hann window (bins) */
+/*==================[internal data declaration]==============================*/
+static float stft_work[2 * STFT_MAX_LENGHT];   /*!< FFT buffer (interleaved complex), shared */
+/*==================[internal functions declaration]=========================*/
+static void stft_frame(stft_t * stft);
+static void stft_features(stft_t * stft);
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Peak, centroid and band power of the last spectrum
+ */
+static void stft_features(stft_t * stft){
+    uint16_t bins = stft->cfg.lenght / 2;
+    float df = stft->cfg.sample_freq / stft->cfg.lenght;
+    float * m = stft->spectrum;
+    float sum = 0, weighted = 0, delta = 0, den;
+    uint16_t peak = 1, k, k_low, k_high;
+
+    for(k = 1; k < bins; k++){
+        if(m[k] > m[peak]){
+            peak = k;
+        }
+        sum += m[k];
+        weighted += k * m[k];
+    }
+    /* Parabolic interpolation with both neighbours */
+    if(peak + 1 < bins){
+        den = m[peak - 1] - 2 * m[peak] + m[peak + 1];
+        if(den != 0){
+            delta = 0.5f * (m[peak - 1] - m[peak + 1]) / den;
+        }
+    }
+    stft->features.peak_freq = (peak + delta) * df;
+    stft->features.peak_mag = m[peak];
+    stft->features.centroid = (sum > 0) ? (weighted / sum) * df : 0;
+
+    for(uint8_t b = 0; b < stft->cfg.n_bands; b++){
+        k_low = ceilf(stft->cfg.bands[b].f_low / df);
+        k_high = floorf(stft->cfg.bands[b].f_high / df);
+        if(k_high >= bins){
+            k_high = bins - 1;
+        }
+        sum = 0;
+        for(k = k_low; k <= k_high; k++){
+            sum += m[k] * m[k];
+        }
+        /* Magnitudes are amplitudes: A^2 / 2 per sine, spread over ENBW bins */
+        stft->features.band_power[b] = sum / (2 * HANN_ENBW);
+    }
+}
+
+/**
+ * @brief Window the ring buffer contents (oldest sample first), FFT and update results
+ */
+static void stft_frame(stft_t * stft){
+    uint16_t n = stft->cfg.lenght;
+    uint16_t bins = n / 2;
+    uint16_t tail = n - stft->pos;
+    stft_result_t result;
+
+    memset(stft_work, 0, 2 * n * sizeof(float));
+    dsps_mul_f32(&stft->ring[stft->pos], stft->window, stft_work, tail, 1, 1, 2);
+    if(stft->pos > 0){
+        dsps_mul_f32(stft->ring, &stft->window[tail], &stft_work[2 * tail], stft->pos, 1, 1, 2);
+    }
+    dsps_fft2r_fc32(stft_work, n);
+    dsps_bit_rev_fc32(stft_work, n);
+    for(uint16_t k = 0; k < bins; k++){
+        stft->spectrum[k] = sqrtf(stft_work[2 * k] * stft_work[2 * k] + stft_work[2 * k + 1] * stft_work[2 * k + 1]);
+    }
+    stft->spectrum[0] /= 2;
+    stft_features(stft);
+    stft->frames++;
+
+    result.average = NULL;
+    if(stft->cfg.averages > 0){
+        for(uint16_t k = 0; k < bins; k++){
+            stft->power_acc[k] += stft->spectrum[k] * stft->spectrum[k];
+        }
+        if(++stft->acc_count >= stft->cfg.averages){
+            for(uint16_t k = 0; k < bins; k++){
+                stft->average[k] = sqrtf(stft->power_acc[k] / stft->acc_count);
+            }
+            memset(stft->power_acc, 0, sizeof(stft->power_acc));
+            stft->acc_count = 0;
+            stft->average_ready = true;
+            result.average = stft->average;
+        }
+    }
+
+    if(stft->cfg.func_p != NULL){
+        result.spectrum = stft->spectrum;
+        result.bins = bins;
+        result.frame = stft->frames;
+        result.features = stft->features;
+        stft->cfg.func_p(&result, stft->cfg.param_p);
+    }
+}
+
+/*==================[external functions definition]==========================*/
+bool STFTInit(stft_t * stft, const stft_config_t * config){
+    uint16_t n = config->lenght;
+    if(!FFTInit()){
+        return false;
+    }
+    if((n < MIN_LENGHT) || (n > STFT_MAX_LENGHT) || (n > dsps_fft_w_table_size) || !dsp_is_power_of_two(n)){
+        return false;
+    }
+    if((config->sample_freq <= 0) || (config->n_bands > STFT_MAX_BANDS)){
+        return false;
+    }
+    /* 0 <= f_low <= f_high <= fs / 2 (negated tests also reject NaN) */
+    for(uint8_t b = 0; b < config->n_bands; b++){
+        if(!(config->bands[b].f_low >= 0) || !(config->bands[b].f_high >= config->bands[b].f_low) ||
+           !(config->bands[b].f_high <= config->sample_freq / 2)){
+            return false;
+        }
+    }
+    stft->cfg = *config;
+    switch(config->overlap){
+        case STFT_OVERLAP_50:
+            stft->hop = n / 2;
+        break;
+        case STFT_OVERLAP_75:
+            stft->hop = n / 4;
+        break;
+        default:
+            stft->hop = n;
+        break;
+    }
+    /* Hann coherent gain is 1/2: scaled by 4/n, a bin centered sine of amplitude A gives A */
+    dsps_wind_hann_f32(stft->window, n);
+    dsps_mulc_f32(stft->window, stft->window, n, 4.0f / n, 1, 1);
+    STFTReset(stft);
+    return true;
+}
+
+uint16_t STFTPush(stft_t * stft, const float * samples, uint16_t lenght){
+    uint16_t frames = 0;
+    uint16_t chunk;
+    while(lenght > 0){
+        /* Copy up to the next frame or the end of the ring buffer */
+        chunk = lenght;
+        if(chunk > stft->pending){
+            chunk = stft->pending;
+        }
+        if(chunk > stft->cfg.lenght - stft->pos){
+            chunk = stft->cfg.lenght - stft->pos;
+        }
+        memcpy(&stft->ring[stft->pos], samples, chunk * sizeof(float));
+        stft->pos += chunk;
+        if(stft->pos >= stft->cfg.lenght){
+            stft->pos = 0;
+        }
+        samples += chunk;
+        lenght -= chunk;
+        stft->pending -= chunk;
+        if(stft->pending == 0){
+            stft_frame(stft);
+            stft->pending = stft->hop;
+            frames++;
+        }
+    }
+    return frames;
+}
+
+void STFTGetSpectrum(const stft_t * stft, float * spectrum){
+    memcpy(spectrum, stft->spectrum, (stft->cfg.lenght / 2) * sizeof(float));
+}
+
+bool STFTGetAverage(const stft_t * stft, float * average){
+    if(!stft->average_ready){
+        return false;
+    }
+    memcpy(average, stft->average, (stft->cfg.lenght / 2) * sizeof(float));
+    return true;
+}
+
+void STFTGetFeatures(const stft_t * stft, stft_features_t * features){
+    *features = stft->features;
+}
+
+void STFTReset(stft_t * stft){
+    memset(stft->ring, 0, sizeof(stft->ring));
+    memset(stft->spectrum, 0, sizeof(stft->spectrum));
+    memset(stft->power_acc, 0, sizeof(stft->power_acc));
+    memset(&stft->features, 0, sizeof(stft->features));
+    stft->pos = 0;
+    stft->pending = stft->cfg.lenght;
+    stft->acc_count = 0;
+    stft->frames = 0;
+    stft->average_ready = false;
+}
+
+/*==================[end of file]============================================*/
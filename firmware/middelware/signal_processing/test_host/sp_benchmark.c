@@ -0,0 +1,380 @@
+/**
+ * @file sp_benchmark.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief Host benchmark of the signal processing middelware: ns/sample and
+ * throughput of every filter order, FFT lenght and window type.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Usage: sp_benchmark [--quick] [--csv file] [--baseline file] [--tolerance ratio]
+ * --csv saves the results (name,ns_per_sample,msamples_per_s) to be used later as
+ * --baseline: then every case slower than baseline * ratio (default 1.3) is
+ * reported and the exit code is 1. Compare only results from the same machine.
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "iir_filter.h"
+#include "fir_filter.h"
+#include "multirate.h"
+#include "fft.h"
+#include "stft.h"
+#include "dft_bank.h"
+#include "convolution.h"
+#include "online_stats.h"
+#include "qrs_detector.h"
+#include "imu_filter.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define BUFFER_LENGHT       4096
+#define RUNS                5           /*!< Timed runs of each case (best one is reported) */
+#define RUN_TIME_NS         20000000    /*!< Min duration of each run */
+#define QUICK_RUN_TIME_NS   1000000
+#define MAX_RESULTS         256
+#define NAME_LENGHT         48
+
+typedef void (*bench_func_t)(void);
+
+typedef struct {
+    char name[NAME_LENGHT];
+    double ns_per_sample;
+} bench_result_t;
+/*==================[internal data definition]===============================*/
+static uint64_t run_time = RUN_TIME_NS;
+static bench_result_t results[MAX_RESULTS];
+static uint16_t n_results = 0;
+
+/* Parameters and buffers of the case being measured */
+static uint16_t lenght;
+static filter_order_t order;
+static void (*window_func)(float * window, int len);
+static float xf[BUFFER_LENGHT], yf[2 * BUFFER_LENGHT], kernel[512];
+static int16_t xq[BUFFER_LENGHT], yq[BUFFER_LENGHT];
+static iir_q15_t iir;
+static fir_q15_t fir;
+static decimator_f32_t dec_f32;
+static decimator_q15_t dec_q15;
+static interpolator_q15_t interp;
+static cic_q15_t cic;
+static stft_t stft;
+static goertzel_f32_t goertzel_f32;
+static goertzel_q15_t goertzel_q15;
+static sdft_f32_t sdft_f32;
+static sdft_q15_t sdft_q15;
+static fast_fir_t fast_fir;
+static running_stats_t running;
+static minmax_f32_t minmax;
+static rms_f32_t rms;
+static p2_f32_t p2;
+static qrs_detector_t qrs;
+static qrs_beat_t beats[8];
+static imu_filter_t imu;
+static int16_t imu_samples[64 * IMU_SAMPLE_VALUES];
+/*==================[internal functions definition]==========================*/
+static uint64_t now_ns(void){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec;
+}
+
+/**
+ * @brief Time func (processing samples samples per call) and store the result
+ */
+static void bench(const char * name, bench_func_t func, uint32_t samples){
+    uint64_t start, elapsed, best = UINT64_MAX;
+    uint32_t calls = 1, n;
+    /* Calls per run, so each run lasts at least run_time */
+    do{
+        calls *= 2;
+        start = now_ns();
+        for(n = 0; n < calls; n++){
+            func();
+        }
+        elapsed = now_ns() - start;
+    } while(elapsed < run_time / 4);
+    calls = (uint32_t)(calls * ((double)run_time / elapsed)) + 1;
+    for(uint8_t r = 0; r < RUNS; r++){
+        start = now_ns();
+        for(n = 0; n < calls; n++){
+            func();
+        }
+        elapsed = now_ns() - start;
+        if(elapsed < best){
+            best = elapsed;
+        }
+    }
+    double ns = (double)best / calls / samples;
+    printf("%-40s %10.2f ns/sample %10.2f Msamples/s\n", name, ns, 1e3 / ns);
+    if(n_results < MAX_RESULTS){
+        snprintf(results[n_results].name, NAME_LENGHT, "%s", name);
+        results[n_results].ns_per_sample = ns;
+        n_results++;
+    }
+}
+
+static void run_lowpass_f32(void)   { LowPassFilter(xf, yf, lenght); }
+static void run_hipass_f32(void)    { HiPassFilter(xf, yf, lenght); }
+static void run_iir_q15(void)       { IIRFilterQ15(&iir, xq, yq, lenght); }
+static void run_fir_q15(void)       { FIRFilterQ15(&fir, xq, yq, lenght); }
+static void run_decimate_f32(void)  { DecimateF32(&dec_f32, xf, yf, lenght); }
+static void run_decimate_q15(void)  { DecimateQ15(&dec_q15, xq, yq, lenght); }
+static void run_interpolate(void)   { InterpolateQ15(&interp, xq, yq, lenght); }
+static void run_cic(void)           { CICDecimateQ15(&cic, xq, yq, lenght); }
+static void run_fft(void)           { FFTMagnitude(xf, yf, lenght); }
+static void run_window(void)        { window_func(yf, lenght); dsps_mul_f32(xf, yf, yf, lenght, 1, 1, 1); }
+static void run_stft(void)          { STFTPush(&stft, xf, lenght); }
+static void run_goertzel_f32(void)  { GoertzelProcessF32(&goertzel_f32, xf, lenght); }
+static void run_goertzel_q15(void)  { GoertzelProcessQ15(&goertzel_q15, xq, lenght); }
+static void run_sdft_f32(void)      { SDFTProcessF32(&sdft_f32, xf, lenght); }
+static void run_sdft_q15(void)      { SDFTProcessQ15(&sdft_q15, xq, lenght); }
+static void run_convolve(void)      { ConvolveF32(xf, 1024, kernel, lenght, yf); }
+static void run_fast_fir(void)      { FastFIRProcess(&fast_fir, xf, yf); }
+static void run_running(void)       { RunningStatsUpdateF32(&running, xf, lenght); }
+static void run_minmax(void)        { MinMaxProcessF32(&minmax, xf, yf, &yf[BUFFER_LENGHT], lenght); }
+static void run_rms(void)           { RMSProcessF32(&rms, xf, lenght); }
+static void run_p2(void)            { P2ProcessF32(&p2, xf, lenght); }
+static void run_qrs(void)           { QRSProcess(&qrs, xq, lenght, beats, 8); }
+static void run_imu(void)           { ImuFilterUpdate(&imu, imu_samples, 64); }
+
+static void bench_filters(void){
+    const filter_order_t orders[] = {ORDER_2, ORDER_4, ORDER_6, ORDER_8};
+    const uint16_t taps[] = {16, 32, 64, 128};
+    char name[NAME_LENGHT];
+    lenght = 1024;
+    for(uint8_t i = 0; i < 4; i++){
+        order = orders[i];
+        LowPassInit(1000, 40, order);
+        sprintf(name, "IIR F32 low pass order %u", order);
+        bench(name, run_lowpass_f32, lenght);
+        HiPassInit(1000, 20, order);
+        sprintf(name, "IIR F32 high pass order %u", order);
+        bench(name, run_hipass_f32, lenght);
+        LowPassInitQ15(&iir, 1000, 40, order);
+        sprintf(name, "IIR Q15 low pass order %u", order);
+        bench(name, run_iir_q15, lenght);
+        HiPassInitQ15(&iir, 1000, 20, order);
+        sprintf(name, "IIR Q15 high pass order %u", order);
+        bench(name, run_iir_q15, lenght);
+    }
+    for(uint8_t i = 0; i < 4; i++){
+        FIRLowPassInitQ15(&fir, 1000, 50, taps[i]);
+        sprintf(name, "FIR Q15 %u taps", taps[i]);
+        bench(name, run_fir_q15, lenght);
+        FIRDeinitQ15(&fir);
+    }
+    DecimatorInitF32(&dec_f32, 4, 48);
+    bench("Decimator F32 x4 48 taps (input)", run_decimate_f32, lenght);
+    DecimatorInitQ15(&dec_q15, 4, 48);
+    bench("Decimator Q15 x4 48 taps (input)", run_decimate_q15, lenght);
+    DecimatorDeinitQ15(&dec_q15);
+    InterpolatorInitQ15(&interp, 4, 48);
+    lenght = 256;
+    bench("Interpolator Q15 x4 48 taps (input)", run_interpolate, lenght);
+    lenght = 1024;
+    CICInitQ15(&cic, 16, 3);
+    bench("CIC Q15 x16 3 stages (input)", run_cic, lenght);
+}
+
+static void bench_fft(void){
+    const uint16_t lenghts[] = {8, 16, 32, 64, 128, 256, 512, 1024, 2048,
+                                12, 24, 60, 120, 250, 360, 500, 1000, 1500, 2000};
+    char name[NAME_LENGHT];
+    FFTInit();
+    for(uint8_t i = 0; i < sizeof(lenghts) / sizeof(lenghts[0]); i++){
+        lenght = lenghts[i];
+        sprintf(name, "FFT magnitude %u%s", lenght, dsp_is_power_of_two(lenght) ? "" : " (mixed radix)");
+        bench(name, run_fft, lenght);
+    }
+}
+
+static void bench_windows(void){
+    const struct {
+        const char * name;
+        void (*func)(float * window, int len);
+    } windows[] = {
+        {"Hann", dsps_wind_hann_f32},
+        {"Blackman", dsps_wind_blackman_f32},
+        {"Blackman-Harris", dsps_wind_blackman_harris_f32},
+        {"Blackman-Nuttall", dsps_wind_blackman_nuttall_f32},
+        {"Nuttall", dsps_wind_nuttall_f32},
+        {"Flat top", dsps_wind_flat_top_f32},
+    };
+    const uint16_t lenghts[] = {256, 1024, 2048};
+    char name[NAME_LENGHT];
+    for(uint8_t w = 0; w < sizeof(windows) / sizeof(windows[0]); w++){
+        window_func = windows[w].func;
+        for(uint8_t i = 0; i < sizeof(lenghts) / sizeof(lenghts[0]); i++){
+            lenght = lenghts[i];
+            sprintf(name, "Window %s %u", windows[w].name, lenght);
+            bench(name, run_window, lenght);
+        }
+    }
+}
+
+static void bench_spectral(void){
+    const float freqs[DFT_BANK_MAX_BINS] = {50, 60, 100, 120, 150, 180, 230, 300};
+    const uint16_t kernels[] = {16, 64, 256, 512};
+    stft_config_t config = {
+        .sample_freq = 1000,
+        .lenght = 256,
+        .overlap = STFT_OVERLAP_75,
+        .averages = 8,
+        .bands = {{40, 60}, {100, 200}},
+        .n_bands = 2,
+        .func_p = NULL,
+    };
+    char name[NAME_LENGHT];
+    lenght = 1024;
+    STFTInit(&stft, &config);
+    bench("STFT 256 overlap 75% (input)", run_stft, lenght);
+    GoertzelInitF32(&goertzel_f32, 1000, freqs, DFT_BANK_MAX_BINS, 200);
+    bench("Goertzel F32 8 bins", run_goertzel_f32, lenght);
+    GoertzelInitQ15(&goertzel_q15, 1000, freqs, DFT_BANK_MAX_BINS, 200);
+    bench("Goertzel Q15 8 bins", run_goertzel_q15, lenght);
+    SDFTInitF32(&sdft_f32, 1000, freqs, DFT_BANK_MAX_BINS, 200);
+    bench("Sliding DFT F32 8 bins", run_sdft_f32, lenght);
+    SDFTInitQ15(&sdft_q15, 1000, freqs, DFT_BANK_MAX_BINS, 200);
+    bench("Sliding DFT Q15 8 bins", run_sdft_q15, lenght);
+    ConvInit();
+    for(uint8_t i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++){
+        lenght = kernels[i];
+        sprintf(name, "Convolution 1024 x %u", lenght);
+        bench(name, run_convolve, 1024);
+    }
+    FastFIRInit(&fast_fir, kernel, 100);
+    bench("Fast FIR 100 taps", run_fast_fir, FastFIRBlock(&fast_fir));
+}
+
+static void bench_stats(void){
+    lenght = 1024;
+    RunningStatsInit(&running);
+    bench("Running statistics", run_running, lenght);
+    MinMaxInitF32(&minmax, 100);
+    bench("Sliding min / max 100", run_minmax, lenght);
+    RMSInitF32(&rms, 100);
+    bench("Sliding RMS 100", run_rms, lenght);
+    P2InitF32(&p2, 0.9f);
+    bench("P2 percentile", run_p2, lenght);
+    QRSInit(&qrs, 500);
+    bench("QRS detector 500 Hz", run_qrs, lenght);
+}
+
+static void bench_imu(void){
+    imu_filter_config_t config = {.sample_freq = 500, .gyro_range = 500, .accel_range = 2, .kp = 1, .ki = 0.02, .accel_gate = 0.1};
+    const char * names[] = {"IMU Mahony", "IMU Madgwick", "IMU complementary"};
+    const imu_filter_type_t types[] = {IMU_FILTER_MAHONY, IMU_FILTER_MADGWICK, IMU_FILTER_COMPLEMENTARY};
+    /* Slowly turning sensor: tilted gravity and small rotation rates */
+    for(uint16_t i = 0; i < 64; i++){
+        int16_t * sample = &imu_samples[i * IMU_SAMPLE_VALUES];
+        sample[0] = (int16_t)lrintf(4000 * sinf(i * 0.1f));
+        sample[1] = (int16_t)lrintf(3000 * cosf(i * 0.07f));
+        sample[2] = 15500;
+        sample[3] = (int16_t)(xq[i] >> 6);
+        sample[4] = (int16_t)(xq[i + 100] >> 6);
+        sample[5] = (int16_t)(xq[i + 200] >> 6);
+    }
+    for(uint8_t t = 0; t < 3; t++){
+        config.type = types[t];
+        config.kp = (types[t] == IMU_FILTER_MADGWICK) ? 0.05f : 1.0f;
+        ImuFilterInit(&imu, &config);
+        bench(names[t], run_imu, 64);
+    }
+}
+
+/**
+ * @brief Compare the results with a baseline csv file
+ * @return uint16_t Number of regressions
+ */
+static uint16_t compare_baseline(const char * file, double tolerance){
+    FILE * f = fopen(file, "r");
+    char line[128], * comma;
+    double base;
+    uint16_t regressions = 0, compared = 0;
+    if(f == NULL){
+        printf("Can't open baseline %s\n", file);
+        return 1;
+    }
+    while(fgets(line, sizeof(line), f) != NULL){
+        comma = strchr(line, ',');
+        if(comma == NULL){
+            continue;
+        }
+        *comma = '\0';
+        base = atof(comma + 1);
+        for(uint16_t i = 0; i < n_results; i++){
+            if(strcmp(results[i].name, line) != 0){
+                continue;
+            }
+            compared++;
+            if(results[i].ns_per_sample > base * tolerance){
+                printf("REGRESSION %-40s %10.2f ns/sample (baseline %.2f)\n", line, results[i].ns_per_sample, base);
+                regressions++;
+            }
+        }
+    }
+    fclose(f);
+    printf("%u cases compared with %s, %u regressions\n", compared, file, regressions);
+    return regressions;
+}
+
+static void save_csv(const char * file){
+    FILE * f = fopen(file, "w");
+    if(f == NULL){
+        printf("Can't create %s\n", file);
+        return;
+    }
+    fprintf(f, "name,ns_per_sample,msamples_per_s\n");
+    for(uint16_t i = 0; i < n_results; i++){
+        fprintf(f, "%s,%.3f,%.3f\n", results[i].name, results[i].ns_per_sample, 1e3 / results[i].ns_per_sample);
+    }
+    fclose(f);
+}
+
+/*==================[external functions definition]==========================*/
+int main(int argc, char * argv[]){
+    const char * csv = NULL, * baseline = NULL;
+    double tolerance = 1.3;
+    for(int i = 1; i < argc; i++){
+        if(strcmp(argv[i], "--quick") == 0){
+            run_time = QUICK_RUN_TIME_NS;
+        } else if((strcmp(argv[i], "--csv") == 0) && (i + 1 < argc)){
+            csv = argv[++i];
+        } else if((strcmp(argv[i], "--baseline") == 0) && (i + 1 < argc)){
+            baseline = argv[++i];
+        } else if((strcmp(argv[i], "--tolerance") == 0) && (i + 1 < argc)){
+            tolerance = atof(argv[++i]);
+        } else{
+            printf("Usage: %s [--quick] [--csv file] [--baseline file] [--tolerance ratio]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    for(uint16_t i = 0; i < BUFFER_LENGHT; i++){
+        xf[i] = 0.4f * sinf(i * 0.05f) + 0.3f * sinf(i * 0.71f) + 0.1f * sinf(i * 2.3f);
+        xq[i] = (int16_t)lrintf(xf[i] * 32767);
+    }
+    for(uint16_t i = 0; i < 512; i++){
+        kernel[i] = cosf(i * 0.11f) / (1 + i * 0.01f);
+    }
+    bench_filters();
+    bench_fft();
+    bench_windows();
+    bench_spectral();
+    bench_stats();
+    bench_imu();
+    if(csv != NULL){
+        save_csv(csv);
+    }
+    if(baseline != NULL){
+        return (compare_baseline(baseline, tolerance) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,682 @@
+/**
+ * @file sp_regression.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief Host regression tests of the signal processing middelware: outputs are
+ * compared with double precision references computed here.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "iir_filter.h"
+#include "fir_filter.h"
+#include "multirate.h"
+#include "fft.h"
+#include "stft.h"
+#include "dft_bank.h"
+#include "convolution.h"
+#include "online_stats.h"
+#include "qrs_detector.h"
+#include "imu_filter.h"
+/*==================[macros and definitions]=================================*/
+#define SIGNAL_LENGHT   4096
+#define SAMPLE_FREQ     1000.0
+#define Q15_SCALE       32768.0
+#define IMU_FREQ        500
+#define IMU_BLOCK       25          /*!< Samples per FIFO read (50 ms) */
+#define IMU_GYRO_RANGE  500         /*!< deg/s */
+#define IMU_ACCEL_LSB   16384.0     /*!< 1 g, accel_range 2 */
+/*==================[internal data declaration]==============================*/
+/* Delay lines of the floating point IIR filters (global in iir_filter.c) */
+extern float lp2_delay[2], lp4_delay[2], lp6_delay[2], lp8_delay[2];
+extern float hp2_delay[2], hp4_delay[2], hp6_delay[2], hp8_delay[2];
+/*==================[internal data definition]===============================*/
+static uint16_t failures = 0;
+static uint32_t lcg_state = 1;
+
+/* Butterworth section Q factors, as in iir_filter.c */
+static const double butter_q[4][4] = {
+    {1 / 1.414},
+    {1 / 0.765, 1 / 1.848},
+    {1 / 0.518, 1 / 1.414, 1 / 1.932},
+    {1 / 0.390, 1 / 1.111, 1 / 1.663, 1 / 1.962}
+};
+
+static float xf[SIGNAL_LENGHT], yf[SIGNAL_LENGHT], zf[2 * SIGNAL_LENGHT];
+static int16_t xq[SIGNAL_LENGHT], yq[SIGNAL_LENGHT];
+static double ref[2 * SIGNAL_LENGHT];
+/*==================[internal functions definition]==========================*/
+static void check(const char * name, double error, double tolerance){
+    bool ok = error <= tolerance;
+    printf("%-44s %s  error %.3g (tolerance %.3g)\n", name, ok ? "PASS" : "FAIL", error, tolerance);
+    if(!ok){
+        failures++;
+    }
+}
+
+/**
+ * @brief Deterministic noise in [-1, 1)
+ */
+static double noise(void){
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return (double)(int32_t)lcg_state / 2147483648.0;
+}
+
+/**
+ * @brief Test signal: tones + offset + noise, amplitude below 0.9, also in Q15
+ */
+static void test_signal(uint16_t lenght){
+    for(uint16_t i = 0; i < lenght; i++){
+        double t = i / SAMPLE_FREQ;
+        double v = 0.1 + 0.35 * sin(2 * M_PI * 3 * t) + 0.2 * sin(2 * M_PI * 60 * t + 1)
+                 + 0.1 * sin(2 * M_PI * 230 * t) + 0.1 * noise();
+        xq[i] = (int16_t)lrint(v * Q15_SCALE);
+        xf[i] = xq[i] / (float)Q15_SCALE;
+    }
+}
+
+static double max_error_f32(const float * y, const double * r, uint16_t lenght){
+    double e = 0;
+    for(uint16_t i = 0; i < lenght; i++){
+        e = fmax(e, fabs(y[i] - r[i]));
+    }
+    return e;
+}
+
+static double max_error_q15(const int16_t * y, const double * r, uint16_t lenght){
+    double e = 0;
+    for(uint16_t i = 0; i < lenght; i++){
+        e = fmax(e, fabs(y[i] - r[i] * Q15_SCALE));
+    }
+    return e;
+}
+
+/**
+ * @brief Butterworth cascade in double precision (same sections as iir_filter.c)
+ */
+static void ref_butterworth(const float * x, double * y, uint16_t lenght, double f, uint8_t order, bool low_pass){
+    uint8_t sections = order / 2;
+    for(uint16_t i = 0; i < lenght; i++){
+        y[i] = x[i];
+    }
+    for(uint8_t s = 0; s < sections; s++){
+        double w0 = 2 * M_PI * f, c = cos(w0);
+        double alpha = sin(w0) / (2 * butter_q[sections - 1][s]);
+        double a0 = 1 + alpha;
+        double b0 = (low_pass ? (1 - c) / 2 : (1 + c) / 2) / a0;
+        double b1 = (low_pass ? 1 - c : -(1 + c)) / a0;
+        double a1 = -2 * c / a0, a2 = (1 - alpha) / a0;
+        double x1 = 0, x2 = 0, y1 = 0, y2 = 0, in, out;
+        for(uint16_t i = 0; i < lenght; i++){
+            in = y[i];
+            out = b0 * in + b1 * x1 + b0 * x2 - a1 * y1 - a2 * y2;
+            x2 = x1;
+            x1 = in;
+            y2 = y1;
+            y1 = out;
+            y[i] = out;
+        }
+    }
+}
+
+static void reset_iir_f32(void){
+    float * delays[] = {lp2_delay, lp4_delay, lp6_delay, lp8_delay, hp2_delay, hp4_delay, hp6_delay, hp8_delay};
+    for(uint8_t i = 0; i < 8; i++){
+        delays[i][0] = 0;
+        delays[i][1] = 0;
+    }
+}
+
+static void test_iir(void){
+    const filter_order_t orders[] = {ORDER_2, ORDER_4, ORDER_6, ORDER_8};
+    char name[64];
+    iir_q15_t filter;
+    test_signal(SIGNAL_LENGHT);
+    for(uint8_t i = 0; i < 4; i++){
+        /* Low pass */
+        ref_butterworth(xf, ref, SIGNAL_LENGHT, 40 / SAMPLE_FREQ, orders[i], true);
+        reset_iir_f32();
+        LowPassInit(SAMPLE_FREQ, 40, orders[i]);
+        LowPassFilter(xf, yf, SIGNAL_LENGHT);
+        sprintf(name, "IIR F32 low pass order %u", orders[i]);
+        check(name, max_error_f32(yf, ref, SIGNAL_LENGHT), 1e-4);
+        LowPassInitQ15(&filter, SAMPLE_FREQ, 40, orders[i]);
+        IIRFilterQ15(&filter, xq, yq, SIGNAL_LENGHT);
+        sprintf(name, "IIR Q15 low pass order %u (LSB)", orders[i]);
+        check(name, max_error_q15(yq, ref, SIGNAL_LENGHT), 2);
+        /* High pass */
+        ref_butterworth(xf, ref, SIGNAL_LENGHT, 20 / SAMPLE_FREQ, orders[i], false);
+        reset_iir_f32();
+        HiPassInit(SAMPLE_FREQ, 20, orders[i]);
+        HiPassFilter(xf, yf, SIGNAL_LENGHT);
+        sprintf(name, "IIR F32 high pass order %u", orders[i]);
+        check(name, max_error_f32(yf, ref, SIGNAL_LENGHT), 1e-4);
+        HiPassInitQ15(&filter, SAMPLE_FREQ, 20, orders[i]);
+        IIRFilterQ15(&filter, xq, yq, SIGNAL_LENGHT);
+        sprintf(name, "IIR Q15 high pass order %u (LSB)", orders[i]);
+        check(name, max_error_q15(yq, ref, SIGNAL_LENGHT), 2);
+    }
+}
+
+/**
+ * @brief Direct form FIR in double precision: y[n] = sum h[j] * x[n - j]
+ */
+static double ref_fir(const float * x, const double * h, uint16_t taps, int32_t n){
+    double acc = 0;
+    for(uint16_t j = 0; j < taps; j++){
+        if(n - j >= 0){
+            acc += h[j] * x[n - j];
+        }
+    }
+    return acc;
+}
+
+static void test_fir(void){
+    static fir_q15_t fir;
+    static decimator_q15_t dec_q15;
+    static decimator_f32_t dec_f32;
+    static cic_q15_t cic;
+    static double h[FIR_MAX_TAPS];
+    static int16_t cic_out[SIGNAL_LENGHT];
+    uint16_t n, taps = 63;
+    test_signal(SIGNAL_LENGHT);
+
+    FIRLowPassInitQ15(&fir, SAMPLE_FREQ, 50, taps);
+    for(uint16_t j = 0; j < taps; j++){
+        h[j] = fir.coeffs[j] / Q15_SCALE;
+    }
+    for(uint16_t i = 0; i < SIGNAL_LENGHT; i++){
+        ref[i] = ref_fir(xf, h, taps, i);
+    }
+    FIRFilterQ15(&fir, xq, yq, SIGNAL_LENGHT);
+    check("FIR Q15 low pass 63 taps (LSB)", max_error_q15(yq, ref, SIGNAL_LENGHT), 2);
+    FIRDeinitQ15(&fir);
+
+    /* Decimators: output m is the filter output at input sample (m + 1) * factor - 1 */
+    DecimatorInitF32(&dec_f32, 4, 48);
+    for(uint16_t j = 0; j < 48; j++){
+        h[j] = dec_f32.coeffs[j];
+    }
+    n = DecimateF32(&dec_f32, xf, yf, SIGNAL_LENGHT);
+    for(uint16_t m = 0; m < n; m++){
+        ref[m] = ref_fir(xf, h, 48, (m + 1) * 4 - 1);
+    }
+    check("Decimator F32 factor 4", max_error_f32(yf, ref, n) + (n != SIGNAL_LENGHT / 4), 1e-5);
+
+    DecimatorInitQ15(&dec_q15, 4, 48);
+    for(uint16_t j = 0; j < 48; j++){
+        h[j] = dec_q15.coeffs[j] / Q15_SCALE;
+    }
+    n = DecimateQ15(&dec_q15, xq, yq, SIGNAL_LENGHT);
+    for(uint16_t m = 0; m < n; m++){
+        ref[m] = ref_fir(xf, h, 48, (m + 1) * 4 - 1);
+    }
+    check("Decimator Q15 factor 4 (LSB)", max_error_q15(yq, ref, n) + (n != SIGNAL_LENGHT / 4), 2);
+    DecimatorDeinitQ15(&dec_q15);
+
+    /* CIC: cascade of moving sums normalized by ratio^stages */
+    CICInitQ15(&cic, 16, 3);
+    n = CICDecimateQ15(&cic, xq, cic_out, SIGNAL_LENGHT);
+    for(uint16_t i = 0; i < SIGNAL_LENGHT; i++){
+        zf[i] = xf[i];
+    }
+    for(uint8_t s = 0; s < 3; s++){
+        double sum = 0;
+        for(uint16_t i = 0; i < SIGNAL_LENGHT; i++){
+            ref[i] = zf[i];
+        }
+        for(uint16_t i = 0; i < SIGNAL_LENGHT; i++){
+            sum += ref[i] - ((i >= 16) ? ref[i - 16] : 0);
+            zf[i] = sum / 16;
+        }
+    }
+    for(uint16_t m = 0; m < n; m++){
+        ref[m] = zf[(m + 1) * 16 - 1];
+    }
+    check("CIC Q15 ratio 16, 3 stages (LSB)", max_error_q15(cic_out, ref, n) + (n != SIGNAL_LENGHT / 16), 1);
+}
+
+/**
+ * @brief FFTMagnitude() reference: DFT of the Hann windowed signal (esp-dsp
+ * window, period lenght - 1), scaled by 8 / lenght (2 / lenght for DC)
+ */
+static void ref_fft_magnitude(const float * x, double * mag, uint16_t lenght){
+    double re, im, w;
+    for(uint16_t k = 0; k < lenght / 2; k++){
+        re = 0;
+        im = 0;
+        for(uint16_t i = 0; i < lenght; i++){
+            w = 0.5 - 0.5 * cos(2 * M_PI * i / (lenght - 1));
+            re += w * x[i] * cos(2 * M_PI * ((uint32_t)k * i % lenght) / lenght);
+            im -= w * x[i] * sin(2 * M_PI * ((uint32_t)k * i % lenght) / lenght);
+        }
+        mag[k] = sqrt(re * re + im * im) * ((k == 0) ? 2.0 : 8.0) / lenght;
+    }
+}
+
+static void test_fft(void){
+    const uint16_t lenghts[] = {8, 16, 32, 64, 128, 256, 512, 1024, 2048,
+                                12, 24, 60, 120, 250, 360, 500, 1000, 1500, 2000};
+    char name[64];
+    double peak, e;
+    FFTInit();
+    test_signal(SIGNAL_LENGHT);
+    for(uint8_t l = 0; l < sizeof(lenghts) / sizeof(lenghts[0]); l++){
+        uint16_t n = lenghts[l];
+        sprintf(name, "FFT magnitude lenght %u (relative)", n);
+        if(!FFTCheckLenght(n)){
+            check(name, INFINITY, 0);
+            continue;
+        }
+        FFTMagnitude(xf, yf, n);
+        ref_fft_magnitude(xf, ref, n);
+        peak = 0;
+        for(uint16_t k = 0; k < n / 2; k++){
+            peak = fmax(peak, ref[k]);
+        }
+        e = max_error_f32(yf, ref, n / 2) / peak;
+        check(name, e, 2e-5);
+    }
+    check("FFT rejects lenght 14 (7 factor)", FFTCheckLenght(14) ? 1 : 0, 0);
+}
+
+static void test_stft(void){
+    static stft_t stft;
+    stft_features_t features;
+    stft_config_t config = {
+        .sample_freq = SAMPLE_FREQ,
+        .lenght = 256,
+        .overlap = STFT_OVERLAP_50,
+        .averages = 0,
+        .n_bands = 0,
+        .func_p = NULL,
+    };
+    /* Tone at bin 32 (125 Hz) of amplitude 0.5: the window is scaled for amplitude */
+    for(uint16_t i = 0; i < 1024; i++){
+        xf[i] = 0.5f * sinf(2 * M_PI * 125 * i / SAMPLE_FREQ);
+    }
+    STFTInit(&stft, &config);
+    STFTPush(&stft, xf, 1024);
+    STFTGetFeatures(&stft, &features);
+    check("STFT peak frequency (Hz)", fabs(features.peak_freq - 125), 0);
+    check("STFT peak amplitude", fabs(features.peak_mag - 0.5), 0.01);
+    config.n_bands = 1;
+    config.bands[0] = (stft_band_t){.f_low = 100, .f_high = SAMPLE_FREQ};
+    check("STFT rejects band above fs / 2", STFTInit(&stft, &config) ? 1 : 0, 0);
+    config.bands[0] = (stft_band_t){.f_low = 200, .f_high = 100};
+    check("STFT rejects f_low > f_high", STFTInit(&stft, &config) ? 1 : 0, 0);
+}
+
+/**
+ * @brief Amplitude of frequency f in x[0..lenght), as the DFT bank modules report it
+ */
+static double ref_amplitude(const float * x, uint16_t lenght, double f){
+    double re = 0, im = 0;
+    for(uint16_t i = 0; i < lenght; i++){
+        re += x[i] * cos(2 * M_PI * f * i / SAMPLE_FREQ);
+        im -= x[i] * sin(2 * M_PI * f * i / SAMPLE_FREQ);
+    }
+    return 2 * sqrt(re * re + im * im) / lenght;
+}
+
+static void test_dft_bank(void){
+    static goertzel_f32_t gf;
+    static goertzel_q15_t gq;
+    static sdft_f32_t sf;
+    static sdft_q15_t sq;
+    const float freqs[] = {3, 60, 230};
+    float mag[3];
+    int16_t mag_q15[3];
+    double ef = 0, eq = 0, esf = 0, esq = 0, r;
+    test_signal(SIGNAL_LENGHT);
+    GoertzelInitF32(&gf, SAMPLE_FREQ, freqs, 3, 1000);
+    GoertzelInitQ15(&gq, SAMPLE_FREQ, freqs, 3, 1000);
+    SDFTInitF32(&sf, SAMPLE_FREQ, freqs, 3, 200);
+    SDFTInitQ15(&sq, SAMPLE_FREQ, freqs, 3, 200);
+    GoertzelProcessF32(&gf, xf, 1000);
+    GoertzelProcessQ15(&gq, xq, 1000);
+    SDFTProcessF32(&sf, xf, SIGNAL_LENGHT);
+    SDFTProcessQ15(&sq, xq, SIGNAL_LENGHT);
+    GoertzelGetMagnitudeF32(&gf, mag);
+    GoertzelGetMagnitudeQ15(&gq, mag_q15);
+    for(uint8_t b = 0; b < 3; b++){
+        r = ref_amplitude(xf, 1000, freqs[b]);
+        ef = fmax(ef, fabs(mag[b] - r));
+        eq = fmax(eq, fabs(mag_q15[b] - r * Q15_SCALE));
+    }
+    SDFTGetMagnitudeF32(&sf, mag);
+    SDFTGetMagnitudeQ15(&sq, mag_q15);
+    /* The sliding DFT tracks the nearest bin of its window (multiples of 5 Hz) */
+    for(uint8_t b = 0; b < 3; b++){
+        r = ref_amplitude(&xf[SIGNAL_LENGHT - 200], 200, round(freqs[b] / 5) * 5);
+        esf = fmax(esf, fabs(mag[b] - r));
+        esq = fmax(esq, fabs(mag_q15[b] - r * Q15_SCALE));
+    }
+    check("Goertzel F32 3 bins, block 1000", ef, 1e-4);
+    check("Goertzel Q15 3 bins, block 1000 (LSB)", eq, 4);
+    check("Sliding DFT F32 3 bins, lenght 200", esf, 1e-4);
+    check("Sliding DFT Q15 3 bins, lenght 200 (LSB)", esq, 4);
+}
+
+static void test_convolution(void){
+    static fast_fir_t fast_fir;
+    static float kernel[256];
+    const uint16_t kernels[] = {3, 32, 100, 256};
+    char name[64];
+    uint16_t signal_lenght = 1000, block, done;
+    ConvInit();
+    test_signal(SIGNAL_LENGHT);
+    for(uint16_t j = 0; j < 256; j++){
+        kernel[j] = cosf(j * 0.11f) / (1 + j * 0.01f);
+    }
+    for(uint8_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++){
+        uint16_t m = kernels[k];
+        for(uint16_t i = 0; i < signal_lenght + m - 1; i++){
+            ref[i] = 0;
+            for(uint16_t j = 0; j < m; j++){
+                if((i >= j) && (i - j < signal_lenght)){
+                    ref[i] += (double)xf[i - j] * kernel[j];
+                }
+            }
+        }
+        ConvolveF32(xf, signal_lenght, kernel, m, zf);
+        sprintf(name, "Convolution 1000 x %u", m);
+        check(name, max_error_f32(zf, ref, signal_lenght + m - 1), 1e-4);
+        for(uint16_t i = 0; i < signal_lenght - m + 1; i++){
+            ref[i] = 0;
+            for(uint16_t j = 0; j < m; j++){
+                ref[i] += (double)xf[i + j] * kernel[j];
+            }
+        }
+        CorrelateF32(xf, signal_lenght, kernel, m, zf);
+        sprintf(name, "Correlation 1000 x %u", m);
+        check(name, max_error_f32(zf, ref, signal_lenght - m + 1), 1e-4);
+    }
+    FastFIRInit(&fast_fir, kernel, 100);
+    block = FastFIRBlock(&fast_fir);
+    for(done = 0; done + block <= SIGNAL_LENGHT; done += block){
+        FastFIRProcess(&fast_fir, &xf[done], &yf[done]);
+    }
+    for(uint16_t i = 0; i < done; i++){
+        ref[i] = 0;
+        for(uint16_t j = 0; (j < 100) && (j <= i); j++){
+            ref[i] += (double)xf[i - j] * kernel[j];
+        }
+    }
+    check("Fast FIR 100 taps (overlap-save)", max_error_f32(yf, ref, done), 1e-4);
+}
+
+static void test_online_stats(void){
+    static minmax_f32_t mm;
+    static rms_f32_t rms;
+    static float mins[SIGNAL_LENGHT], maxs[SIGNAL_LENGHT];
+    running_stats_t stats;
+    p2_f32_t p2;
+    double mean = 0, var = 0, e_mm = 0, e_rms = 0, q;
+    float value;
+    test_signal(SIGNAL_LENGHT);
+    RunningStatsInit(&stats);
+    for(uint16_t i = 0; i < SIGNAL_LENGHT; i += 64){
+        RunningStatsUpdateF32(&stats, &xf[i], 64);
+    }
+    for(uint16_t i = 0; i < SIGNAL_LENGHT; i++){
+        mean += xf[i];
+    }
+    mean /= SIGNAL_LENGHT;
+    for(uint16_t i = 0; i < SIGNAL_LENGHT; i++){
+        var += (xf[i] - mean) * (xf[i] - mean);
+    }
+    var /= SIGNAL_LENGHT - 1;
+    check("Running mean", fabs(stats.mean - mean), 1e-6);
+    check("Running variance (relative)", fabs(RunningStatsVariance(&stats) - var) / var, 1e-5);
+
+    MinMaxInitF32(&mm, 50);
+    RMSInitF32(&rms, 100);
+    for(uint16_t i = 0; i < SIGNAL_LENGHT; i++){
+        MinMaxProcessF32(&mm, &xf[i], &mins[i], &maxs[i], 1);
+        value = RMSProcessF32(&rms, &xf[i], 1);
+        float mn = xf[i], mx = xf[i];
+        for(int32_t j = i; (j > (int32_t)i - 50) && (j >= 0); j--){
+            mn = fminf(mn, xf[j]);
+            mx = fmaxf(mx, xf[j]);
+        }
+        e_mm = fmax(e_mm, fmax(fabs(mn - mins[i]), fabs(mx - maxs[i])));
+        if(i >= 99){
+            q = 0;
+            for(uint16_t j = i - 99; j <= i; j++){
+                q += (double)xf[j] * xf[j];
+            }
+            e_rms = fmax(e_rms, fabs(sqrt(q / 100) - value));
+        }
+    }
+    check("Sliding min / max, window 50", e_mm, 0);
+    check("Sliding RMS, window 100", e_rms, 1e-5);
+
+    /* P² median of a uniform distribution in [-1, 1) */
+    P2InitF32(&p2, 0.5f);
+    for(uint16_t i = 0; i < SIGNAL_LENGHT; i++){
+        value = noise();
+        P2ProcessF32(&p2, &value, 1);
+    }
+    check("P2 median of uniform noise", fabs(P2GetF32(&p2)), 0.05);
+}
+
+static double gauss(double t, double center, double width){
+    return exp(-0.5 * (t - center) * (t - center) / (width * width));
+}
+
+static void test_qrs(uint16_t sample_freq){
+    static qrs_detector_t qrs;
+    static double beats_t[128];
+    qrs_beat_t beats[8];
+    char name[64];
+    uint16_t n_beats = 0, expected = 0, found = 0, false_positives = 0;
+    double t, v, error = 0, d;
+    uint32_t total = 60 * sample_freq;
+    int16_t block[50];
+
+    /* 60 s synthetic ECG (P, Q, R, S, T gaussians), RR 0.6 to 1.2 s, baseline wander and mains */
+    for(t = 0.3; t < 60; t += 0.9 + 0.3 * sin(t * 0.2)){
+        beats_t[n_beats++] = t;
+    }
+    QRSInit(&qrs, sample_freq);
+    for(uint32_t i = 0; i < total; i += 50){
+        for(uint16_t j = 0; j < 50; j++){
+            t = (double)(i + j) / sample_freq;
+            v = 0.3 * sin(2 * M_PI * 0.3 * t) + 0.05 * sin(2 * M_PI * 50 * t) + 0.02 * noise();
+            for(uint16_t b = 0; b < n_beats; b++){
+                double c = beats_t[b];
+                if(fabs(t - c) < 1){
+                    v += 0.1 * gauss(t, c - 0.16, 0.025) - 0.12 * gauss(t, c - 0.025, 0.008) + gauss(t, c, 0.01)
+                       - 0.25 * gauss(t, c + 0.025, 0.008) + 0.3 * gauss(t, c + 0.25, 0.045);
+                }
+            }
+            block[j] = (int16_t)lrint(v * 8000);
+        }
+        uint8_t count = QRSProcess(&qrs, block, 50, beats, 8);
+        for(uint8_t k = 0; k < count; k++){
+            t = (double)beats[k].sample / sample_freq;
+            d = 1;
+            for(uint16_t b = 0; b < n_beats; b++){
+                d = fmin(d, fabs(t - beats_t[b]));
+            }
+            if(d < 0.05){
+                found++;
+                error = fmax(error, d);
+            } else{
+                false_positives++;
+            }
+        }
+    }
+    /* No beats are reported while the thresholds are learned (2 s) */
+    for(uint16_t b = 0; b < n_beats; b++){
+        if((beats_t[b] > 2) && (beats_t[b] < 59.5)){
+            expected++;
+        }
+    }
+    sprintf(name, "QRS %u Hz missed beats", sample_freq);
+    check(name, (found < expected) ? expected - found : 0, 0);
+    sprintf(name, "QRS %u Hz false positives", sample_freq);
+    check(name, false_positives, 0);
+    /* The band passed maximum may fall on the Q or S wave (about 25 ms away) */
+    sprintf(name, "QRS %u Hz R peak location (ms)", sample_freq);
+    check(name, error * 1000, 30);
+}
+
+/**
+ * @brief Quaternion product c = a x b
+ */
+static void quat_mul(const double * a, const double * b, double * c){
+    double w = a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3];
+    double x = a[0] * b[1] + a[1] * b[0] + a[2] * b[3] - a[3] * b[2];
+    double y = a[0] * b[2] - a[1] * b[3] + a[2] * b[0] + a[3] * b[1];
+    double z = a[0] * b[3] + a[1] * b[2] - a[2] * b[1] + a[3] * b[0];
+    c[0] = w; c[1] = x; c[2] = y; c[3] = z;
+}
+
+/**
+ * @brief Gravity direction in the sensor frame of the orientation q (sensor to earth)
+ */
+static void quat_gravity(const double * q, double * v){
+    v[0] = 2 * (q[1] * q[3] - q[0] * q[2]);
+    v[1] = 2 * (q[0] * q[1] + q[2] * q[3]);
+    v[2] = 1 - 2 * (q[1] * q[1] + q[2] * q[2]);
+}
+
+/**
+ * @brief Rotation rate (rad/s) of the simulated motion: still, then slow and fast turns
+ */
+static void imu_motion(double t, double * w){
+    double a = (t < 3) ? 0 : (t < 13) ? 0.5 : 2;
+    w[0] = a * sin(2 * M_PI * 0.31 * t);
+    w[1] = a * 0.8 * sin(2 * M_PI * 0.53 * t + 1);
+    w[2] = a * 1.2 * sin(2 * M_PI * 0.17 * t + 2);
+}
+
+/**
+ * @brief Tilt (roll / pitch) tracking of a simulated MPU6050 at 500 Hz: gyroscope
+ * with bias and noise, accelerometer with noise (no linear acceleration)
+ * @param name      Filter name for the report
+ * @param config    Filter configuration
+ * @param calibrate true: initial bias estimation (1 s at rest), false: bias tracked from 0
+ */
+static void test_imu(const char * name, imu_filter_config_t * config, bool calibrate){
+    static imu_filter_t imu;
+    const double bias[3] = {0.03, -0.02, 0.01};     /* rad/s */
+    const double rad_lsb = IMU_GYRO_RANGE * M_PI / 180 / 32768;
+    const double dt = 1.0 / IMU_FREQ;
+    int16_t block[IMU_BLOCK * IMU_SAMPLE_VALUES];
+    double q[4] = {cos(0.2), sin(0.2), 0, 0}, r[4], w[3], v[3], ve[3], qe[4];
+    double tilt = 0, e_bias = 0, e_euler = 0, ref_angle, angle;
+    int32_t angles[3];
+    char label[64];
+    uint32_t total = 40 * IMU_FREQ;
+
+    lcg_state = 7;
+    config->sample_freq = IMU_FREQ;
+    config->gyro_range = IMU_GYRO_RANGE;
+    config->accel_range = 2;
+    config->bias_samples = calibrate ? IMU_FREQ : 0;
+    if(!ImuFilterInit(&imu, config)){
+        check(name, 1, 0);
+        return;
+    }
+    for(uint32_t i = 0; i < total; i += IMU_BLOCK){
+        for(uint16_t j = 0; j < IMU_BLOCK; j++){
+            int16_t * sample = &block[j * IMU_SAMPLE_VALUES];
+            imu_motion((double)(i + j) * dt, w);
+            quat_gravity(q, v);
+            for(uint8_t k = 0; k < 3; k++){
+                sample[k] = (int16_t)lrint(v[k] * IMU_ACCEL_LSB + 40 * noise());
+                sample[3 + k] = (int16_t)lrint((w[k] + bias[k]) / rad_lsb + 3 * noise());
+            }
+            /* Exact rotation during the sample */
+            double n = sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]) * dt / 2;
+            double s = (n > 0) ? sin(n) / (n * 2 / dt) : 0;
+            r[0] = cos(n);
+            r[1] = w[0] * s;
+            r[2] = w[1] * s;
+            r[3] = w[2] * s;
+            quat_mul(q, r, q);
+        }
+        ImuFilterUpdate(&imu, block, IMU_BLOCK);
+        if(calibrate && (i + IMU_BLOCK == IMU_FREQ)){
+            for(uint8_t k = 0; k < 3; k++){
+                e_bias = fmax(e_bias, fabs(imu.bias[k] / 65536.0 * rad_lsb - bias[k]));
+            }
+            sprintf(label, "%s initial bias (deg/s)", name);
+            check(label, e_bias * 180 / M_PI, 0.01);
+        }
+        /* Convergence time: 10 s without calibration */
+        if((double)i * dt < (calibrate ? 2 : 10)){
+            continue;
+        }
+        for(uint8_t k = 0; k < 4; k++){
+            qe[k] = imu.q[k] / (double)IMU_FILTER_Q30_ONE;
+        }
+        quat_gravity(qe, ve);
+        quat_gravity(q, v);
+        tilt = fmax(tilt, acos(fmin(1, ve[0] * v[0] + ve[1] * v[1] + ve[2] * v[2])));
+        /* Euler angles against a double computation from the same quaternion */
+        ImuFilterEuler(&imu, angles);
+        for(uint8_t k = 0; k < 3; k++){
+            if(k == 0){
+                ref_angle = atan2(2 * (qe[0] * qe[1] + qe[2] * qe[3]), 1 - 2 * (qe[1] * qe[1] + qe[2] * qe[2]));
+            } else if(k == 1){
+                ref_angle = asin(fmax(-1, fmin(1, 2 * (qe[0] * qe[2] - qe[1] * qe[3]))));
+            } else{
+                ref_angle = atan2(2 * (qe[0] * qe[3] + qe[1] * qe[2]), 1 - 2 * (qe[2] * qe[2] + qe[3] * qe[3]));
+            }
+            angle = angles[k] / 1000.0 - ref_angle * 180 / M_PI;
+            angle -= 360 * round(angle / 360);
+            e_euler = fmax(e_euler, fabs(angle));
+        }
+    }
+    sprintf(label, "%s tilt error (deg)", name);
+    check(label, tilt * 180 / M_PI, 1.5);
+    sprintf(label, "%s Euler angles (deg)", name);
+    check(label, e_euler, 0.01);
+    e_bias = 0;
+    for(uint8_t k = 0; k < 3; k++){
+        e_bias = fmax(e_bias, fabs(imu.bias[k] / 65536.0 * rad_lsb - bias[k]));
+    }
+    sprintf(label, "%s final bias (deg/s)", name);
+    check(label, e_bias * 180 / M_PI, 0.2);
+}
+
+/*==================[external functions definition]==========================*/
+int main(void){
+    test_iir();
+    test_fir();
+    test_fft();
+    test_stft();
+    test_dft_bank();
+    test_convolution();
+    test_online_stats();
+    test_qrs(250);
+    test_qrs(360);
+    test_qrs(500);
+    imu_filter_config_t imu = {.type = IMU_FILTER_MAHONY, .kp = 1, .ki = 0.02, .accel_gate = 0.1};
+    test_imu("IMU Mahony", &imu, true);
+    imu.ki = 0.2;
+    test_imu("IMU Mahony, bias tracking", &imu, false);
+    imu.type = IMU_FILTER_MADGWICK;
+    imu.kp = 0.05;
+    imu.ki = 0.005;
+    test_imu("IMU Madgwick", &imu, true);
+    imu.type = IMU_FILTER_COMPLEMENTARY;
+    imu.kp = 1;
+    imu.ki = 0.02;
+    test_imu("IMU complementary", &imu, true);
+    printf("%u failures\n", failures);
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,64 @@
+/**
+ * @file sp_rv32.c
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ * @brief Host run of the esp-dsp rv32 equivalence tests: each RISC-V kernel is
+ * compared with its ANSI version. Benchmark cases are skipped, their cycle
+ * limits only hold on the ESP32-C6.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include "unity.h"
+/*==================[macros and definitions]=================================*/
+#define MAX_CASES   32
+/*==================[internal data declaration]==============================*/
+typedef struct {
+    const char * name;
+    void (*func)(void);
+} unity_case_t;
+/*==================[internal data definition]===============================*/
+static unity_case_t cases[MAX_CASES];
+static uint16_t cases_count = 0;
+static jmp_buf case_exit;
+/*==================[external functions definition]==========================*/
+void UnityRegister(const char * name, void (*func)(void)){
+    if(cases_count < MAX_CASES){
+        cases[cases_count].name = name;
+        cases[cases_count].func = func;
+        cases_count++;
+    }
+}
+
+void UnityFail(const char * file, int line, const char * message){
+    printf("    %s:%d: %s\n", file, line, message);
+    longjmp(case_exit, 1);
+}
+
+int main(void){
+    uint16_t failures = 0, run = 0;
+
+    for(uint16_t i = 0; i < cases_count; i++){
+        if(strstr(cases[i].name, "benchmark") != NULL){
+            continue;
+        }
+        run++;
+        if(setjmp(case_exit) == 0){
+            cases[i].func();
+            printf("PASS  %s\n", cases[i].name);
+        } else {
+            printf("FAIL  %s\n", cases[i].name);
+            failures++;
+        }
+    }
+    printf("%u/%u rv32 tests passed\n", run - failures, run);
+    return (failures == 0 && run > 0) ? 0 : 1;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,21 @@
+#ifndef ESP_CPU_H_
+#define ESP_CPU_H_
+/** \brief Host stub of the ESP-IDF CPU functions used by esp-dsp and the middelware
+ *
+ * The cycle counter is emulated with the monotonic clock: on the host one
+ * "cycle" is one nanosecond.
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <time.h>
+/*==================[external functions definition]==========================*/
+static inline uint32_t esp_cpu_get_cycle_count(void){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint32_t)((uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec);
+}
+
+#endif /* ESP_CPU_H_ */
+
+/*==================[end of file]============================================*/
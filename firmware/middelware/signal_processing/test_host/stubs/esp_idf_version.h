@@ -0,0 +1,12 @@
+#ifndef ESP_IDF_VERSION_H_
+#define ESP_IDF_VERSION_H_
+/** \brief Host stub: version of the ESP-IDF the firmware is built with
+ **/
+
+/*==================[macros]=================================================*/
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION     ESP_IDF_VERSION_VAL(5, 5, 0)
+
+#endif /* ESP_IDF_VERSION_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,20 @@
+#ifndef _esp_log_h_
+#define _esp_log_h_
+/** \brief Host stub of the ESP-IDF log macros (replaces the esp-dsp include_sim one)
+ *
+ * Errors, warnings and info messages go to stdout, debug and verbose ones are dropped.
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+/*==================[macros]=================================================*/
+#define ESP_LOGE(tag, format, ...)  printf("E %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...)  printf("W %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...)  printf("I %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...)
+#define ESP_LOGV(tag, format, ...)
+
+#endif /* _esp_log_h_ */
+
+/*==================[end of file]============================================*/
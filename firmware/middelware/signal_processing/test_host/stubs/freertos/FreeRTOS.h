@@ -0,0 +1,17 @@
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+/** \brief Host stub of the FreeRTOS definitions used by the esp-dsp module tests
+ *
+ * The host tests run in a single thread: critical sections are empty.
+ **/
+
+/*==================[macros]=================================================*/
+#define portMUX_INITIALIZER_UNLOCKED    0
+#define portENTER_CRITICAL(mux)         ((void)(mux))
+#define portEXIT_CRITICAL(mux)          ((void)(mux))
+/*==================[typedef]================================================*/
+typedef int portMUX_TYPE;
+
+#endif /* FREERTOS_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,11 @@
+#ifndef FREERTOS_PORTABLE_H_
+#define FREERTOS_PORTABLE_H_
+/** \brief Host stub: everything needed is in FreeRTOS.h
+ **/
+
+/*==================[inclusions]=============================================*/
+#include "freertos/FreeRTOS.h"
+
+#endif /* FREERTOS_PORTABLE_H_ */
+
+/*==================[end of file]============================================*/
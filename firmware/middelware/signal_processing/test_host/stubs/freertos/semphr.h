@@ -0,0 +1,11 @@
+#ifndef FREERTOS_SEMPHR_H_
+#define FREERTOS_SEMPHR_H_
+/** \brief Host stub: everything needed is in FreeRTOS.h
+ **/
+
+/*==================[inclusions]=============================================*/
+#include "freertos/FreeRTOS.h"
+
+#endif /* FREERTOS_SEMPHR_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,11 @@
+#ifndef FREERTOS_TASK_H_
+#define FREERTOS_TASK_H_
+/** \brief Host stub: everything needed is in FreeRTOS.h
+ **/
+
+/*==================[inclusions]=============================================*/
+#include "freertos/FreeRTOS.h"
+
+#endif /* FREERTOS_TASK_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,11 @@
+#ifndef SDKCONFIG_H_
+#define SDKCONFIG_H_
+/** \brief Host stub of the ESP-IDF project configuration
+ *
+ * CONFIG_TRACE_ENABLE is not defined: TRACE_ENTER()/TRACE_EXIT() are empty
+ * in the host build.
+ **/
+
+#endif /* SDKCONFIG_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,52 @@
+#ifndef UNITY_H_
+#define UNITY_H_
+/** \brief Host stub of the Unity test framework used by the esp-dsp module tests
+ *
+ * TEST_CASE() registers the case at startup, sp_rv32.c runs them. A failed
+ * assertion ends the case and is reported with its file and line.
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "esp_err.h"
+/*==================[macros]=================================================*/
+#define UNITY_FLOAT_PRECISION   0.00001     /*!< Relative tolerance of TEST_ASSERT_EQUAL_FLOAT(), as in Unity */
+
+#define UNITY_CASE_(line, name)     UNITY_CASE__(line, name)
+#define UNITY_CASE__(line, name)                                                            \
+    static void unity_case_##line(void);                                                    \
+    static void __attribute__((constructor)) unity_register_##line(void){                   \
+        UnityRegister(name, unity_case_##line);                                             \
+    }                                                                                       \
+    static void unity_case_##line(void)
+#define TEST_CASE(name, tags)       UNITY_CASE_(__LINE__, name)
+
+#define TEST_ASSERT_MESSAGE(condition, message)                                             \
+    do{ if(!(condition)){ UnityFail(__FILE__, __LINE__, message); } } while(0)
+#define TEST_ASSERT(condition)      TEST_ASSERT_MESSAGE(condition, #condition)
+#define TEST_ASSERT_EQUAL(expected, actual)                                                 \
+    TEST_ASSERT_MESSAGE((expected) == (actual), #expected " == " #actual)
+#define TEST_ESP_OK(call)           TEST_ASSERT_EQUAL(ESP_OK, call)
+#define TEST_ASSERT_EQUAL_FLOAT(expected, actual)                                           \
+    TEST_ASSERT_MESSAGE(fabs((double)(expected) - (double)(actual)) <=                      \
+        UNITY_FLOAT_PRECISION * fabs((double)(expected)), #expected " == " #actual)
+#define TEST_ASSERT_EQUAL_MEMORY(expected, actual, lenght)                                  \
+    TEST_ASSERT_MESSAGE(memcmp((expected), (actual), (lenght)) == 0, #expected " == " #actual)
+#define TEST_ASSERT_EQUAL_INT16_ARRAY(expected, actual, lenght)                             \
+    TEST_ASSERT_EQUAL_MEMORY(expected, actual, (lenght) * sizeof(int16_t))
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Add a test case to the list run by sp_rv32
+ */
+void UnityRegister(const char * name, void (*func)(void));
+
+/**
+ * @brief Report a failed assertion and end the running test case
+ */
+void UnityFail(const char * file, int line, const char * message);
+
+#endif /* UNITY_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,136 @@
+/*! @mainpage Bajo consumo
+ *
+ * @section genDesc General Description
+ *
+ * Banco de prueba del consumo promedio con escalado de frecuencia y light sleep 
+ * automático. Simula una tarea de adquisición periódica (período PERIODO_MS) que 
+ * trabaja a máxima frecuencia durante una fracción del período (ciclo de trabajo) 
+ * y recorre una tabla de ciclos de trabajo, FASE_S segundos cada uno.
+ *
+ * Mientras la tarea trabaja, GPIO_MARCA está en alto: con un osciloscopio sobre
+ * una resistencia shunt (o un medidor de corriente USB) se mide la corriente de 
+ * cada fase y se la compara con la estimada, que se envía por UART al terminar 
+ * cada fase junto con el tiempo en cada modo (PowerPrintStats()). La estimación
+ * usa las corrientes de referencia I_ACTIVA_UA e I_SLEEP_UA (no se miden en la
+ * placa): reemplazarlas por las medidas.
+ *
+ * El ciclo de trabajo máximo es 90 %: la tarea se bloquea al menos 10 ms por
+ * período para que corra la tarea IDLE (watchdog).
+ *
+ * La tecla 2 adelanta a la fase siguiente y despierta al micro (fuente de wake up
+ * por GPIO), igual que cualquier dato recibido por la UART.
+ *
+ * @section hardConn Hardware Connection
+ *
+ * |    Peripheral  |   ESP32   	|
+ * |:--------------:|:--------------|
+ * | 	Marca		| 	GPIO_23		|
+ * | 	Tecla 2		| 	GPIO_15		|
+ *
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 18/10/2026 | Document creation		                         |
+ * | 18/10/2026 | Ciclo máximo 90 % (watchdog), corrientes de referencia indicadas |
+ *
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "gpio_mcu.h"
+#include "uart_mcu.h"
+#include "power_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define GPIO_MARCA      GPIO_23     /*!< En alto mientras la tarea trabaja */
+#define GPIO_TECLA      GPIO_15     /*!< Tecla 2: pasa a la fase siguiente */
+#define PERIODO_MS      100         /*!< Período de la tarea simulada */
+#define FASE_S          20          /*!< Duración de cada ciclo de trabajo */
+#define I_ACTIVA_UA     25000       /*!< Corriente de referencia a 160 MHz (reemplazar por la medida) */
+#define I_SLEEP_UA      200         /*!< Corriente de referencia en light sleep (reemplazar por la medida) */
+/*==================[internal data definition]===============================*/
+static const uint16_t ciclos_permil[] = {900, 500, 200, 100, 50, 10};    /*!< Ciclos de trabajo (por mil, < 1000: la tarea IDLE debe correr) */
+static power_lock_t lock_cpu;       /*!< Máxima frecuencia mientras se trabaja */
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Trabajo simulado: mantiene la CPU ocupada durante el tiempo indicado.
+ */
+static void trabajar(uint32_t us){
+    int64_t fin = esp_timer_get_time() + us;
+    while(esp_timer_get_time() < fin){
+    }
+}
+
+/**
+ * @brief Tarea periódica: recorre los ciclos de trabajo e informa el consumo
+ * estimado de cada uno.
+ */
+static void tarea_ciclos(void *param){
+    char msg[128];
+    TickType_t ultimo = xTaskGetTickCount();
+    for(uint8_t fase = 0; ; fase = (fase + 1) % (sizeof(ciclos_permil) / sizeof(ciclos_permil[0]))){
+        uint32_t activo_us = ciclos_permil[fase] * PERIODO_MS;    // (permil / 1000) * PERIODO_MS * 1000 us
+        int64_t medido_us = 0;
+        int64_t inicio = esp_timer_get_time();
+        snprintf(msg, sizeof(msg), "\r\nFase %u: ciclo %u/1000, %lu us cada %u ms\r\n",
+                 fase, ciclos_permil[fase], activo_us, PERIODO_MS);
+        UartSendString(UART_PC, msg);
+        while(esp_timer_get_time() - inicio < FASE_S * 1000000LL){
+            int64_t t0 = esp_timer_get_time();
+            PowerLockAcquire(lock_cpu);
+            GPIOOn(GPIO_MARCA);
+            trabajar(activo_us);
+            GPIOOff(GPIO_MARCA);
+            PowerLockRelease(lock_cpu);
+            medido_us += esp_timer_get_time() - t0;
+            if(!GPIORead(GPIO_TECLA)){
+                while(!GPIORead(GPIO_TECLA)){
+                    vTaskDelay(pdMS_TO_TICKS(PERIODO_MS));
+                }
+                break;
+            }
+            vTaskDelayUntil(&ultimo, pdMS_TO_TICKS(PERIODO_MS));
+        }
+        // promedio = I_activa * ciclo + I_sleep * (1 - ciclo)
+        uint32_t ciclo = (medido_us * 1000) / (esp_timer_get_time() - inicio);
+        uint32_t i_prom = ((uint64_t)I_ACTIVA_UA * ciclo + (uint64_t)I_SLEEP_UA * (1000 - ciclo)) / 1000;
+        snprintf(msg, sizeof(msg), "Ciclo medido %lu/1000, corriente estimada %lu uA (con I_ACTIVA_UA e I_SLEEP_UA, no medidas)\r\n", ciclo, i_prom);
+        UartSendString(UART_PC, msg);
+        PowerPrintStats();
+    }
+}
+/*==================[external functions definition]==========================*/
+void app_main(void){
+    serial_config_t uart_cfg = {
+        .port = UART_PC,
+        .baud_rate = 115200,
+        .func_p = UART_NO_INT,
+        .param_p = NULL
+    };
+    UartInit(&uart_cfg);
+    GPIOInit(GPIO_MARCA, GPIO_OUTPUT);
+    GPIOInit(GPIO_TECLA, GPIO_INPUT);
+
+    power_config_t pm_cfg = {
+        .max_freq_mhz = POWER_FREQ_MAX_MHZ,
+        .min_freq_mhz = POWER_FREQ_MIN_MHZ,
+        .light_sleep = true
+    };
+    if(!PowerInit(&pm_cfg)){
+        UartSendString(UART_PC, "Habilitar CONFIG_PM_ENABLE en sdkconfig\r\n");
+    }
+    PowerWakeOnGpio(GPIO_TECLA, false);
+    PowerWakeOnUart(UART_PC, 3);
+    PowerLockCreate(POWER_LOCK_CPU_MAX, "trabajo", &lock_cpu);
+
+    xTaskCreate(&tarea_ciclos, "Ciclos", 4096, NULL, 5, NULL);
+}
+/*==================[end of file]============================================*/
@@ -33,6 +33,7 @@
  * |:-----------:|:-----------------------------------------------|
  * | 12/09/2023  | Creación del documento base                    |
  * | 17/06/2025  | Integración BLE, sensor óptico y control motor |
+ * | 18/10/2026  | Monitor de tareas (CPU y stack) por UART_PC    |
  *
  * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
  *
@@ -53,26 +54,36 @@
 #include "analog_io_mcu.h"
 #include "timer_mcu.h"
 #include "l293.h" 
+#include "tachometer.h"
+#include "motor_control.h"
+#include "power_mcu.h"
+#include "uart_mcu.h"
+#include "monitor_mcu.h"
 
 // === Definiciones generales ===
 #define SENSOR_GPIO GPIO_6        /*!< GPIO del sensor óptico */
 #define BAT_ADC_CH CH0            /*!< Canal ADC para batería */
+#define BAT_ADC_SAMPLES 64        /*!< Muestras promediadas en cada lectura de batería */
 #define SENSOR_SLOTS 20           /*!< Cantidad de ranuras en el disco */
-#define WHEEL_RADIUS 0.03f        /*!< Radio de la rueda en metros */
+#define WHEEL_DIAMETER_MM 60     /*!< Diámetro de la rueda en mm */
+#define SPEED_WINDOW_MS 20        /*!< Ventana de medición de velocidad (ms) */
+#define VEL_PASO_MM_S 500         /*!< Incremento de velocidad por comando 'A' (mm/s) */
+#define VEL_MAX_MM_S 6000         /*!< Velocidad máxima (mm/s) */
+#define FRENADO_PERMILLE_S 2000   /*!< Rampa de frenado: 100% de duty en 500 ms */
+#define SENSOR_GLITCH_NS 10000    /*!< Pulsos más cortos se descartan (ns) */
 #define BAT_DIV_FACTOR 2.0f       /*!< Factor de división resistiva */
 #define BAT_LOW_PERCENT 10.0f     /*!< Umbral de batería baja (en %) */
+#define MONITOR_PERIODO_MS 5000   /*!< Período del reporte de tareas por UART_PC */
 
 
 // === Variables de estado ===
-static int duty_cycle = 0;
+static int32_t velocidad_objetivo = 0;    /*!< Consigna de velocidad (mm/s) */
 static bool mantener_velocidad = false;
 static bool mantener_presionado = false;
 static bool bateria_baja = false;
 static bool cmd_frenar = false;
 
 // === Variables de velocidad ===
-static uint32_t pulse_interval_us = 0;
-static uint32_t last_pulse_time = 0;
 static int64_t last_touch_time = 0;
 
 #include "led.h" //Para control
@@ -112,28 +123,22 @@ void read_data(uint8_t *data, uint8_t length)
 
 
 /**
- * @brief ISR del sensor óptico.
+ * @brief Inicializa el tacómetro sobre el sensor óptico.
  * 
- * Se activa en flanco descendente y mide el tiempo entre ranuras.
- * Actualiza la variable `pulse_interval_us` con el intervalo en microsegundos
- * Lo que permite calcular la velocidad del longboard.
- */
-void IRAM_ATTR sensor_isr(void *arg) {
-    uint32_t now = TimerRead(TIMER_A);
-    if (now > last_pulse_time) {
-        pulse_interval_us = now - last_pulse_time;
-        last_pulse_time = now;
-    }
-}
-
-
-/**
- * @brief Inicializa el pin del sensor óptico y su interrupción.
+ * Los flancos descendentes se cuentan por hardware (PCNT), por lo que
+ * no se interrumpe a la CPU en cada ranura del disco.
  */
 void init_sensor(void) {
-    GPIOInit(SENSOR_GPIO, GPIO_INPUT);
-    GPIOActivInt(SENSOR_GPIO, sensor_isr, false, NULL);
-    GPIOInputFilter(SENSOR_GPIO);
+    static tachometer_config_t tacho_config = {
+        .gpio = SENSOR_GPIO,
+        .slots = SENSOR_SLOTS,
+        .wheel_diameter_mm = WHEEL_DIAMETER_MM,
+        .window_ms = SPEED_WINDOW_MS,
+        .glitch_ns = SENSOR_GLITCH_NS,
+        .func_p = NULL,
+        .param_p = NULL
+    };
+    TachometerInit(&tacho_config);
 }
 
 /**
@@ -156,7 +161,9 @@ void init_adc(void) {
  */
 float leerVoltajeBateria(void) {
     uint16_t val_mv = 0;
-    AnalogInputReadSingle(BAT_ADC_CH, &val_mv);
+    if (!AnalogInputReadOversampled(BAT_ADC_CH, BAT_ADC_SAMPLES, &val_mv)) {
+        AnalogInputReadSingle(BAT_ADC_CH, &val_mv);
+    }
     return (val_mv / 1000.0f) * BAT_DIV_FACTOR;
 }
 
@@ -165,27 +172,48 @@ float leerVoltajeBateria(void) {
  * @return Velocidad lineal en m/s
  */
 float calcularVelocidad() {
-    if (pulse_interval_us <= 0)
-        return 0;
-    float rps = 1000000.0f / (pulse_interval_us * SENSOR_SLOTS);
-    return 2 * M_PI * WHEEL_RADIUS * rps;
+    tachometer_measure_t medida;
+    TachometerRead(&medida);
+    return medida.speed_mm_s / 1000.0f;
+}
+
+/**
+ * @brief Realimentación del control de velocidad (mm/s).
+ */
+int32_t leerVelocidadMmS(void) {
+    tachometer_measure_t medida;
+    TachometerRead(&medida);
+    return medida.speed_mm_s;
+}
+
+/**
+ * @brief Inicializa el control de velocidad a lazo cerrado del motor.
+ */
+void init_control(void) {
+    static motor_control_config_t control_config = {
+        .motor = MOTOR_2,
+        .timer = TIMER_B,
+        .rate_hz = 1000 / SPEED_WINDOW_MS,    /* Una iteración por medición del tacómetro */
+        .kp = MOTOR_CONTROL_Q16_ONE / 8,
+        .ki = MOTOR_CONTROL_Q16_ONE / 100,
+        .kd = 0,
+        .kff = MOTOR_CONTROL_Q16_ONE / 6,
+        .slew_permille_s = FRENADO_PERMILLE_S,
+        .feedback_func = leerVelocidadMmS
+    };
+    MotorControlInit(&control_config);
 }
 
 /**
  * @brief Frenado suave y progresivo del motor.
  * 
- * Reduce la velocidad de forma escalonada y resetea los flags de control.
+ * Lleva la consigna a 0; la rampa la impone el limitador de pendiente
+ * del control de velocidad, sin bloquear la tarea.
  */
 void frenar(void) {
-    for (int i = duty_cycle; i >= 0; i -= 10) {
-        L293SetSpeed(MOTOR_2, i);
-        vTaskDelay(pdMS_TO_TICKS(50));
-    }
-
-    duty_cycle = 0;
-   
+    velocidad_objetivo = 0;
     mantener_velocidad = false;
-    L293SetSpeed(MOTOR_2, 0);
+    MotorControlBrake();
 }
 
 /**
@@ -202,10 +230,10 @@ void tarea_comandos(void *param) {
         if (mantener_velocidad) {
             LedOn(LED_3); //Prendo LED rojo para indicar que se mantiene velocidad
             mantener_velocidad=false;
-            if (duty_cycle < 255) {
-                duty_cycle += 10;
-                if (duty_cycle > 255) duty_cycle = 255;
-                L293SetSpeed(MOTOR_2, duty_cycle*100/255 );
+            if (velocidad_objetivo < VEL_MAX_MM_S) {
+                velocidad_objetivo += VEL_PASO_MM_S;
+                if (velocidad_objetivo > VEL_MAX_MM_S) velocidad_objetivo = VEL_MAX_MM_S;
+                MotorControlSetSpeed(velocidad_objetivo);
             }
         }
 
@@ -243,27 +271,24 @@ void tarea_monitoreo(void *param) {
         vTaskDelay(pdMS_TO_TICKS(1000));
     }
 }
-void funcionTimer(){
-
-}
-
 /**
  * @brief Función principal del firmware.
  * 
  * Inicializa sensores, BLE, L293 y lanza tareas.
  */
 void app_main(void) {
-    timer_config_t timer_config = {
-        .timer = TIMER_A,
-        .period = 1000000,
-        .func_p = funcionTimer,
-        .param_p = NULL
+    // Frecuencia mínima mientras las tareas esperan (el BLE impide el light sleep)
+    power_config_t pm_cfg = {
+        .max_freq_mhz = POWER_FREQ_MAX_MHZ,
+        .min_freq_mhz = POWER_FREQ_MIN_MHZ,
+        .light_sleep = false
     };
-    TimerInit(&timer_config);
-    TimerStart(TIMER_A);
+    PowerInit(&pm_cfg);
+
     LedsInit();
     L293Init();       
     init_sensor();
+    init_control();
     init_adc();
 
     ble_config_t cfg = {
@@ -274,5 +299,21 @@ void app_main(void) {
 
     xTaskCreate(tarea_comandos, "Comandos", 2048, NULL, 2, NULL);
     xTaskCreate(tarea_monitoreo, "Monitoreo", 2048, NULL, 1, NULL);
+
+    // Uso de CPU y stack libre de cada tarea por la consola, para dimensionar los stacks
+    serial_config_t uart_cfg = {
+        .port = UART_PC,
+        .baud_rate = 115200,
+        .func_p = NULL,
+        .param_p = NULL
+    };
+    UartInit(&uart_cfg);
+    monitor_config_t monitor_cfg = {
+        .output = MONITOR_UART,
+        .port = UART_PC,
+        .period_ms = MONITOR_PERIODO_MS,
+        .priority = 1
+    };
+    MonitorInit(&monitor_cfg);
 }
 
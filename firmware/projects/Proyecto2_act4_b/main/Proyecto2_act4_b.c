@@ -18,6 +18,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 12/09/2023 | Document creation		                         |
+ * | 18/10/2026 | Detección de QRS y frecuencia cardíaca         |
  *
  * @author Jean Pierre Arotcharen (Jean.arotcharen@ingenieria.uner.edu.ar)
  *
@@ -32,22 +33,25 @@
 #include "analog_io_mcu.h"
 #include "uart_mcu.h"
 #include "timer_mcu.h"
+#include "qrs_detector.h"
 
 /*==================[macros and definitions]=================================*/
 
-#define FREC_MUESTREO_AD_US 20000     // 500 Hz -> 2ms
-#define FREC_REPRO_DA_US    40000     // 250 Hz -> 4ms con esto visualizaba pausado
+#define FREC_MUESTREO_AD_US 20000     // 50 Hz -> 20ms
+#define FREC_REPRO_DA_US    4000      // 250 Hz -> 4ms: un latido cada 0,92 s (65 lpm), necesario para detectar los QRS
+#define INTERP_DA           16        // Actualizaciones del DAC por muestra (interpolación lineal)
 #define BUFFER_SIZE 231             // Tamaño de la señal ECG cargada
+#define ECG_OFFSET_MV 1650          // Nivel medio de la lectura del ADC (mV)
 
 /*==================[global variables]======================================*/
 
 TaskHandle_t ConversorAD_task_handle = NULL;   // leer CH1 y enviar UART
-TaskHandle_t ConversorDA_task_handle = NULL;   // escribir señal ECG por DAC
+qrs_detector_t qrs;                            // Detector de QRS (Pan-Tompkins)
 
 /** 
  * @brief Vector con señal digital de ECG, que se transforma en señal analógica.
  */
-const char ecg[BUFFER_SIZE] = {
+const uint8_t ecg[BUFFER_SIZE] = {
 17,17,17,17,17,17,17,17,17,17,17,18,18,18,17,17,17,17,17,17,17,18,18,18,18,18,18,18,17,17,16,16,16,16,17,17,18,18,18,17,17,17,17,
 18,18,19,21,22,24,25,26,27,28,29,31,32,33,34,34,35,37,38,37,34,29,24,19,15,14,15,16,17,17,17,16,15,14,13,13,13,13,13,13,13,12,12,
 10,6,2,3,15,43,88,145,199,237,252,242,211,167,117,70,35,16,14,22,32,38,37,32,27,24,24,26,27,28,28,27,28,28,30,31,31,31,32,33,34,36,
@@ -60,27 +64,15 @@ const char ecg[BUFFER_SIZE] = {
 
 /*==================[tasks declaration]=====================================*/
 
-/**
- * @brief Tarea que simula un DAC escribe valores del vector ECG como señal analógica.
- */
-void ConversorDA_task(void *pvParameter) {
-    uint8_t indice = 0;
-
-    while (true) {
-        ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // Espera la interrupción del timer
-        AnalogOutputWrite(ecg[indice]);          // Escritura al DAC
-        indice++;
-
-        if (indice >= BUFFER_SIZE) indice = 0;   // Reinicia al llegar al final
-    }
-}
-
 /**
  * @brief Tarea que lee la señal analógica generada y la transmite por UART.
- * la voy a ver en el Serial Plotter.
+ * la voy a ver en el Serial Plotter. Cada muestra pasa por el detector de QRS 
+ * y en cada latido se envía la frecuencia cardíaca.
  */
 void ConversorAD_task(void *pvParameter) {
     uint16_t valor = 0;
+    int16_t muestra;
+    qrs_beat_t latido;
     char buffer[32];
 
     while (true) {
@@ -89,6 +81,12 @@ void ConversorAD_task(void *pvParameter) {
 
         sprintf(buffer, ">brightness:%d\r\n", valor); 
         UartSendString(UART_PC, buffer);           // Envío por UART
+
+        muestra = ((int16_t)valor - ECG_OFFSET_MV) * 16;   // mV a Q15
+        if (QRSProcess(&qrs, &muestra, 1, &latido, 1) > 0) {
+            sprintf(buffer, ">lpm:%u\r\n", latido.bpm);
+            UartSendString(UART_PC, buffer);
+        }
     }
 }
 
@@ -100,13 +98,6 @@ void FuncTimerAD(void *param) {
     vTaskNotifyGiveFromISR(ConversorAD_task_handle, pdFALSE);
 }
 
-/**
- * @brief Timer de la escritura del siguiente valor ECG.
- */
-void FuncTimerDA(void *param) {
-    vTaskNotifyGiveFromISR(ConversorDA_task_handle, pdFALSE);
-}
-
 /*==================[main application entry point]==========================*/
 
 void app_main(void) {
@@ -132,6 +123,9 @@ void app_main(void) {
     // Inicialización del conversor digital-analógico (DAC)
     AnalogOutputInit();
 
+    // Detector de QRS a la frecuencia de muestreo del ADC
+    QRSInit(&qrs, 1000000 / FREC_MUESTREO_AD_US);
+
     // Configuración del timer para adquisición (lectura)
     timer_config_t timerAD = {
         .timer = TIMER_A,
@@ -141,22 +135,25 @@ void app_main(void) {
     };
     TimerInit(&timerAD);
 
-    // Configuración del timer para reproducción (salida ECG)
-    timer_config_t timerDA = {
+    // Generador de la señal ECG: el timer escribe el DAC desde la interrupción, sin tarea
+    analog_wave_config_t ecg_wave = {
         .timer = TIMER_B,
-        .period = FREC_REPRO_DA_US,
-        .func_p = FuncTimerDA,
+        .samples = ecg,
+        .size = BUFFER_SIZE,
+        .sample_frec = 1000000 / FREC_REPRO_DA_US,
+        .interp = INTERP_DA,
+        .loop = true,
+        .func_p = NULL,
         .param_p = NULL
     };
-    TimerInit(&timerDA);
+    AnalogOutputWaveInit(&ecg_wave);
 
     // Creo las treas
     xTaskCreate(&ConversorAD_task, "Tarea_Leer_ADC", 2048, NULL, 5, &ConversorAD_task_handle);
-    xTaskCreate(&ConversorDA_task, "Tarea_Escribir_DAC", 2048, NULL, 5, &ConversorDA_task_handle);
 
     // Inicio los timers
     TimerStart(timerAD.timer);
-    TimerStart(timerDA.timer);
+    AnalogOutputWaveStart();
 }
 
 
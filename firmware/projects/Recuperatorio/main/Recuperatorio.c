@@ -44,6 +44,7 @@
 #include "delay_mcu.h"
 #include "analog_io_mcu.h"
 #include "hc_sr04.h"
+#include "switch.h"
 #define ELECTROVALVULA GPIO_3
 #define MOTOR_COMIDA   GPIO_5
 #define TRIG_GPIO      GPIO_7
@@ -55,6 +56,8 @@
 //Hago unas banderas de control para saber si el agua y la comida estan habilitadas
 static bool agua_habilitada = false;
 static bool comida_habilitada = false;
+static uint8_t tecla_agua;      // identificadores de las teclas en los eventos
+static uint8_t tecla_comida;
 
 float agua_ml = 0;
 float comida_g = 0;
@@ -70,8 +73,15 @@ float comida_g = 0;
 void InitHardware(void) {
     GPIOInit(ELECTROVALVULA, GPIO_OUTPUT);
     GPIOInit(MOTOR_COMIDA, GPIO_OUTPUT);
-    GPIOInit(TECLA_AGUA, GPIO_INPUT);
-    GPIOInit(TECLA_COMIDA, GPIO_INPUT);
+    switch_events_config_t teclas_cfg = {
+        .switches = 0,
+        .long_ms = 0,
+        .double_ms = 0,
+        .queue_len = 8
+    };
+    SwitchesEventsInit(&teclas_cfg);
+    tecla_agua = SwitchAddKey(TECLA_AGUA);
+    tecla_comida = SwitchAddKey(TECLA_COMIDA);
     HcSr04Init(TRIG_GPIO, ECHO_GPIO);
 
     analog_input_config_t adc_cfg = {
@@ -93,36 +103,28 @@ void InitHardware(void) {
 }
 
 /**
- * @brief tarea que monitorea las teclas de agua y comida.
- * Detecta el estado de las teclas y activa/desactiva el suministro de agua y comida.
- * y envía mensajes por UART al usuario.
+ * @brief tarea que atiende las teclas de agua y comida.
+ * Espera los eventos de tecla presionada (ya sin rebotes) y activa/desactiva el suministro 
+ * de agua y comida, y envía mensajes por UART al usuario.
  * utilizo las banderas de control agua_habilitada y comida_habilitada
  */
 void TareaTeclas(void *param) {
-    bool estado_agua = true;
-    bool estado_comida = true;
+    switch_event_t evento;
 
-//controlo el agua
     while (1) {
-        if (!GPIORead(TECLA_AGUA) && estado_agua) {
+        if (!SwitchGetEvent(&evento, UINT32_MAX) || (evento.type != SWITCH_PRESS)) {
+            continue;
+        }
+//controlo el agua
+        if (evento.key == tecla_agua) {
             agua_habilitada = !agua_habilitada;
             UartSendString(UART_CONSOLA, agua_habilitada ? "[AGUA ACTIVADA]\r\n" : "[AGUA DESACTIVADA]\r\n");
-            estado_agua = false; // cambio el estado de la bandera
-        }
-        if (GPIORead(TECLA_AGUA)) {
-            estado_agua = true;
         }
 //uso la misma logica para la comida
-        if (!GPIORead(TECLA_COMIDA) && estado_comida) {
+        if (evento.key == tecla_comida) {
             comida_habilitada = !comida_habilitada;
             UartSendString(UART_CONSOLA, comida_habilitada ? "[COMIDA ACTIVADA]\r\n" : "[COMIDA DESACTIVADA]\r\n");
-            estado_comida = false;
         }
-        if (GPIORead(TECLA_COMIDA)) {
-            estado_comida = true;
-        }
-
-        vTaskDelay(pdMS_TO_TICKS(100));
     }
 }
 
@@ -159,12 +161,13 @@ void TareaAgua(void *param) {
  */
 
 void TareaComida(void *param) {
-    uint16_t raw;
+    uint16_t mv;
     while (1) {
         if (comida_habilitada) {
-            AnalogInputReadSingle(CH2, &raw);
-            float volt = (raw / 4095.0f) * 3.3f;
-            comida_g = ((volt - 0.5f) / 2.8f) * 500.0f; // (3.3-0.5)=2.8 (que seria la variacion de voltaje maximo y minimo)
+            if (!AnalogInputReadOversampled(CH2, 64, &mv)) {
+                AnalogInputReadSingle(CH2, &mv);
+            }
+            comida_g = (((int32_t)mv - 500) * 500) / 2800; // (3300-500)=2800 mV (que seria la variacion de voltaje maximo y minimo)
       //si la comida es menor a 25g, activo el motor de comida
             if (comida_g < 25) {
                 GPIOOn(MOTOR_COMIDA);
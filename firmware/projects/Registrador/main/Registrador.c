@@ -0,0 +1,207 @@
+/*! @mainpage Registrador
+ *
+ * @section genDesc General Description
+ *
+ * Registrador de datos en la flash (logger_mcu). Adquiere el canal CH1 del ADC
+ * a FREC_MUESTREO_HZ y guarda cada muestra en la partición "datalog", sin que
+ * la escritura de la flash demore la adquisición. Cada segundo guarda también
+ * el estado del registrador (muestras perdidas y bloques usados) como segunda
+ * fuente de datos. Las muestras perdidas incluyen las interrupciones del timer
+ * que no llegaron a leerse (tarea demorada) o no se atendieron a tiempo.
+ *
+ * Comandos por la UART (a BAUDIOS):
+ * - 'r': inicia / detiene el registro
+ * - 'e': envía el registro (tools/logger_decode.py lo convierte a CSV)
+ * - 'b': borra el registro
+ * - 's': estado del registrador
+ *
+ * El registro continúa después de un reinicio, a partir del último bloque escrito.
+ *
+ * @section hardConn Hardware Connection
+ *
+ * |    Peripheral  |   ESP32   	|
+ * |:--------------:|:--------------|
+ * | 	Señal		| 	CH1			|
+ *
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 18/10/2026 | Document creation		                         |
+ * | 18/10/2026 | Cuenta las lecturas del ADC perdidas, flash con auto suspend |
+ *
+ * @author Jean Pierre Arotcharen (jean.arotcharen@ingenieria.uner.edu.ar)
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "analog_io_mcu.h"
+#include "timer_mcu.h"
+#include "uart_mcu.h"
+#include "logger_mcu.h"
+#include "timestamp_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define FREC_MUESTREO_HZ    1000        /*!< Frecuencia de muestreo del ADC */
+#define BAUDIOS             921600      /*!< Velocidad de la UART (exportación rápida) */
+#define ESTADO_MUESTRAS     FREC_MUESTREO_HZ    /*!< Muestras entre registros del estado (1 s) */
+#define PERIODO_COMANDOS_MS 50          /*!< Período de lectura de los comandos */
+#define PERIODO_MUESTREO_US (1000000 / FREC_MUESTREO_HZ)
+/*==================[internal data definition]===============================*/
+static TaskHandle_t adquirir_task_handle = NULL;
+static int8_t fuente_adc;           /*!< Fuente de datos del ADC */
+static int8_t fuente_estado;        /*!< Fuente de datos del estado del registrador */
+static bool registrando = false;
+static uint64_t ultimo_tick = 0;            /*!< Tiempo de la última interrupción del timer (0: detenido) */
+static volatile uint32_t perdidas_timer = 0;    /*!< Interrupciones no atendidas (escrita solo en la interrupción) */
+static volatile uint32_t perdidas_tarea = 0;    /*!< Interrupciones sin lectura del ADC (escrita solo en la tarea) */
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Interrupción del timer: habilita una lectura del ADC. Si pasó más de un
+ * período desde la anterior se perdieron interrupciones.
+ */
+static void FuncTimerAD(void *param){
+    uint64_t ahora = TimestampGet();
+    if(ultimo_tick != 0){
+        uint32_t periodos = ((uint32_t)(ahora - ultimo_tick) + PERIODO_MUESTREO_US / 2) / PERIODO_MUESTREO_US;
+        if(periodos > 1){
+            perdidas_timer += periodos - 1;
+        }
+    }
+    ultimo_tick = ahora;
+    vTaskNotifyGiveFromISR(adquirir_task_handle, pdFALSE);
+}
+
+/**
+ * @brief Muestras perdidas: las del registrador y las lecturas del ADC que no se hicieron.
+ */
+static uint32_t muestras_perdidas(const logger_status_t *estado){
+    return estado->dropped + perdidas_timer + perdidas_tarea;
+}
+
+/**
+ * @brief Tarea de adquisición: lee el ADC y guarda la muestra (solo en RAM,
+ * la tarea del registrador la escribe en la flash).
+ */
+static void tarea_adquirir(void *param){
+    uint16_t valor;
+    uint32_t muestras = 0;
+    logger_status_t estado;
+    while(true){
+        /* Cada notificación pendiente es una interrupción del timer: lee una sola muestra */
+        uint32_t pendientes = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        perdidas_tarea += pendientes - 1;
+        if(!AnalogInputReadSingle(CH1, &valor)){
+            perdidas_tarea++;
+            continue;
+        }
+        int32_t muestra = valor;
+        LoggerWrite(fuente_adc, &muestra);
+        if(++muestras == ESTADO_MUESTRAS){
+            muestras = 0;
+            LoggerStatus(&estado);
+            int32_t datos[2] = {muestras_perdidas(&estado), estado.blocks_used};
+            LoggerWrite(fuente_estado, datos);
+        }
+    }
+}
+
+/**
+ * @brief Envía por la UART el estado del registrador.
+ */
+static void enviar_estado(void){
+    char msg[96];
+    logger_status_t estado;
+    LoggerStatus(&estado);
+    snprintf(msg, sizeof(msg), "%s: %lu/%lu bloques, %lu perdidas, %lu borrados\r\n",
+             registrando ? "Registrando" : "Detenido", estado.blocks_used, estado.blocks_total,
+             muestras_perdidas(&estado), estado.erase_max);
+    UartSendString(UART_PC, msg);
+}
+
+/**
+ * @brief Tarea que atiende los comandos recibidos por la UART.
+ */
+static void tarea_comandos(void *param){
+    uint8_t comando;
+    while(true){
+        vTaskDelay(pdMS_TO_TICKS(PERIODO_COMANDOS_MS));
+        if(!UartReadByte(UART_PC, &comando)){
+            continue;
+        }
+        switch(comando){
+            case 'r':
+                registrando = !registrando;
+                if(registrando){
+                    ultimo_tick = 0;
+                    TimerStart(TIMER_A);
+                } else{
+                    TimerStop(TIMER_A);
+                    LoggerFlush();
+                }
+                enviar_estado();
+                break;
+            case 'e':
+                LoggerExport(UART_PC);
+                break;
+            case 'b':
+                LoggerErase();
+                enviar_estado();
+                break;
+            case 's':
+                enviar_estado();
+                break;
+        }
+    }
+}
+/*==================[external functions definition]==========================*/
+void app_main(void){
+    serial_config_t uart_cfg = {
+        .port = UART_PC,
+        .baud_rate = BAUDIOS,
+        .func_p = UART_NO_INT,
+        .param_p = NULL
+    };
+    UartInit(&uart_cfg);
+
+    analog_input_config_t adc_cfg = {
+        .input = CH1,
+        .mode = ADC_SINGLE,
+        .func_p = NULL,
+        .param_p = NULL
+    };
+    AnalogInputInit(&adc_cfg);
+
+    // El registrador escribe la flash con menor prioridad que la adquisición
+    logger_config_t logger_cfg = {
+        .partition = NULL,
+        .priority = 2
+    };
+    if(!LoggerInit(&logger_cfg)){
+        UartSendString(UART_PC, "No se encuentra la particion \"datalog\" (partitions.csv)\r\n");
+        return;
+    }
+    logger_source_t adc = {.name = "adc", .channels = 1, .delta = true};
+    logger_source_t estado = {.name = "estado", .channels = 2, .delta = true};
+    fuente_adc = LoggerAddSource(&adc);
+    fuente_estado = LoggerAddSource(&estado);
+
+    timer_config_t timer_ad = {
+        .timer = TIMER_A,
+        .period = PERIODO_MUESTREO_US,
+        .func_p = FuncTimerAD,
+        .param_p = NULL
+    };
+    TimerInit(&timer_ad);
+
+    xTaskCreate(&tarea_adquirir, "Adquirir", 3072, NULL, 5, &adquirir_task_handle);
+    xTaskCreate(&tarea_comandos, "Comandos", 3072, NULL, 3, NULL);
+    UartSendString(UART_PC, "\r\nRegistrador: 'r' iniciar/detener, 'e' exportar, 'b' borrar, 's' estado\r\n");
+    enviar_estado();
+}
+/*==================[end of file]============================================*/
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+"""Decode the log sent by LoggerExport() (logger_mcu.h) to one CSV file per
+source: time_us,ch0,ch1,...
+
+The input is the raw capture of the serial port (binary: save it with this
+script or with a terminal that doesn't translate line ends).
+
+    python logger_decode.py --port /dev/ttyUSB0 --baud 921600 -o registro
+    python logger_decode.py captura.bin -o registro
+
+Blocks with a wrong CRC are skipped and reported.
+"""
+import argparse
+import struct
+import sys
+
+MAGIC = 0x474F4C44
+HEADER = struct.Struct("<IIIHH")    # magic, seq, erases, used, crc
+KEY = 0x80
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def capture(args):
+    """Read the serial port from the "#LOG" line to the blocks and "#END"."""
+    import serial
+    data = bytearray()
+    with serial.Serial(args.port, args.baud, timeout=args.timeout) as port:
+        port.write(args.command.encode())
+        while True:
+            chunk = port.read(4096)
+            if not chunk:
+                break
+            data += chunk
+            end = data.find(b"#DATA\r\n")
+            if end >= 0 and data.find(b"\r\n#END", end) >= 0 and len(data) >= end + expected_size(data):
+                break
+    if args.save:
+        with open(args.save, "wb") as f:
+            f.write(data)
+    return bytes(data)
+
+
+def expected_size(data):
+    start = data.rfind(b"#LOG,")
+    if start < 0:
+        return 1 << 62
+    fields = data[start:data.find(b"\r\n", start)].split(b",")
+    return int(fields[1]) * int(fields[2])
+
+
+def parse(data):
+    start = data.rfind(b"#LOG,")
+    if start < 0:
+        sys.exit("No #LOG header found")
+    pos = start
+    sources = {}
+    block_size = count = 0
+    while True:
+        end = data.index(b"\r\n", pos)
+        fields = data[pos:end].decode(errors="replace").split(",")
+        pos = end + 2
+        if fields[0] == "#LOG":
+            block_size, count = int(fields[1]), int(fields[2])
+        elif fields[0] == "#SRC":
+            sources[int(fields[1])] = (fields[2], int(fields[3]), fields[4] == "1")
+        elif fields[0] == "#DATA":
+            break
+    blocks = [data[pos + i * block_size:pos + (i + 1) * block_size] for i in range(count)]
+    if count and len(blocks[-1]) < block_size:
+        sys.exit("Incomplete capture: %d of %d bytes" % (len(data) - pos, block_size * count))
+    return sources, blocks
+
+
+def varint(block, pos):
+    value = shift = 0
+    while True:
+        byte = block[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def to_int32(value):
+    value &= 0xFFFFFFFF
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def decode_block(block, sources, rows):
+    _, _, _, used, _ = HEADER.unpack_from(block)
+    pos, time, last = HEADER.size, None, {}
+    while pos < used:
+        head = block[pos]
+        pos += 1
+        src = head & ~KEY
+        name, channels, _ = sources[src]
+        dt, pos = varint(block, pos)
+        time = dt if time is None else time + dt
+        values = []
+        for ch in range(channels):
+            z, pos = varint(block, pos)
+            v = (z >> 1) ^ -(z & 1)
+            if not head & KEY:
+                v = to_int32(last[src][ch] + v)
+            values.append(v)
+        last[src] = values
+        rows.setdefault(src, []).append([time] + values)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("capture", nargs="?", help="binary capture of the serial port")
+    parser.add_argument("-o", "--output", default="log", help="CSV files prefix")
+    parser.add_argument("--port", help="read from a serial port instead of a file (needs pyserial)")
+    parser.add_argument("--baud", type=int, default=921600)
+    parser.add_argument("--command", default="e", help="character that starts the export")
+    parser.add_argument("--timeout", type=float, default=3, help="serial read timeout (s)")
+    parser.add_argument("--save", help="also save the raw capture")
+    args = parser.parse_args()
+    if args.capture is None and args.port is None:
+        parser.error("a capture file or --port is required")
+    if args.port is None:
+        with open(args.capture, "rb") as f:
+            data = f.read()
+    else:
+        data = capture(args)
+
+    sources, blocks = parse(data)
+    valid, bad = [], 0
+    for block in blocks:
+        magic, seq, erases, used, crc = HEADER.unpack_from(block)
+        if magic != MAGIC or used > len(block) or crc16(block[HEADER.size:used]) != crc:
+            bad += 1
+            continue
+        valid.append((seq, erases, block))
+    # The log can wrap around while it is exported: keep the sequence order
+    valid.sort(key=lambda b: b[0])
+    rows = {}
+    for _, _, block in valid:
+        decode_block(block, sources, rows)
+
+    for src, (name, channels, _) in sources.items():
+        filename = "%s_%s.csv" % (args.output, name)
+        with open(filename, "w", encoding="utf-8") as f:
+            f.write("time_us," + ",".join("ch%d" % ch for ch in range(channels)) + "\n")
+            for row in rows.get(src, []):
+                f.write(",".join(str(v) for v in row) + "\n")
+        print("%s: %d samples -> %s" % (name, len(rows.get(src, [])), filename))
+    print("%d blocks, %d with errors, max erase count %d" % (len(valid), bad, max((b[1] for b in valid), default=0)))
+
+
+if __name__ == "__main__":
+    main()
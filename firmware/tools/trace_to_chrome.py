@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""Convert the events sent by TraceExportEvents() (trace_mcu.h) to a Chrome
+trace / Perfetto JSON file (open it in https://ui.perfetto.dev or chrome://tracing).
+
+The input is the text received from the serial port, for example the log saved
+by the monitor. Only the lines between "#TRACE,<cycles_per_us>" and "#END" are
+used; when the log has several exports the last one is converted.
+
+    python trace_to_chrome.py log.txt -o trace.json
+    python trace_to_chrome.py --port /dev/ttyUSB0 -o trace.json   (needs pyserial)
+"""
+import argparse
+import json
+import sys
+
+WRAP = 1 << 32
+
+
+def read_lines(args):
+    if args.port is None:
+        with open(args.log, encoding="utf-8", errors="replace") as f:
+            yield from f
+        return
+    import serial
+    with serial.Serial(args.port, args.baud, timeout=args.timeout) as port:
+        while True:
+            line = port.readline()
+            if not line:
+                return
+            line = line.decode("utf-8", errors="replace")
+            yield line
+            if line.startswith("#END"):
+                return
+
+
+def parse(lines):
+    """Return (cycles_per_us, [(core, name, start, cycles)]) of the last export."""
+    cycles_us, events, current = None, None, None
+    for line in lines:
+        line = line.strip()
+        if line.startswith("#TRACE,"):
+            current = (int(line.split(",")[1]), [])
+        elif line.startswith("#END"):
+            if current is not None:
+                cycles_us, events = current
+            current = None
+        elif current is not None:
+            fields = line.split(",")
+            if len(fields) != 4:
+                continue
+            try:
+                current[1].append((int(fields[0]), fields[1], int(fields[2]), int(fields[3])))
+            except ValueError:
+                continue
+    if events is None:
+        sys.exit("No #TRACE ... #END block found")
+    if cycles_us == 0:
+        sys.exit("Trace disabled in the firmware (CONFIG_TRACE_ENABLE)")
+    return cycles_us, events
+
+
+def to_chrome(cycles_us, events):
+    """The events of each core are sent in exit order: the exit times only
+    decrease when the 32 bit cycle counter wraps."""
+    out, last_end, offset = [], {}, {}
+    for core, name, start, cycles in events:
+        end = (start + cycles) % WRAP
+        if core in last_end and end < last_end[core]:
+            offset[core] = offset.get(core, 0) + WRAP
+        last_end[core] = end
+        end += offset.get(core, 0)
+        out.append({"name": name, "ph": "X", "pid": 0, "tid": core,
+                    "ts": (end - cycles) / cycles_us, "dur": cycles / cycles_us})
+    if out:
+        t0 = min(e["ts"] for e in out)
+        for e in out:
+            e["ts"] -= t0
+    return {"traceEvents": out, "displayTimeUnit": "ns"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("log", nargs="?", help="serial log with the TraceExportEvents() output")
+    parser.add_argument("-o", "--output", default="trace.json")
+    parser.add_argument("--port", help="read from a serial port instead of a file")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--timeout", type=float, default=10, help="serial read timeout (s)")
+    args = parser.parse_args()
+    if args.log is None and args.port is None:
+        parser.error("a log file or --port is required")
+    cycles_us, events = parse(read_lines(args))
+    with open(args.output, "w", encoding="utf-8") as f:
+        json.dump(to_chrome(cycles_us, events), f)
+    print(f"{len(events)} events ({cycles_us} cycles/us) -> {args.output}")
+
+
+if __name__ == "__main__":
+    main()